@@ -36,20 +36,62 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define EPSILON 1
 ///< using epsilon to avoid small numbers solving linear equations systems.
+#ifndef PRECISION
+#define PRECISION 2
+///< scalar type of the optimization (1: double, 2: long double, 3: __float128),
+///< usually set by the configure script.
+#endif
+#if PRECISION == 3
+#define MAXIMA_PRECISION 40     ///< precision digits on maxima files.
+#else
 #define MAXIMA_PRECISION 20     ///< precision digits on maxima files.
-#define OPTIMIZE_STEPS_11_6 0
-///< special optimization for 11 steps 6th order multi-steps method.
+#endif
+#define CACHE_LINE_SIZE 64      ///< size in bytes of the processor cache lines.
+#define POOL_CHUNKS 16
+///< number of chunks per thread on the dynamic distribution of simulations.
+#define OPTIMIZE_BATCH 16
+///< number of simulations evaluated together on the batched evaluation mode.
+#define OPTIMIZE_BATCH_MARGIN 1e-6
+///< default relative margin to the optimal value of the double precision
+///< objective function values confirmed in full precision.
+#define OPTIMIZE_WALK_BLOCK 256
+///< number of simulations of every hit-and-run chain on the feasible region.
+#define OPTIMIZE_WALK_BURN 32
+///< number of burn-in steps of every hit-and-run chain on the feasible region.
+#define OPTIMIZE_WALK_PROJECTIONS 1000
+///< maximum number of sweeps of projections to get a feasible point.
+#define OPTIMIZE_WALK_RELAXATION REAL (1.5)
+///< relaxation factor of the projections to get a feasible point.
+#define OPTIMIZE_ELITE_SMOOTHING REAL (0.7)
+///< smoothing factor of the sampling distribution fitted to the elite
+///< simulations on the cross-entropy sampling.
+#define RANDOM_LANES 16
+///< number of blocks of the counter-based pseudo-random numbers generator
+///< computed together.
+#define RANDOM_DIMENSIONS 32
+///< maximum number of freedom degrees with Sobol or Halton sampling.
+#define OPTIMIZE_SPECIALIZED 1
+///< specialized sampling loops calling directly the method and objective
+///< functions.
 
 #define XML_AC                 (const xmlChar *) "ac"
 ///< ac XML label.
+#define XML_ASYNCHRONOUS       (const xmlChar *) "asynchronous"
+///< asynchronous XML label.
 #define XML_BOTTOM             (const xmlChar *) "bottom"
 ///< bottom XML label.
 #define XML_CLIMBING_FACTOR    (const xmlChar *) "climbing-factor"
 ///< climbing-factor XML label.
 #define XML_CONVERGENCE_FACTOR (const xmlChar *) "convergence-factor"
 ///< convergence-factor XML label.
+#define XML_ELITE              (const xmlChar *) "elite"
+///< elite XML label.
 #define XML_EXTREME            (const xmlChar *) "extreme"
 ///< extreme XML label.
+#define XML_FEASIBLE           (const xmlChar *) "feasible"
+///< feasible XML label.
+#define XML_HALTON             (const xmlChar *) "halton"
+///< halton XML label.
 #define XML_INTERVAL           (const xmlChar *) "interval"
 ///< interval XML label.
 #define XML_MINIMUM            (const xmlChar *) "minimum"
@@ -60,6 +102,8 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ///< niterations XML label.
 #define XML_NO                 (const xmlChar *) "no"
 ///< no XML label.
+#define XML_NSAMPLES           (const xmlChar *) "nsamples"
+///< nsamples XML label.
 #define XML_NSIMULATIONS       (const xmlChar *) "nsimulations"
 ///< nsimulations XML label.
 #define XML_ORDER              (const xmlChar *) "order"
@@ -74,6 +118,8 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ///< regular XML label.
 #define XML_RUNGE_KUTTA        (const xmlChar *) "Runge-Kutta"
 ///< Runge-Kutta XML label.
+#define XML_SOBOL              (const xmlChar *) "sobol"
+///< sobol XML label.
 #define XML_STEPS              (const xmlChar *) "steps"
 ///< steps XML label.
 #define XML_STRONG             (const xmlChar *) "strong"
@@ -42,13 +42,13 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <unistd.h>
 #include <libxml/parser.h>
 #include <glib.h>
-#include <gsl/gsl_rng.h>
 #include <libintl.h>
 #if HAVE_MPI
 #include <mpi.h>
 #endif
 #include "config.h"
 #include "utils.h"
+#include "pool.h"
 #include "optimize.h"
 #include "steps.h"
 #include "rk.h"
@@ -254,6 +254,7 @@ enum
   ERROR_CODE_BAD_STEPS = 5,     ///< bad multi-steps method.
   ERROR_CODE_UNKNOWN_METHOD = 6,        ///< unknown method.
   ERROR_CODE_UNKNOWN_OPTION = 7,        ///< unknown option.
+  ERROR_CODE_BAD_ASYNCHRONOUS = 8,      ///< bad asynchronous mode.
 } ErrorCode;
 
 unsigned int nsteps;            ///< steps number.
@@ -269,7 +270,13 @@ main (int argn,                 ///< arguments number.
       char **argc)              ///< argument chains array.
 {
   const struct option options[] = {
+    {"asynchronous", no_argument, NULL, 'a'},
+    {"batch", no_argument, NULL, 'b'},
+    {"dynamic", no_argument, NULL, 'd'},
     {"help", no_argument, NULL, 'h'},
+    {"margin", required_argument, NULL, 'm'},
+    {"numa", no_argument, NULL, 'n'},
+    {"pin", no_argument, NULL, 'p'},
     {"seed", required_argument, NULL, 's'},
     {"threads", required_argument, NULL, 't'},
     {NULL, 0, NULL, 0}
@@ -277,38 +284,70 @@ main (int argn,                 ///< arguments number.
   const char *usage = _("Usage is:\n"
                         "./ode "
                         "[-t --threads threads_number] "
+                        "[-a --asynchronous] "
+                        "[-b --batch] "
+                        "[-m --margin batch_margin] "
+                        "[-d --dynamic] "
+                        "[-p --pin | -n --numa] "
                         "[-s --seed random_seed] "
                         "input_file [variables_file]");
   xmlDoc *doc;
   xmlNode *node;
-  gsl_rng *rng0, **rng;
+  xmlChar *prop;
   time_t d0;
   clock_t t0;
-  unsigned long int seed = 7l;
+  unsigned long long int seed = 7ll;
+  const char *pinning_name[] = { "none", "cores", "numa" };
   int o, option_index;
-  unsigned int i, j, k, h = 0;
+#if HAVE_MPI
+  int provided;
+#endif
+  unsigned int h = 0, pinning = POOL_PIN_NONE;
 
 #if HAVE_MPI
-  // Init MPI
-  MPI_Init (&argn, &argc);
+  // Init MPI, the threads can call MPI functions in a serialized way
+  MPI_Init_thread (&argn, &argc, MPI_THREAD_SERIALIZED, &provided);
 #endif
 
   // Enabling spaces in XML files
   xmlKeepBlanksDefault (0);
 
-  // Setting the threads as the number of processors
-  nthreads = sysconf (_SC_NPROCESSORS_CONF);
+  // Setting the threads as the number of processors available to the process
+  nthreads = pool_cpus ();
 
   // Parsing command line options
   while (1)
     {
-      o = getopt_long (argn, argc, "hs:t:", options, &option_index);
+      o = getopt_long (argn, argc, "abdhm:nps:t:", options, &option_index);
       if (o == -1)
         break;
       switch (o)
         {
+        case 'a':
+          asynchronous = 1;
+          break;
+        case 'b':
+          batch = 1;
+          break;
+        case 'd':
+          dynamic = 1;
+          break;
+        case 'm':
+          batch_margin = atof (optarg);
+          if (!(batch_margin >= 0.))
+            {
+              show_error (_("Bad batch margin"));
+              return ERROR_CODE_UNKNOWN_OPTION;
+            }
+          break;
+        case 'n':
+          pinning = POOL_PIN_NUMA;
+          break;
+        case 'p':
+          pinning = POOL_PIN_CORES;
+          break;
         case 's':
-          seed = atol (optarg);
+          seed = strtoull (optarg, NULL, 10);
           break;
         case 't':
           nthreads = atoi (optarg);
@@ -351,7 +390,8 @@ main (int argn,                 ///< arguments number.
 #endif
 
   // Select the numerical model
-  printf ("Rank=%d nnodes=%d nthreads=%u\n", rank, nnodes, nthreads);
+  printf ("Rank=%d nnodes=%d nthreads=%u pinning=%s\n",
+          rank, nnodes, nthreads, pinning_name[pinning]);
   printf ("Selecting method optind=%d\n", optind);
   doc = xmlParseFile (argc[optind]);
   if (!doc)
@@ -366,25 +406,55 @@ main (int argn,                 ///< arguments number.
       return ERROR_CODE_NO_XML_ROOT;
     }
 
-  // Init a random numbers generator per node and thread
-  printf ("Initing random numbers\n");
-  rng = (gsl_rng **) g_slice_alloc (nnodes * nthreads * sizeof (gsl_rng *));
-  rng0 = gsl_rng_alloc (gsl_rng_ranlxs2);
-  gsl_rng_set (rng0, seed);
-  for (i = k = 0; (int) i < nnodes; ++i)
-    for (j = 0; j < nthreads; ++j, ++k)
-      {
-        rng[k] = gsl_rng_alloc (gsl_rng_taus2);
-        gsl_rng_set (rng[k], gsl_rng_get (rng0));
-      }
+  // Select the asynchronous optimization iterations mode
+  prop = xmlGetProp (node, XML_ASYNCHRONOUS);
+  if (prop)
+    {
+      if (!xmlStrcmp (prop, XML_YES))
+        asynchronous = 1;
+      else if (xmlStrcmp (prop, XML_NO))
+        {
+          xmlFree (prop);
+          xmlFreeDoc (doc);
+          show_error (_("Bad asynchronous mode"));
+          return ERROR_CODE_BAD_ASYNCHRONOUS;
+        }
+      xmlFree (prop);
+    }
+  if (asynchronous && nnodes > 1)
+    {
+      printf ("Asynchronous mode disabled with several nodes\n");
+      asynchronous = 0;
+    }
+  if (dynamic && nnodes == 1)
+    {
+      printf ("Dynamic mode disabled with one node\n");
+      dynamic = 0;
+    }
+#if HAVE_MPI
+  if (dynamic && provided < MPI_THREAD_SERIALIZED)
+    {
+      printf ("Dynamic mode disabled without MPI threads support\n");
+      dynamic = 0;
+    }
+#endif
 
   if (argn == 2)
     file_variables = fopen (argc[++optind], "w");
 
-  j = rank * nthreads;
+  // Init the low-discrepancy sequences
+  random_sobol_init ();
+
+  // Create the persistent pool of worker threads
+  pool_init (nthreads, pinning);
+#if HAVE_MPI
+  if (dynamic)
+    optimize_dynamic_init ();
+#endif
+
   if (!xmlStrcmp (node->name, XML_RUNGE_KUTTA))
     {
-      if (!rk_run (node, rng))
+      if (!rk_run (node, seed))
         {
           show_error (error_message);
           return ERROR_CODE_BAD_RK;
@@ -392,7 +462,7 @@ main (int argn,                 ///< arguments number.
     }
   else if (!xmlStrcmp (node->name, XML_STEPS))
     {
-      if (!steps_run (node, rng))
+      if (!steps_run (node, seed))
         {
           show_error (error_message);
           return ERROR_CODE_BAD_STEPS;
@@ -408,17 +478,15 @@ main (int argn,                 ///< arguments number.
           (clock () - t0) / ((double) CLOCKS_PER_SEC), time (NULL) - d0);
 
   // Free memory
+  pool_free ();
   xmlFreeDoc (doc);
   if (file_variables)
     fclose (file_variables);
-  j = nnodes * nthreads;
-  for (i = 0; i < j; ++i)
-    gsl_rng_free (rng[i]);
-  g_slice_free1 (j * sizeof (gsl_rng *), rng);
-  gsl_rng_free (rng0);
 
 #if HAVE_MPI
   // Close MPI
+  if (dynamic)
+    optimize_dynamic_free ();
   MPI_Finalize ();
 #endif
 
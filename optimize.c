@@ -33,18 +33,20 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #define _GNU_SOURCE
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include <float.h>
 #include <math.h>
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #if HAVE_MPI
 #include <mpi.h>
 #endif
 #include "config.h"
 #include "utils.h"
+#include "pool.h"
 #include "optimize.h"
 
 #define DEBUG_OPTIMIZE 0        ///< macro to debug.
@@ -54,6 +56,58 @@ FILE *file_variables = NULL;    ///< random variables file.
 int rank;                       ///< MPI rank.
 int nnodes;                     ///< MPI nodes number.
 unsigned nthreads;              ///< threads number.
+unsigned int asynchronous = 0;  ///< asynchronous optimization iterations mode.
+unsigned int dynamic = 0;
+///< dynamic distribution of the simulations between the nodes mode.
+unsigned int batch = 0;         ///< batched evaluation of the simulations mode.
+double batch_margin = OPTIMIZE_BATCH_MARGIN;
+///< relative margin to the optimal value to confirm in full precision
+///< the simulations screened in double precision on the batched mode.
+
+/**
+ * \struct OptimizeAsynchronous
+ * \brief struct to define the data shared by the threads on the asynchronous
+ *   optimization iterations.
+ */
+typedef struct
+{
+  Real *minimum;
+  ///< shared array of minimum values of the freedom degrees.
+  Real *interval;
+  ///< shared array of intervals of the freedom degrees.
+  unsigned long long int next;  ///< next simulation to distribute.
+  unsigned long long int last;  ///< total number of simulations.
+  unsigned long long int reported;      ///< number of reported simulations.
+  unsigned long long int chunk; ///< number of simulations to get every time.
+  unsigned int version;         ///< version of the shared intervals.
+} OptimizeAsynchronous;
+
+static OptimizeAsynchronous optimize_asynchronous[1];
+///< shared data of the asynchronous optimization iterations.
+
+#if HAVE_MPI
+
+/**
+ * \struct OptimizeDynamic
+ * \brief struct to define the data to distribute dynamically the simulations
+ *   between the nodes.
+ */
+typedef struct
+{
+  GMutex mutex[1];              ///< GMutex struct to serialize the MPI calls.
+  MPI_Win window;
+  ///< MPI window to access the counter of the master node.
+  unsigned long long int counter;
+  ///< next simulation to distribute, used only on the master node.
+  unsigned long long int last;  ///< total number of simulations.
+  unsigned long long int chunk; ///< number of simulations to get every time.
+  unsigned int done;            ///< 1 if all the simulations are distributed.
+} OptimizeDynamic;
+
+static OptimizeDynamic optimize_dynamic[1];
+///< data of the dynamic distribution of the simulations between the nodes.
+
+#endif
 
 /**
  * Function to print the random variables on a file.
@@ -65,179 +119,780 @@ optimize_print_random (Optimize * optimize,     ///< Optimize struct.
   unsigned int i, n;
   n = optimize->nfree;
   for (i = 0; i < n; ++i)
-    fprintf (file, "o%d:%.19Le;\n", i, optimize->value_optimal[i]);
+    fprintf (file, "o%d:" REAL_E ";\n", i, real_e (optimize->value_optimal[i]));
   for (i = 0; i < n; ++i)
-    fprintf (file, "m%d:%.19Le;\n", i, optimize->minimum[i]);
+    fprintf (file, "m%d:" REAL_E ";\n", i, real_e (optimize->minimum[i]));
   for (i = 0; i < n; ++i)
-    fprintf (file, "i%d:%.19Le;\n", i, optimize->interval[i]);
+    fprintf (file, "i%d:" REAL_E ";\n", i, real_e (optimize->interval[i]));
 }
 
 /**
- * Function to perform every optimization step.
+ * Function to evaluate the probes of a hill climbing step not evaluated yet.
+ * It is called by the thread owning the probes and by the threads helping it,
+ * every thread with its own Optimize struct. With a probe function the probes
+ * are screened and only the ones passing the optimize_screen function are
+ * evaluated again by the method and objective functions, so the values of the
+ * probes that can be accepted are the same than without the probe function.
  */
 void
-optimize_step (Optimize * optimize)     ///< Optimize struct.
+optimize_probes_evaluate (Optimize * optimize,  ///< Optimize struct.
+                          void *data,
+                          ///< argument of the method and objective functions.
+                          OptimizeProbes * probes)
+                          ///< OptimizeProbes struct.
 {
-  long double *is, *vo, *vo2, *random;
-  long double o, o2, v, f;
-  unsigned long long int ii, nrandom;
-  unsigned int i, j, k, n, nfree;
-
-#if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_step: start\n");
-#endif
-
-  // save optimal values
-#if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_step: save optimal values\n");
-#endif
+  Real *random;
+  Real o;
+  unsigned int j, nfree;
+  int p;
   nfree = optimize->nfree;
-  o2 = *optimize->optimal;
-  vo = (long double *) alloca (nfree * sizeof (long double));
-  vo2 = (long double *) alloca (nfree * sizeof (long double));
-  memcpy (vo, optimize->value_optimal, nfree * sizeof (long double));
-
-  // optimization algorithm sampling
-#if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_step: optimization algorithm sampling\n");
-  fprintf (stderr, "optimize_step: nsimulations=%Lu\n", optimize->nsimulations);
-#endif
   random = optimize->random_data;
-  ii = optimize->nsimulations * (rank * nthreads + optimize->thread)
-    / (nnodes * nthreads);
-  nrandom = optimize->nsimulations * (rank * nthreads + optimize->thread + 1)
-    / (nnodes * nthreads);
-  for (; ii < nrandom; ++ii)
+  for (p = -1;;)
     {
+      j = __atomic_fetch_add (&probes->next, 1, __ATOMIC_RELAXED);
+      if (j >= probes->last)
+        break;
+      optimize->simulation = probes->simulation + j;
 
-      // random freedom degrees
-#if DEBUG_OPTIMIZE
-      fprintf (stderr, "optimize_step: random freedom degrees\n");
-      fprintf (stderr, "optimize_step: simulation=%Lu\n", ii);
-#endif
-      optimize_generate_freedom (optimize, ii);
-
-      // method coefficients
-#if DEBUG_OPTIMIZE
-      fprintf (stderr, "optimize_step: method coefficients\n");
-#endif
-      if (!optimize->method (optimize))
-        o = INFINITY;
-      else
-        o = optimize->objective (optimize);
-      if (o < o2)
+      // with a probe function the method variables are calculated on the
+      // climbing centre, again after evaluating a probe
+      if (p < 0)
         {
-          o2 = o;
-          memcpy (vo, random, nfree * sizeof (long double));
+          p = 0;
+          if (optimize->probe && probes->tail == probes->centre)
+            {
+              memcpy (random, probes->centre, nfree * sizeof (Real));
+              p = optimize->method ((Optimize *) data);
+            }
         }
-      if (file_variables)
+      if (p)
         {
-          g_mutex_lock (mutex);
-          print_variables (random, nfree, file_variables);
-          fprintf (file_variables, "%.19Le\n", o);
-          g_mutex_unlock (mutex);
+          o = optimize_probe (optimize, j >> 1,
+                              optimize_probes_value (probes, j),
+                              probes->cutoff);
+          if (!optimize_screen (o, probes->cutoff))
+            {
+              probes->probe[j] = o;
+              continue;
+            }
+          p = -1;
         }
+      optimize_probes_point (probes, random, j, nfree);
+      probes->probe[j] = optimize_evaluate (optimize, data, probes->cutoff);
     }
+}
+
+/**
+ * Function to help on the evaluation of the probes of a hill climbing step of
+ * other thread, with the Optimize struct of the helping thread.
+ */
+void
+optimize_probes_help (OptimizeProbes * probes,  ///< OptimizeProbes struct.
+                      unsigned int thread)      ///< helping thread number.
+{
+  Optimize *optimize;
+  optimize = (Optimize *) pool_data (thread);
+  optimize_probes_evaluate (optimize, optimize, probes);
+}
+
+/**
+ * Function to evaluate the probes of a hill climbing step helped by the threads
+ * waiting on a barrier.
+ */
+void
+optimize_probes_run (OptimizeProbes * probes,   ///< OptimizeProbes struct.
+                     Optimize * optimize,       ///< Optimize struct.
+                     void *data,
+                     ///< argument of the method and objective functions.
+                     unsigned int thread)       ///< thread number.
+{
+  unsigned int help;
+  help = nthreads > 1 && probes->last - probes->next > 1;
+  if (help)
+    pool_job_post (thread, (PoolHelp) probes->help, probes->job);
+  optimize_probes_evaluate (optimize, data, probes);
+  if (help)
+    pool_job_remove (thread);
+}
+
+/**
+ * Function to perform the coordinates hill climbing optimization algorithm
+ * around an optimal point. The probes of every climbing step are evaluated
+ * helped by the threads waiting on a barrier and they are reduced in the
+ * serial order, so the accepted moves are the same than on the serial
+ * algorithm.
+ *
+ * \return optimal objective function value.
+ */
+static Real
+optimize_climb (Optimize * optimize,    ///< Optimize struct.
+                Real *vo,
+                ///< array of freedom degree values of the initial point.
+                Real *vo2,
+                ///< array of freedom degree values of the optimal point.
+                Real o2,
+                ///< objective function value of the initial point.
+                unsigned long long int *i2)
+                ///< pointer to the simulation number of the optimal point.
+{
+  OptimizeProbes probes[1];
+  Real *is, *random, *probe;
+  Real o, f;
+  unsigned int i, j, k, n, nfree, nprobes;
+
+  nfree = optimize->nfree;
+  nprobes = 2 * nfree;
+  random = optimize->random_data;
 
   // array of intervals to climb around the optimal
 #if DEBUG_OPTIMIZE
   fprintf (stderr,
-           "optimize_step: array of intervals to climb around the optimal\n");
+           "optimize_climb: array of intervals to climb around the optimal\n");
 #endif
-  is = (long double *) alloca (nfree * sizeof (long double));
+  is = optimize->work + 2 * nfree;
   for (j = 0; j < nfree; ++j)
     is[j] = optimize->interval0[j] * optimize->climbing_factor;
 
-  // hill climbing algorithm bucle
+  // hill climbing algorithm bucle, every step restarting from the climbing
+  // centre
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_step: hill climbing algorithm bucle\n");
+  fprintf (stderr, "optimize_climb: hill climbing algorithm bucle\n");
 #endif
-  memcpy (vo2, vo, nfree * sizeof (long double));
+  probe = (Real *) alloca (nprobes * sizeof (Real));
+  probes->help = (void (*)(void *, unsigned int)) optimize_probes_help;
+  probes->job = probes;
+  probes->centre = probes->tail = vo;
+  probes->step = is;
+  probes->probe = probe;
+  memcpy (vo2, vo, nfree * sizeof (Real));
   n = optimize->nclimbings;
   for (i = 0; i < n; ++i)
     {
-      memcpy (random, vo, nfree * sizeof (long double));
-      for (j = k = 0; j < nfree; ++j)
+
+      // evaluate the probes with the optimal value as cut-off, numbering them
+      // after the simulations of the iteration
+      probes->cutoff = file_variables ? INFINITY : o2;
+      probes->simulation
+        = optimize->nsimulations + (optimize->thread * n + i) * nprobes;
+      probes->next = 0;
+      probes->last = nprobes;
+      optimize_probes_run (probes, optimize, optimize, optimize->thread);
+
+      // reduce the probes in the serial order
+      for (j = 0, k = nprobes; j < nprobes; ++j)
         {
-          v = vo[j];
-          random[j] = v + is[j];
-          if (!optimize->method (optimize))
-            o = INFINITY;
-          else
-            o = optimize->objective (optimize);
+          o = probe[j];
           if (o < o2)
             {
-              k = 1;
               o2 = o;
-              memcpy (vo2, random, nfree * sizeof (long double));
+              k = j;
             }
           if (file_variables)
             {
+              optimize_probes_point (probes, random, j, nfree);
               g_mutex_lock (mutex);
               print_variables (random, nfree, file_variables);
-              fprintf (file_variables, "%.19Le\n", o);
+              fprintf (file_variables, REAL_E "\n", real_e (o));
               g_mutex_unlock (mutex);
             }
-          random[j] = fmaxl (0.L, v - is[j]);
-          if (!optimize->method (optimize))
-            o = INFINITY;
-          else
-            o = optimize->objective (optimize);
-          if (o < o2)
-            {
-              k = 1;
-              o2 = o;
-              memcpy (vo2, random, nfree * sizeof (long double));
-            }
-          if (file_variables)
-            {
-              g_mutex_lock (mutex);
-              print_variables (random, nfree, file_variables);
-              fprintf (file_variables, "%.19Le\n", o);
-              g_mutex_unlock (mutex);
-            }
-          random[j] = v;
         }
 
-
       // update optimal values and increase or reduce intervals if converging or
       // not
-      if (!k)
-        f = 0.5L;
+      if (k == nprobes)
+        f = REAL (0.5);
       else
         {
-          f = 1.2L;
-          memcpy (vo, vo2, nfree * sizeof (long double));
+          f = REAL (1.2);
+          *i2 = probes->simulation + k;
+          optimize_probes_point (probes, vo2, k, nfree);
+          memcpy (vo, vo2, nfree * sizeof (Real));
         }
       for (j = 0; j < nfree; ++j)
         is[j] *= f;
     }
+  return o2;
+}
+
+/**
+ * Function to perform the sampling of a range of simulations by batches. The
+ * objective function of every batch is evaluated in double precision by the
+ * batch function and only the simulations passing the optimize_screen function
+ * are evaluated again in full precision, in the serial order and with the same
+ * cut-off and ties breaking on the simulation number, so the optimal values are
+ * the same than on the scalar sampling with any number of threads.
+ *
+ * \return optimal objective function value.
+ */
+Real
+optimize_sample_batch (Optimize * optimize,     ///< Optimize struct.
+                       unsigned long long int first,
+                       ///< first simulation.
+                       unsigned long long int last,
+                       ///< end of the simulations.
+                       Real o2,
+                       ///< initial optimal objective function value.
+                       unsigned long long int *i2,
+                       ///< pointer to the optimal simulation number.
+                       Real *vo)
+                       ///< array of optimal freedom degree values.
+{
+  Real *random, *rows;
+  double *r, *o;
+  Real v;
+  unsigned int i, j, n, nfree;
+  nfree = optimize->nfree;
+  random = optimize->random_data;
+  rows = optimize->batch_random;
+  r = optimize->batch_data;
+  o = r + OPTIMIZE_BATCH * (nfree + optimize->size);
+  for (; first < last; first += n)
+    {
+
+      // freedom degrees of the batch
+      n = (last - first > OPTIMIZE_BATCH) ? OPTIMIZE_BATCH : last - first;
+      optimize_generate_batch (optimize, first, n);
+      for (i = 0; i < n; ++i)
+        for (j = 0; j < nfree; ++j)
+          r[j * OPTIMIZE_BATCH + i] = (double) rows[i * nfree + j];
+
+      // double precision objective function values of the batch
+      optimize->batch (optimize);
+
+      // full precision confirmation of the simulations near to the
+      // optimal value
+      for (i = 0; i < n; ++i)
+        if (optimize_screen (o[i], o2))
+          {
+            memcpy (random, rows + i * nfree, nfree * sizeof (Real));
+            optimize->simulation = first + i;
+            v = optimize_evaluate (optimize, optimize,
+                                   optimize_cutoff (o2, *i2, first + i));
+            if (optimize_lower (v, first + i, o2, *i2))
+              {
+                o2 = v;
+                *i2 = first + i;
+                memcpy (vo, random, nfree * sizeof (Real));
+              }
+          }
+    }
+  return o2;
+}
+
+/**
+ * Function to get the cut-off of the evaluations on the cross-entropy sampling,
+ * just over the objective function value of the worst elite simulation of the
+ * thread, so the simulations with equal value are evaluated exactly, and not
+ * lower than the cut-off of the optimal values.
+ *
+ * \return cut-off.
+ */
+static inline Real
+optimize_elite_cutoff (Optimize * optimize,     ///< Optimize struct.
+                       Real cutoff)
+                       ///< cut-off of the optimal values.
+{
+  if (optimize->elite_size < optimize->nelite)
+    return INFINITY;
+  return fmaxr (nextafterr (optimize->elite[0], INFINITY), cutoff);
+}
+
+/**
+ * Function to place a simulation on the root of the max-heap of elite
+ * simulations of the thread, moving down the simulations with higher keys.
+ */
+static void
+optimize_elite_sift (Optimize * optimize,       ///< Optimize struct.
+                     unsigned int n,    ///< number of simulations of the heap.
+                     Real o,    ///< objective function value.
+                     unsigned long long int ns, ///< simulation number.
+                     const Real *x)     ///< array of freedom degree values.
+{
+  Real *elite;
+  unsigned long long int *simulation;
+  unsigned int i, j, w;
+  elite = optimize->elite;
+  simulation = optimize->elite_simulation;
+  w = optimize->nfree + 1;
+  for (i = 0; (j = 2 * i + 1) < n; i = j)
+    {
+      if (j + 1 < n
+          && optimize_lower (elite[j * w], simulation[j],
+                             elite[(j + 1) * w], simulation[j + 1]))
+        ++j;
+      if (!optimize_lower (o, ns, elite[j * w], simulation[j]))
+        break;
+      memcpy (elite + i * w, elite + j * w, w * sizeof (Real));
+      simulation[i] = simulation[j];
+    }
+  elite[i * w] = o;
+  memcpy (elite + i * w + 1, x, (w - 1) * sizeof (Real));
+  simulation[i] = ns;
+}
+
+/**
+ * Function to insert a simulation on the max-heap of elite simulations of the
+ * thread, replacing the worst one if the heap is full.
+ */
+static void
+optimize_elite_insert (Optimize * optimize,     ///< Optimize struct.
+                       Real o,  ///< objective function value.
+                       unsigned long long int ns,       ///< simulation number.
+                       const Real *x)   ///< array of freedom degree values.
+{
+  Real *elite;
+  unsigned long long int *simulation;
+  unsigned int i, j, w;
+  if (!(o < INFINITY))
+    return;
+  if (optimize->elite_size == optimize->nelite)
+    {
+      if (optimize_lower (o, ns, optimize->elite[0],
+                          optimize->elite_simulation[0]))
+        optimize_elite_sift (optimize, optimize->nelite, o, ns, x);
+      return;
+    }
+
+  // sift up from a new leaf
+  elite = optimize->elite;
+  simulation = optimize->elite_simulation;
+  w = optimize->nfree + 1;
+  for (i = optimize->elite_size++; i; i = j)
+    {
+      j = (i - 1) / 2;
+      if (!optimize_lower (elite[j * w], simulation[j], o, ns))
+        break;
+      memcpy (elite + i * w, elite + j * w, w * sizeof (Real));
+      simulation[i] = simulation[j];
+    }
+  elite[i * w] = o;
+  memcpy (elite + i * w + 1, x, (w - 1) * sizeof (Real));
+  simulation[i] = ns;
+}
+
+/**
+ * Function to update the optimal values of the simulations of a thread range
+ * with the optimal values of a chunk of the range, so the optimal values of
+ * every range do not depend on the threads sampling its chunks.
+ */
+static inline void
+optimize_range_update (Optimize * optimize,     ///< Optimize struct.
+                       unsigned int range,      ///< range number.
+                       Real o,  ///< optimal objective function value.
+                       unsigned long long int ns,
+                       ///< simulation number of the optimal values.
+                       Real *vo)
+                       ///< array of optimal freedom degree values.
+{
+  Optimize *owner;
+  unsigned int nfree;
+  owner = (Optimize *) pool_data (range);
+  nfree = optimize->nfree;
+  g_mutex_lock (mutex);
+  if (optimize_lower (o, ns, owner->range_optimal, owner->range_simulation))
+    {
+      owner->range_optimal = o;
+      owner->range_simulation = ns;
+      memcpy (owner->work + 3 * nfree, vo, nfree * sizeof (Real));
+    }
+  g_mutex_unlock (mutex);
+}
+
+/**
+ * Function to perform every optimization step. Every chunk of simulations is
+ * sampled from the optimal values of the previous iterations and its optimal
+ * values update the ones of the thread range of the chunk. Then every thread
+ * climbs around the optimal values of its range, as on a static distribution
+ * of the simulations between the threads.
+ */
+void
+optimize_step (Optimize * optimize)     ///< Optimize struct.
+{
+  Real *vo, *vo2, *random;
+  Real o, o2, o3;
+  unsigned long long int ii, i2, i3, nrandom;
+  unsigned int nfree, range;
+
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_step: start\n");
+#endif
+
+  // save optimal values
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_step: save optimal values\n");
+#endif
+  nfree = optimize->nfree;
+  vo = optimize->work;
+  vo2 = vo + nfree;
+  o2 = optimize_best_read (optimize, vo, &i2);
+
+  // optimization algorithm sampling
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_step: optimization algorithm sampling\n");
+  fprintf (stderr, "optimize_step: nsimulations=%Lu\n", optimize->nsimulations);
+#endif
+  random = optimize->random_data;
+  while (pool_range_next (optimize->thread, &ii, &nrandom, &range))
+    {
+      o3 = o2;
+      i3 = i2;
+      if (optimize->nelite)
+        for (; ii < nrandom; ++ii)
+          {
+
+            // cross-entropy sampling keeping the elite simulations
+            optimize_generate_freedom (optimize, ii, nrandom);
+            o = optimize_evaluate (optimize, optimize, file_variables ? INFINITY
+                                   : optimize_elite_cutoff
+                                   (optimize, optimize_cutoff (o3, i3, ii)));
+            if (optimize_lower (o, ii, o3, i3))
+              {
+                o3 = o;
+                i3 = ii;
+                memcpy (vo2, random, nfree * sizeof (Real));
+              }
+            optimize_elite_insert (optimize, o, ii, random);
+            if (file_variables)
+              {
+                g_mutex_lock (mutex);
+                print_variables (random, nfree, file_variables);
+                fprintf (file_variables, REAL_E "\n", real_e (o));
+                g_mutex_unlock (mutex);
+              }
+          }
+      else if (optimize->batch && !file_variables)
+        o3 = optimize_sample_batch (optimize, ii, nrandom, o3, &i3, vo2);
+      else if (optimize->sample && !file_variables)
+        o3 = optimize->sample (optimize, optimize, ii, nrandom, o3, &i3, vo2);
+      else
+        for (; ii < nrandom; ++ii)
+          {
+
+            // random freedom degrees
+#if DEBUG_OPTIMIZE
+            fprintf (stderr, "optimize_step: random freedom degrees\n");
+            fprintf (stderr, "optimize_step: simulation=%Lu\n", ii);
+#endif
+            optimize_generate_freedom (optimize, ii, nrandom);
+
+            // method coefficients
+#if DEBUG_OPTIMIZE
+            fprintf (stderr, "optimize_step: method coefficients\n");
+#endif
+            o = optimize_evaluate (optimize, optimize, file_variables
+                                   ? INFINITY : optimize_cutoff (o3, i3, ii));
+            if (optimize_lower (o, ii, o3, i3))
+              {
+                o3 = o;
+                i3 = ii;
+                memcpy (vo2, random, nfree * sizeof (Real));
+              }
+            if (file_variables)
+              {
+                g_mutex_lock (mutex);
+                print_variables (random, nfree, file_variables);
+                fprintf (file_variables, REAL_E "\n", real_e (o));
+                g_mutex_unlock (mutex);
+              }
+          }
+
+      // update the optimal values of the range, or the optimal values on
+      // dynamic mode
+      if (!optimize_lower (o3, i3, o2, i2))
+        continue;
+      if (dynamic)
+        optimize_best_update (optimize, o3, i3, vo2);
+      else
+        optimize_range_update (optimize, range, o3, i3, vo2);
+    }
+
+  // hill climbing algorithm performed after selecting the optimal values of
+  // all the nodes on dynamic mode
+  if (dynamic)
+    {
+#if DEBUG_OPTIMIZE
+      fprintf (stderr, "optimize_step: end\n");
+#endif
+      return;
+    }
+
+  // wait for the optimal values of all the ranges and climb around the optimal
+  // values of the range of the thread
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_step: hill climbing algorithm\n");
+#endif
+  pool_barrier (optimize->thread);
+  if (optimize_lower (optimize->range_optimal, optimize->range_simulation,
+                      o2, i2))
+    {
+      o2 = optimize->range_optimal;
+      i2 = optimize->range_simulation;
+      memcpy (vo, optimize->work + 3 * nfree, nfree * sizeof (Real));
+    }
+  o2 = optimize_climb (optimize, vo, vo2, o2, &i2);
 
   // update optimal values
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_step: update optimal values\n");
 #endif
-  if (o2 < *optimize->optimal)
+  optimize_best_update (optimize, o2, i2, vo2);
+
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_step: end\n");
+#endif
+}
+
+#if HAVE_MPI
+
+/**
+ * Function to perform the hill climbing of an optimization step on dynamic
+ * mode. The first thread climbs around the optimal values of all the nodes
+ * helped by the other threads, waiting on the barrier of the pool.
+ */
+void
+optimize_climb_step (Optimize * optimize)       ///< Optimize struct.
+{
+  Real *vo, *vo2;
+  Real o2;
+  unsigned long long int i2;
+  unsigned int nfree;
+  if (optimize->thread)
+    return;
+  nfree = optimize->nfree;
+  vo = optimize->work;
+  vo2 = vo + nfree;
+  o2 = optimize_best_read (optimize, vo, &i2);
+  o2 = optimize_climb (optimize, vo, vo2, o2, &i2);
+  optimize_best_update (optimize, o2, i2, vo2);
+}
+
+#endif
+
+/**
+ * Function to get the next chunk of simulations to process by a thread on the
+ * asynchronous optimization iterations. The search intervals of the thread are
+ * updated if a new version of the shared intervals has been published. A chunk
+ * never crosses the end of an iteration.
+ *
+ * \return 1 on success, 0 if all the simulations have been distributed.
+ */
+int
+optimize_asynchronous_next (Optimize * optimize,        ///< Optimize struct.
+                            unsigned long long int *first,
+                            ///< first simulation of the chunk.
+                            unsigned long long int *last)
+                            ///< end of the chunk of simulations.
+{
+  OptimizeAsynchronous *shared;
+  unsigned long long int i, j, n;
+  shared = optimize_asynchronous;
+
+  // update the search intervals
+  if (__atomic_load_n (&shared->version, __ATOMIC_ACQUIRE) != optimize->version)
     {
       g_mutex_lock (mutex);
-      *optimize->optimal = o2;
-      memcpy (optimize->value_optimal, vo2, nfree * sizeof (long double));
+      memcpy (optimize->minimum, shared->minimum,
+              optimize->nfree * sizeof (Real));
+      memcpy (optimize->interval, shared->interval,
+              optimize->nfree * sizeof (Real));
+      optimize->version = shared->version;
       g_mutex_unlock (mutex);
+      optimize_walk_start (optimize);
     }
 
+  // get a chunk of simulations
+  n = optimize->nsimulations;
+  i = __atomic_load_n (&shared->next, __ATOMIC_RELAXED);
+  do
+    {
+      if (i >= shared->last)
+        return 0;
+      j = (i / n + 1) * n;
+      if (j - i > shared->chunk)
+        j = i + shared->chunk;
+    }
+  while (!__atomic_compare_exchange_n (&shared->next, &i, j, 1,
+                                       __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+  optimize->iteration = i / n;
+  *first = i % n;
+  *last = *first + j - i;
+  return 1;
+}
+
+/**
+ * Function to report the simulations processed by a thread on the asynchronous
+ * optimization iterations. The thread completing the simulations of an
+ * iteration performs the hill climbing, reduces the shared search intervals
+ * and publishes a new version of them while the other threads continue
+ * sampling.
+ */
+void
+optimize_asynchronous_report (Optimize * optimize,      ///< Optimize struct.
+                              unsigned long long int n,
+                              ///< number of processed simulations.
+                              OptimizeStep climb)
+                              ///< hill climbing function.
+{
+  OptimizeAsynchronous *shared;
+  Real *vo;
+  Real o;
+  unsigned long long int i, nsimulations;
+  unsigned int nfree;
+  shared = optimize_asynchronous;
+  nsimulations = optimize->nsimulations;
+  i = __atomic_add_fetch (&shared->reported, n, __ATOMIC_ACQ_REL);
+  if (i / nsimulations == (i - n) / nsimulations)
+    return;
+  climb (optimize);
+  nfree = optimize->nfree;
+  vo = optimize->work;
+  o = optimize_best_read (optimize, vo, NULL);
+  g_mutex_lock (mutex);
+  memcpy (optimize->minimum, shared->minimum, nfree * sizeof (Real));
+  memcpy (optimize->interval, shared->interval, nfree * sizeof (Real));
+  optimize_converge (optimize, vo);
+  memcpy (shared->minimum, optimize->minimum, nfree * sizeof (Real));
+  memcpy (shared->interval, optimize->interval, nfree * sizeof (Real));
+  optimize->version = shared->version + 1;
+  __atomic_store_n (&shared->version, optimize->version, __ATOMIC_RELEASE);
+  printf ("Iteration %u Optimal " REAL_E "\n", optimize->version, real_e (o));
+  g_mutex_unlock (mutex);
+}
+
+/**
+ * Function to perform the asynchronous optimization iterations. The threads of
+ * the pool sample continuously without waiting to the end of every iteration.
+ */
+void
+optimize_asynchronous_run (Optimize * optimize,
+                           ///< array of Optimize structs of every thread.
+                           OptimizeStep step,
+                           ///< function to perform the asynchronous sampling.
+                           size_t size)
+                           ///< size of the data of every thread.
+{
+  OptimizeAsynchronous *shared;
+  unsigned int i, nfree;
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_step: end\n");
+  fprintf (stderr, "optimize_asynchronous_run: start\n");
+#endif
+  shared = optimize_asynchronous;
+  nfree = optimize->nfree;
+  shared->minimum
+    = (Real *) g_slice_alloc (nfree * sizeof (Real));
+  shared->interval
+    = (Real *) g_slice_alloc (nfree * sizeof (Real));
+  memcpy (shared->minimum, optimize->minimum, nfree * sizeof (Real));
+  memcpy (shared->interval, optimize->interval, nfree * sizeof (Real));
+  shared->next = shared->reported = 0L;
+  shared->last = optimize->nsimulations * optimize->niterations;
+  shared->chunk = optimize->nsimulations / (nthreads * POOL_CHUNKS);
+  if (!shared->chunk)
+    shared->chunk = 1L;
+  shared->version = 0;
+  for (i = 0; i < nthreads; ++i)
+    {
+      ((Optimize *) ((char *) optimize + i * size))->version = 0;
+      optimize_walk_start ((Optimize *) ((char *) optimize + i * size));
+    }
+  pool_run ((PoolFunction) (void (*)(void)) step, optimize, size);
+  memcpy (optimize->minimum, shared->minimum, nfree * sizeof (Real));
+  memcpy (optimize->interval, shared->interval, nfree * sizeof (Real));
+  g_slice_free1 (nfree * sizeof (Real), shared->interval);
+  g_slice_free1 (nfree * sizeof (Real), shared->minimum);
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_asynchronous_run: end\n");
+#endif
+}
+
+/**
+ * Function to perform the hill climbing around the shared optimal point on the
+ * asynchronous optimization iterations.
+ */
+static void
+optimize_climb_asynchronous (Optimize * optimize)       ///< Optimize struct.
+{
+  Real *vo, *vo2;
+  Real o2;
+  unsigned long long int i2;
+  unsigned int nfree;
+  nfree = optimize->nfree;
+  vo = optimize->work;
+  vo2 = vo + nfree;
+  o2 = optimize_best_read (optimize, vo, &i2);
+  o2 = optimize_climb (optimize, vo, vo2, o2, &i2);
+  optimize_best_update (optimize, o2, i2, vo2);
+}
+
+/**
+ * Function to perform the sampling of the asynchronous optimization
+ * iterations.
+ */
+static void
+optimize_step_asynchronous (Optimize * optimize)        ///< Optimize struct.
+{
+  Real *random, *vo;
+  Real o;
+  unsigned long long int ii, i2, nrandom, n;
+  unsigned int nfree;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_step_asynchronous: start\n");
+#endif
+  nfree = optimize->nfree;
+  random = optimize->random_data;
+  while (optimize_asynchronous_next (optimize, &ii, &nrandom))
+    {
+      n = nrandom - ii;
+      if (optimize->batch && !file_variables)
+        {
+          vo = optimize->work;
+          o = optimize_best_read (optimize, NULL, &i2);
+          o = optimize_sample_batch (optimize, ii, nrandom, o, &i2, vo);
+          optimize_best_update (optimize, o, i2, vo);
+          ii = nrandom;
+        }
+      else if (optimize->sample && !file_variables)
+        {
+          vo = optimize->work;
+          o = optimize_best_read (optimize, NULL, &i2);
+          o = optimize->sample (optimize, optimize, ii, nrandom, o, &i2, vo);
+          optimize_best_update (optimize, o, i2, vo);
+          ii = nrandom;
+        }
+      for (; ii < nrandom; ++ii)
+        {
+          optimize_generate_freedom (optimize, ii, nrandom);
+          o = optimize_best_read (optimize, NULL, &i2);
+          o = optimize_evaluate (optimize, optimize, file_variables ? INFINITY
+                                 : optimize_cutoff (o, i2, ii));
+          optimize_best_update (optimize, o, ii, random);
+          if (file_variables)
+            {
+              g_mutex_lock (mutex);
+              print_variables (random, nfree, file_variables);
+              fprintf (file_variables, REAL_E "\n", real_e (o));
+              g_mutex_unlock (mutex);
+            }
+        }
+      optimize_asynchronous_report (optimize, n, optimize_climb_asynchronous);
+    }
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_step_asynchronous: end\n");
 #endif
 }
 
 /**
- * Function to init required variables on an Optimize struct data.
+ * Function to init required variables on an Optimize struct data. The arrays
+ * are allocated by the calling thread, so the thread field has to be set before
+ * calling from the thread owning the struct. On allocation error the
+ * random_data field is NULL.
  */
 void
-optimize_init (Optimize * optimize,     ///< Optimize struct.
-               gsl_rng * rng,   ///< GSL pseudo-random number generator struct.
-               unsigned int thread)     ///< thread number.
+optimize_init (Optimize * optimize)     ///< Optimize struct.
 {
+  Real *data;
+  size_t size, size2, size3, size4;
+  unsigned int i, nfree;
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_init: start\n");
 #endif
@@ -245,20 +900,83 @@ optimize_init (Optimize * optimize,     ///< Optimize struct.
   fprintf (stderr, "optimize_init: nsimulations=%Lu nfree=%u size=%u\n",
            optimize->nsimulations, optimize->nfree, optimize->size);
 #endif
-  optimize->random_data
-    = (long double *) g_slice_alloc (optimize->nfree * sizeof (long double));
-  optimize->coefficient
-    = (long double *) g_slice_alloc (optimize->size * sizeof (long double));
-  optimize->minimum
-    = (long double *) g_slice_alloc (optimize->nfree * sizeof (long double));
-  optimize->interval
-    = (long double *) g_slice_alloc (optimize->nfree * sizeof (long double));
+
+  // one block aligned to the cache lines for all the arrays of the thread:
+  // random_data, minimum, interval, work (4 * nfree), coefficient, walk (with
+  // a feasible polytope) and mean, deviation and elite (on the cross-entropy
+  // sampling), followed by the uniform array (with a batch function, followed
+  // by the batch_random and batch_data arrays) and by the elite_simulation
+  // array
+  nfree = optimize->nfree;
+  size = 7 * nfree + optimize->size;
+  if (optimize->polytope)
+    size += 3 * nfree + 2 * optimize->npolytope;
+  size += 2 * nfree + optimize->nelite * (nfree + 1);
+  size *= sizeof (Real);
+  size = (size + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+  size3 = OPTIMIZE_BATCH * nfree * sizeof (double);
+  size3 = (size3 + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+  size2 = 0;
+  if (optimize->batch)
+    {
+      size2 = OPTIMIZE_BATCH * nfree * sizeof (Real);
+      size2 = (size2 + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+      size2 += OPTIMIZE_BATCH * (nfree + optimize->size + 1) * sizeof (double);
+      size2 = (size2 + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+    }
+  size4 = optimize->nelite * sizeof (unsigned long long int);
+  size4 = (size4 + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+  data = (Real *) aligned_alloc (CACHE_LINE_SIZE,
+                                 size + size3 + size2 + size4);
+  optimize->random_data = data;
+  if (!data)
+    {
+#if DEBUG_OPTIMIZE
+      fprintf (stderr, "optimize_init: end\n");
+#endif
+      return;
+    }
+  optimize->minimum = data + nfree;
+  optimize->interval = data + 2 * nfree;
+  optimize->work = data + 3 * nfree;
+  optimize->coefficient = data + 7 * nfree;
+  optimize->walk = optimize->polytope ? data + 7 * nfree + optimize->size
+    : NULL;
+  optimize->mean = data + 7 * nfree + optimize->size
+    + (optimize->polytope ? 3 * nfree + 2 * optimize->npolytope : 0);
+  optimize->deviation = optimize->mean + nfree;
+  optimize->elite = optimize->deviation + nfree;
+  optimize->elite_simulation
+    = (unsigned long long int *) ((char *) data + size + size3 + size2);
+  optimize->elite_size = 0;
+  for (i = 0; i < nfree; ++i)
+    {
+      optimize->mean[i] = optimize->minimum0[i]
+        + REAL (0.5) * optimize->interval0[i];
+      optimize->deviation[i] = optimize->interval0[i] / sqrtr (REAL (12.));
+    }
   memcpy (optimize->minimum, optimize->minimum0,
-          optimize->nfree * sizeof (long double));
+          nfree * sizeof (Real));
   memcpy (optimize->interval, optimize->interval0,
-          optimize->nfree * sizeof (long double));
-  optimize->rng = rng;
-  optimize->thread = thread;
+          nfree * sizeof (Real));
+  optimize->uniform = (double *) ((char *) data + size);
+  optimize->batch_random = NULL;
+  optimize->batch_data = NULL;
+  optimize->iteration = 0;
+  optimize->nuniform = 0;
+  optimize->walking = 0;
+  optimize->cutoff = INFINITY;
+  memset (optimize->rejected, 0,
+          OPTIMIZE_REJECT_N * sizeof (unsigned long long int));
+  if (optimize->batch)
+    {
+      size += size3;
+      memset ((char *) data + size, 0, size2);
+      optimize->batch_random = (Real *) ((char *) data + size);
+      size2 = OPTIMIZE_BATCH * nfree * sizeof (Real);
+      size2 = (size2 + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+      optimize->batch_data = (double *) ((char *) data + size + size2);
+    }
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_init: end\n");
 #endif
@@ -270,37 +988,472 @@ optimize_init (Optimize * optimize,     ///< Optimize struct.
 void
 optimize_delete (Optimize * optimize)   ///< Optimize struct.
 {
-  g_slice_free1 (optimize->nfree * sizeof (long double), optimize->interval);
-  g_slice_free1 (optimize->nfree * sizeof (long double), optimize->minimum);
-  g_slice_free1 (optimize->size * sizeof (long double), optimize->coefficient);
-  g_slice_free1 (optimize->nfree * sizeof (long double), optimize->random_data);
+  free (optimize->random_data);
 }
 
 /**
- * Function to do the optimization bucle.
+ * Function to start the hit-and-run chains of an iteration on the feasible
+ * region. The starting point is the optimal point if it is feasible, else a
+ * feasible point is searched from it by cyclic over-relaxed projections on the
+ * violated constraints and on the search intervals. The chains are not used if
+ * no feasible point is found.
  */
 void
-optimize_bucle (Optimize * optimize)    ///< Optimize struct.
+optimize_walk_start (Optimize * optimize)       ///< Optimize struct.
+{
+  const Real *g;
+  Real *x, *minimum, *interval;
+  Real k, s;
+  unsigned int i, j, l, nfree;
+  if (!optimize->polytope)
+    return;
+  nfree = optimize->nfree;
+  minimum = optimize->minimum;
+  interval = optimize->interval;
+  x = optimize->walk + nfree;
+  optimize_best_read (optimize, x, NULL);
+  optimize->walk_next = ULLONG_MAX;
+  for (l = 0; l < OPTIMIZE_WALK_PROJECTIONS; ++l)
+    {
+      optimize->walking = 1;
+      for (j = 0; j < nfree; ++j)
+        x[j] = fminr (fmaxr (x[j], minimum[j]), minimum[j] + interval[j]);
+      for (i = 0; i < optimize->npolytope; ++i)
+        {
+          g = optimize->polytope + i * (nfree + 1);
+          for (j = 0, k = g[0], s = REAL (0.); j < nfree; ++j)
+            {
+              k += g[j + 1] * x[j];
+              s += g[j + 1] * g[j + 1];
+            }
+          if (!(k >= -REAL_EPSILON) && s > REAL (0.))
+            {
+              optimize->walking = 0;
+              for (j = 0, k *= OPTIMIZE_WALK_RELAXATION / s; j < nfree; ++j)
+                x[j] -= k * g[j + 1];
+            }
+        }
+      if (optimize->walking)
+        break;
+    }
+  for (j = 0; j < nfree; ++j)
+    if (!(x[j] >= minimum[j] && x[j] <= minimum[j] + interval[j]))
+      optimize->walking = 0;
+}
+
+/**
+ * Function to perform a step of the hit-and-run chain: the point moves to a
+ * uniformly distributed position on the chord of a random direction on the
+ * feasible region intersected with the search intervals. The direction
+ * components are scaled by the search intervals, so the fixed freedom degrees
+ * do not move.
+ */
+static inline void
+optimize_walk_step (Optimize * optimize,        ///< Optimize struct.
+                    unsigned long long int simulation,
+                    ///< counter of the pseudo-random numbers.
+                    unsigned long long int seed,
+                    ///< seed of the pseudo-random numbers.
+                    double *u)
+                    ///< array of nfree + 1 pseudo-random numbers.
 {
-  GThread *thread[nthreads];
+  const Real *g;
+  Real *x, *d, *c, *e, *minimum, *interval;
+  Real k, t, t1, t2;
+  unsigned int i, j, nfree;
+  nfree = optimize->nfree;
+  minimum = optimize->minimum;
+  interval = optimize->interval;
+  x = optimize->walk;
+  d = x + 2 * nfree;
+  c = x + 3 * nfree;
+  e = c + optimize->npolytope;
+  random_uniform (u, simulation, 1, nfree + 1, optimize->iteration, seed);
+
+  // chord on the search intervals
+  t1 = -INFINITY;
+  t2 = INFINITY;
+  for (j = 0; j < nfree; ++j)
+    {
+      d[j] = ((Real) u[j] - REAL (0.5)) * interval[j];
+      if (d[j] > REAL (0.))
+        {
+          t1 = fmaxr (t1, (minimum[j] - x[j]) / d[j]);
+          t2 = fminr (t2, (minimum[j] + interval[j] - x[j]) / d[j]);
+        }
+      else if (d[j] < REAL (0.))
+        {
+          t1 = fmaxr (t1, (minimum[j] + interval[j] - x[j]) / d[j]);
+          t2 = fminr (t2, (minimum[j] - x[j]) / d[j]);
+        }
+    }
+
+  // chord on the feasible region
+  for (i = 0; i < optimize->npolytope; ++i)
+    {
+      g = optimize->polytope + i * (nfree + 1) + 1;
+      for (j = 0, k = REAL (0.); j < nfree; ++j)
+        k += g[j] * d[j];
+      e[i] = k;
+      if (k > REAL (0.))
+        t1 = fmaxr (t1, -fmaxr (c[i], REAL (0.)) / k);
+      else if (k < REAL (0.))
+        t2 = fminr (t2, -fmaxr (c[i], REAL (0.)) / k);
+    }
+
+  // new point
+  if (!(t1 < t2))
+    return;
+  t = t1 + (t2 - t1) * (Real) u[nfree];
+  for (j = 0; j < nfree; ++j)
+    x[j] += t * d[j];
+  for (i = 0; i < optimize->npolytope; ++i)
+    c[i] += t * e[i];
+}
+
+/**
+ * Function to get the freedom degree values of a simulation by hit-and-run
+ * chains on the feasible region. Every chain starts from the optimal point
+ * and, after a burn-in, gives the points of OPTIMIZE_WALK_BLOCK consecutive
+ * simulations. The pseudo-random numbers depend only on the seed, the
+ * iteration and the simulation number, so the results do not depend on the
+ * distribution of the simulations between the threads and nodes. The chain is
+ * continued on consecutive calls and replayed from its start otherwise.
+ */
+void
+optimize_walk (Optimize * optimize,     ///< Optimize struct.
+               unsigned long long int ns,       ///< simulation number.
+               Real *data)      ///< array of freedom degree values.
+{
+  const Real *g;
+  Real *x, *c;
+  double *u;
+  Real k;
+  unsigned long long int i, first, seed, seed2;
+  unsigned int j, l, nfree;
+  nfree = optimize->nfree;
+  x = optimize->walk;
+  u = (double *) alloca ((nfree + 1) * sizeof (double));
+  seed = random_hash (optimize->seed ^ 0x5851F42D4C957F2Dull);
+  if (optimize->walk_next != ns
+      || optimize->walk_iteration != optimize->iteration
+      || !(ns % OPTIMIZE_WALK_BLOCK))
+    {
+      // start of the chain
+      seed2 = random_hash (seed);
+      c = x + 3 * nfree;
+      memcpy (x, x + nfree, nfree * sizeof (Real));
+      for (l = 0; l < optimize->npolytope; ++l)
+        {
+          g = optimize->polytope + l * (nfree + 1);
+          for (j = 0, k = g[0]; j < nfree; ++j)
+            k += g[j + 1] * x[j];
+          c[l] = k;
+        }
+      first = ns / OPTIMIZE_WALK_BLOCK;
+      for (l = 0; l < OPTIMIZE_WALK_BURN; ++l)
+        optimize_walk_step (optimize, first * OPTIMIZE_WALK_BURN + l, seed2,
+                            u);
+      for (i = first * OPTIMIZE_WALK_BLOCK; i < ns; ++i)
+        optimize_walk_step (optimize, i, seed, u);
+      optimize->walk_iteration = optimize->iteration;
+    }
+  optimize_walk_step (optimize, ns, seed, u);
+  optimize->walk_next = ns + 1;
+  memcpy (data, x, nfree * sizeof (Real));
+}
+
+/**
+ * Function to start an iteration on the Optimize structs of all the threads,
+ * setting the iteration number, copying the search intervals converged by the
+ * first thread, starting the hit-and-run chains and emptying the optimal values
+ * of the thread ranges. The simulation number of the optimal values is reset,
+ * so they win the ties with the simulations of the iteration as on the serial
+ * sampling. It has to be called when the worker threads are stopped.
+ */
+void
+optimize_iteration (Optimize * optimize,
+                    ///< array of Optimize structs of every thread.
+                    size_t size,        ///< size of the data of every thread.
+                    unsigned int iteration)     ///< iteration number.
+{
+  Optimize *o;
+  unsigned int i, nfree;
+  nfree = optimize->nfree;
+  optimize->iteration = iteration;
+  *optimize->simulation_optimal = 0L;
+  optimize->range_optimal = INFINITY;
+  optimize->range_simulation = ~0L;
+  optimize_walk_start (optimize);
+  for (i = 1; i < nthreads; ++i)
+    {
+      o = (Optimize *) ((char *) optimize + i * size);
+      o->iteration = iteration;
+      o->range_optimal = INFINITY;
+      o->range_simulation = ~0L;
+      memcpy (o->minimum, optimize->minimum, nfree * sizeof (Real));
+      memcpy (o->interval, optimize->interval, nfree * sizeof (Real));
+      optimize_walk_start (o);
+    }
+}
+
+/**
+ * Function to print the numbers of simulations rejected by every reason before
+ * finishing its evaluation, summing the counters of all the threads and nodes.
+ */
+void
+optimize_print_rejected (Optimize * optimize,
+                         ///< array of Optimize structs of every thread.
+                         size_t size,   ///< size of the data of every thread.
+                         const char *label)     ///< label of the coefficients.
+{
+  unsigned long long int rejected[OPTIMIZE_REJECT_N];
 #if HAVE_MPI
-  long double *vo;
-  MPI_Status status;
+  unsigned long long int local[OPTIMIZE_REJECT_N];
 #endif
-  unsigned int i, j, nfree;
+  Optimize *o;
+  unsigned int i, j;
+  memset (rejected, 0, OPTIMIZE_REJECT_N * sizeof (unsigned long long int));
+  for (i = 0; i < nthreads; ++i)
+    {
+      o = (Optimize *) ((char *) optimize + i * size);
+      for (j = 0; j < OPTIMIZE_REJECT_N; ++j)
+        rejected[j] += o->rejected[j];
+    }
+#if HAVE_MPI
+  memcpy (local, rejected,
+          OPTIMIZE_REJECT_N * sizeof (unsigned long long int));
+  MPI_Reduce (local, rejected, OPTIMIZE_REJECT_N, MPI_UNSIGNED_LONG_LONG,
+              MPI_SUM, 0, MPI_COMM_WORLD);
+  if (rank)
+    return;
+#endif
+  printf ("Rejected %s simulations: sign=%llu bound=%llu\n", label,
+          rejected[OPTIMIZE_REJECT_SIGN], rejected[OPTIMIZE_REJECT_BOUND]);
+}
+
+#if HAVE_MPI
+
+/**
+ * Function to select the optimal values of all the nodes. Every node gathers
+ * the optimal objective function values and simulation numbers of all the
+ * nodes and selects the lowest (value, simulation number) key (the lowest rank
+ * on equal keys), then the selected node broadcasts its optimal values to the
+ * other nodes.
+ *
+ * \return rank of the node with the optimal values.
+ */
+int
+optimize_nodes_optimal (Real *optimal,
+                        ///< pointer to the optimal objective function value.
+                        unsigned long long int *simulation,
+                        ///< pointer to the simulation number of the optimal
+                        ///< values.
+                        Real *value_optimal,
+                        ///< array of optimal values.
+                        unsigned int n) ///< number of optimal values.
+{
+  struct
+  {
+    Real value;
+    unsigned long long int simulation;
+  } local, *global;
+  int i, r;
+  local.value = *optimal;
+  local.simulation = *simulation;
+
+  // MPI has not a __float128 type, the keys are gathered as bytes
+  global = alloca (nnodes * sizeof (local));
+  MPI_Allgather (&local, sizeof (local), MPI_BYTE, global, sizeof (local),
+                 MPI_BYTE, MPI_COMM_WORLD);
+  for (i = 1, r = 0; i < nnodes; ++i)
+    if (optimize_lower (global[i].value, global[i].simulation,
+                        global[r].value, global[r].simulation))
+      r = i;
+  MPI_Bcast (value_optimal, n * sizeof (Real), MPI_BYTE, r, MPI_COMM_WORLD);
+  *optimal = global[r].value;
+  *simulation = global[r].simulation;
+  return r;
+}
+
+/**
+ * Function to get a chunk of simulations from the counter of the master node.
+ * The MPI calls of the threads are serialized.
+ *
+ * \return 1 on success, 0 if all the simulations have been distributed.
+ */
+static int
+optimize_dynamic_refill (unsigned long long int *first,
+                         ///< first simulation of the chunk.
+                         unsigned long long int *last)
+                         ///< end of the chunk of simulations.
+{
+  OptimizeDynamic *d;
+  unsigned long long int i;
+  d = optimize_dynamic;
+  if (__atomic_load_n (&d->done, __ATOMIC_RELAXED))
+    return 0;
+  g_mutex_lock (d->mutex);
+  MPI_Win_lock (MPI_LOCK_SHARED, 0, 0, d->window);
+  MPI_Fetch_and_op (&d->chunk, &i, MPI_UNSIGNED_LONG_LONG, 0, 0, MPI_SUM,
+                    d->window);
+  MPI_Win_unlock (0, d->window);
+  g_mutex_unlock (d->mutex);
+  if (i >= d->last)
+    {
+      __atomic_store_n (&d->done, 1, __ATOMIC_RELAXED);
+      return 0;
+    }
+  *first = i;
+  *last = (d->last - i > d->chunk) ? i + d->chunk : d->last;
+  return 1;
+}
+
+/**
+ * Function to distribute dynamically the simulations of an iteration between
+ * the nodes. All the nodes get chunks of simulations from a shared counter of
+ * the master node, so the faster nodes perform more simulations. It has to be
+ * called by all the nodes when the worker threads are stopped.
+ */
+void
+optimize_dynamic_range (unsigned long long int n)
+                        ///< number of simulations.
+{
+  OptimizeDynamic *d;
+  d = optimize_dynamic;
+  d->last = n;
+  d->chunk = n / (nnodes * nthreads * POOL_CHUNKS);
+  if (!d->chunk)
+    d->chunk = 1L;
+  d->done = 0;
+  if (!rank)
+    {
+      MPI_Win_lock (MPI_LOCK_EXCLUSIVE, 0, 0, d->window);
+      d->counter = 0L;
+      MPI_Win_unlock (0, d->window);
+    }
+  MPI_Barrier (MPI_COMM_WORLD);
+  pool_range_init (0L, 0L);
+  pool_range_refill (optimize_dynamic_refill);
+}
+
+/**
+ * Function to init the dynamic distribution of the simulations between the
+ * nodes.
+ */
+void
+optimize_dynamic_init (void)
+{
+  g_mutex_init (optimize_dynamic->mutex);
+  MPI_Win_create (&optimize_dynamic->counter,
+                  rank ? 0 : sizeof (unsigned long long int),
+                  sizeof (unsigned long long int), MPI_INFO_NULL,
+                  MPI_COMM_WORLD, &optimize_dynamic->window);
+}
+
+/**
+ * Function to free the dynamic distribution of the simulations between the
+ * nodes.
+ */
+void
+optimize_dynamic_free (void)
+{
+  MPI_Win_free (&optimize_dynamic->window);
+  g_mutex_clear (optimize_dynamic->mutex);
+}
+
+#endif
+
+/**
+ * Function to fit the sampling distribution of the cross-entropy sampling to
+ * the elite simulations of all the threads. The elite simulations are merged
+ * on the first thread and sorted, so the fitting does not depend on the number
+ * of threads. The means and standard deviations are smoothed with the previous
+ * ones and copied to all the threads. It has to be called when the worker
+ * threads are stopped.
+ */
+static void
+optimize_elite_fit (Optimize * optimize,
+                    ///< array of Optimize structs of every thread.
+                    size_t size)        ///< size of the data of every thread.
+{
+  Optimize *o;
+  Real *elite, *mean, *deviation, *x;
+  Real m, s, d;
+  unsigned long long int ns;
+  unsigned int i, j, n, w, nfree;
+  nfree = optimize->nfree;
+  w = nfree + 1;
+  elite = optimize->elite;
+
+  // merge the elite simulations
+  for (i = 1; i < nthreads; ++i)
+    {
+      o = (Optimize *) ((char *) optimize + i * size);
+      for (j = 0; j < o->elite_size; ++j)
+        optimize_elite_insert (optimize, o->elite[j * w],
+                               o->elite_simulation[j], o->elite + j * w + 1);
+      o->elite_size = 0;
+    }
+
+  // sort the elite simulations
+  n = optimize->elite_size;
+  x = (Real *) alloca (w * sizeof (Real));
+  for (i = n; i > 1; --i)
+    {
+      memcpy (x, elite, w * sizeof (Real));
+      ns = optimize->elite_simulation[0];
+      optimize_elite_sift (optimize, i - 1, elite[(i - 1) * w],
+                           optimize->elite_simulation[i - 1],
+                           elite + (i - 1) * w + 1);
+      memcpy (elite + (i - 1) * w, x, w * sizeof (Real));
+      optimize->elite_simulation[i - 1] = ns;
+    }
+
+  // fit the smoothed normal distribution
+  mean = optimize->mean;
+  deviation = optimize->deviation;
+  if (n)
+    for (j = 1; j < w; ++j)
+      {
+        for (i = 0, m = REAL (0.); i < n; ++i)
+          m += elite[i * w + j];
+        m /= n;
+        for (i = 0, s = REAL (0.); i < n; ++i)
+          {
+            d = elite[i * w + j] - m;
+            s += d * d;
+          }
+        s = sqrtr (s / n);
+        mean[j - 1] = OPTIMIZE_ELITE_SMOOTHING * m
+          + (REAL (1.) - OPTIMIZE_ELITE_SMOOTHING) * mean[j - 1];
+        deviation[j - 1] = OPTIMIZE_ELITE_SMOOTHING * s
+          + (REAL (1.) - OPTIMIZE_ELITE_SMOOTHING) * deviation[j - 1];
+      }
+  optimize->elite_size = 0;
+  for (i = 1; i < nthreads; ++i)
+    {
+      o = (Optimize *) ((char *) optimize + i * size);
+      memcpy (o->mean, mean, nfree * sizeof (Real));
+      memcpy (o->deviation, deviation, nfree * sizeof (Real));
+    }
+}
+
+/**
+ * Function to do the optimization bucle.
+ */
+void
+optimize_bucle (Optimize * optimize)    ///< Optimize struct.
+{
+  unsigned int i, nfree;
 
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_bucle: start\n");
   fprintf (stderr, "optimize_bucle: nfree=%u\n", optimize->nfree);
 #endif
 
-  // Allocate local array of optimal values
-#if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_bucle: allocate local array of optimal values\n");
-#endif
   nfree = optimize->nfree;
 #if HAVE_MPI
-  vo = (long double *) alloca ((1 + nfree) * sizeof (long double));
   printf ("Rank=%d NNodes=%d\n", rank, nnodes);
 #endif
 
@@ -309,9 +1462,21 @@ optimize_bucle (Optimize * optimize)    ///< Optimize struct.
   fprintf (stderr, "optimize_bucle: init some parameters\n");
 #endif
   *optimize->optimal = INFINITY;
+  *optimize->simulation_optimal = 0L;
   for (i = 0; i < nfree; ++i)
     optimize->value_optimal[i]
-      = optimize->minimum[i] + 0.5L * optimize->interval[i];
+      = optimize->minimum[i] + REAL (0.5) * optimize->interval[i];
+
+  // Asynchronous iterations
+  if (asynchronous)
+    {
+      optimize_asynchronous_run (optimize, optimize_step_asynchronous,
+                                 sizeof (Optimize));
+#if DEBUG_OPTIMIZE
+      fprintf (stderr, "optimize_bucle: end\n");
+#endif
+      return;
+    }
 
   // Iterate
 #if DEBUG_OPTIMIZE
@@ -319,83 +1484,62 @@ optimize_bucle (Optimize * optimize)    ///< Optimize struct.
 #endif
   for (i = 0; i < optimize->niterations; ++i)
     {
-
-      // Optimization step parallelized for every node by GThreads
-      if (nthreads > 1)
-        {
-          for (j = 0; j < nthreads; ++j)
-            thread[j]
-              = g_thread_new (NULL,
-                              (GThreadFunc) (void (*)(void)) optimize_step,
-                              (void *) (optimize + j));
-          for (j = 0; j < nthreads; ++j)
-            g_thread_join (thread[j]);
-        }
-      else
-        optimize_step (optimize);
+      optimize_iteration (optimize, sizeof (Optimize), i);
 
 #if HAVE_MPI
-      if (rank > 0)
+      // Optimization step dynamically distributed between the nodes, the hill
+      // climbing starts from the optimal values of all the nodes
+      if (dynamic)
         {
-
-          // Secondary nodes send the optimal coefficients to the master node
-          vo[0] = *optimize->optimal;
-          memcpy (vo + 1, optimize->value_optimal,
-                  nfree * sizeof (long double));
-          MPI_Send (vo, 1 + nfree, MPI_LONG_DOUBLE, 0, 1, MPI_COMM_WORLD);
-
-          // Secondary nodes receive the optimal coefficients
-          MPI_Recv (vo, 1 + nfree, MPI_LONG_DOUBLE, 0, 1, MPI_COMM_WORLD,
-                    &status);
-          *optimize->optimal = vo[0];
-          memcpy (optimize->value_optimal, vo + 1,
-                  nfree * sizeof (long double));
+          optimize_dynamic_range (optimize->nsimulations);
+          pool_run ((PoolFunction) (void (*)(void)) optimize_step, optimize,
+                    sizeof (Optimize));
+          optimize_nodes_optimal (optimize->optimal,
+                                  optimize->simulation_optimal,
+                                  optimize->value_optimal, nfree);
+          pool_run ((PoolFunction) (void (*)(void)) optimize_climb_step,
+                    optimize, sizeof (Optimize));
         }
       else
+#endif
         {
-          printf ("rank=%d optimal=%.19Le\n", rank, *optimize->optimal);
+          // Optimization step parallelized for every node by the threads pool
+          pool_range_init (optimize->nsimulations * rank / nnodes,
+                           optimize->nsimulations * (rank + 1) / nnodes);
+          pool_run ((PoolFunction) (void (*)(void)) optimize_step, optimize,
+                    sizeof (Optimize));
+        }
 
-          for (j = 1; j < nnodes; ++j)
-            {
+#if HAVE_MPI
 
-              // Master node receives the optimal coefficients obtained by
-              // secondary nodes
-              MPI_Recv (vo, 1 + nfree, MPI_LONG_DOUBLE, j, 1, MPI_COMM_WORLD,
-                        &status);
-
-              // Master node selects the optimal coefficients
-              if (vo[0] < *optimize->optimal)
-                {
-                  *optimize->optimal = vo[0];
-                  memcpy (optimize->value_optimal, vo + 1,
-                          nfree * sizeof (long double));
-                }
-            }
-
-          // Master node sends the optimal coefficients to secondary nodes
-          vo[0] = *optimize->optimal;
-          memcpy (vo + 1, optimize->value_optimal,
-                  nfree * sizeof (long double));
-          for (j = 1; j < nnodes; ++j)
-            MPI_Send (vo, 1 + nfree, MPI_LONG_DOUBLE, j, 1, MPI_COMM_WORLD);
-        }
+      // Selecting the optimal coefficients of all the nodes
+      if (!rank)
+        printf ("rank=%d optimal=" REAL_E "\n", rank,
+                real_e (*optimize->optimal));
+      optimize_nodes_optimal (optimize->optimal, optimize->simulation_optimal,
+                              optimize->value_optimal, nfree);
 
 #endif
 
       // Print the optimal coefficients
 #if DEBUG_OPTIMIZE
       optimize_print_random (optimize, stderr);
-      fprintf (stderr, "optimal=%.19Le\n", *optimize->optimal);
+      fprintf (stderr, "optimal=" REAL_E "\n", real_e (*optimize->optimal));
 #endif
 
-      // Updating coefficient intervals to converge
-      optimize_converge (optimize);
+      // Updating coefficient intervals to converge or fitting the sampling
+      // distribution to the elite simulations
+      if (optimize->nelite)
+        optimize_elite_fit (optimize, sizeof (Optimize));
+      else
+        optimize_converge (optimize, optimize->value_optimal);
 
       // Iterate
 #if HAVE_MPI
       printf ("Rank %u\n", rank);
 #endif
-      printf ("Iteration %u Optimal %.19Le\n", i + 1, *optimize->optimal);
+      printf ("Iteration %u Optimal " REAL_E "\n", i + 1,
+              real_e (*optimize->optimal));
     }
 
 #if DEBUG_OPTIMIZE
@@ -408,22 +1552,26 @@ optimize_bucle (Optimize * optimize)    ///< Optimize struct.
  */
 void
 optimize_create (Optimize * optimize,   ///< Optimize struct.
-                 long double *optimal,
+                 Real *optimal,
                  ///< pointer to the optimal objective function value.
-                 long double *value_optimal)
+                 Real *value_optimal,
                  ///< array of optimal freedom degree values.
+                 unsigned int *sequence,
+                 ///< pointer to the sequence counter of the optimal values.
+                 unsigned long long int *simulation)
+                 ///< pointer to the simulation number of the optimal values.
 {
-  unsigned long long int nsimulations;
-  unsigned int i, nfree;
+  unsigned int nfree;
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_create: start\n");
 #endif
   optimize->optimal = optimal;
   optimize->value_optimal = value_optimal;
+  optimize->sequence = sequence;
+  optimize->simulation_optimal = simulation;
+  *sequence = 0;
+  *simulation = 0L;
   nfree = optimize->nfree;
-  optimize->nsimulations = nsimulations = optimize->nvariable;
-  for (i = 1; i < nfree; ++i)
-    optimize->nsimulations *= nsimulations;
   optimize->nclimbings *= nfree;
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_create nsimulations=%Lu nclimbings=%u nfree=%u\n",
@@ -441,15 +1589,43 @@ int
 optimize_read (Optimize * optimize,     ///< Optimize struct.
                xmlNode * node)  ///< XML node.
 {
+  unsigned long long int nsimulations;
+  unsigned int i;
   int code;
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_read: start\n");
 #endif
-  optimize->nvariable = xml_node_get_uint (node, XML_NSIMULATIONS, &code);
-  if (code || !optimize->nvariable)
+  if (xmlHasProp (node, XML_NSAMPLES))
     {
-      error_message = g_strdup (_("Bad simulations number"));
-      goto exit_on_error;
+      // sample budget mode: total simulations number per iteration
+      optimize->nvariable = 0;
+      optimize->nsimulations
+        = xml_node_get_ulong (node, XML_NSAMPLES, &code);
+      if (code || !optimize->nsimulations)
+        {
+          error_message = g_strdup (_("Bad samples number"));
+          goto exit_on_error;
+        }
+    }
+  else
+    {
+      optimize->nvariable = xml_node_get_uint (node, XML_NSIMULATIONS, &code);
+      if (code || !optimize->nvariable)
+        {
+          error_message = g_strdup (_("Bad simulations number"));
+          goto exit_on_error;
+        }
+      nsimulations = optimize->nvariable;
+      for (i = 1; i < optimize->nfree; ++i)
+        {
+          if (nsimulations > ULLONG_MAX / optimize->nvariable)
+            {
+              error_message = g_strdup (_("Too many simulations"));
+              goto exit_on_error;
+            }
+          nsimulations *= optimize->nvariable;
+        }
+      optimize->nsimulations = nsimulations;
     }
   optimize->nclimbings
     = xml_node_get_uint_with_default (node, XML_NCLIMBINGS, 0, &code);
@@ -464,16 +1640,22 @@ optimize_read (Optimize * optimize,     ///< Optimize struct.
       error_message = g_strdup (_("Bad iterations number"));
       goto exit_on_error;
     }
+  if (optimize->nsimulations
+      > ULLONG_MAX / optimize->niterations / (unsigned int) nnodes)
+    {
+      error_message = g_strdup (_("Too many simulations"));
+      goto exit_on_error;
+    }
   optimize->convergence_factor
     = xml_node_get_float (node, XML_CONVERGENCE_FACTOR, &code);
-  if (code || optimize->convergence_factor < LDBL_EPSILON)
+  if (code || optimize->convergence_factor < REAL_EPSILON)
     {
       error_message = g_strdup (_("Bad convergence factor"));
       goto exit_on_error;
     }
   optimize->climbing_factor
     = xml_node_get_float (node, XML_CLIMBING_FACTOR, &code);
-  if (code || optimize->climbing_factor < LDBL_EPSILON)
+  if (code || optimize->climbing_factor < REAL_EPSILON)
     {
       error_message = g_strdup (_("Bad climging factor"));
       goto exit_on_error;
@@ -34,6 +34,17 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef OPTIMIZE__H
 #define OPTIMIZE__H 1
 
+///> enumeration to define the reasons to reject a simulation before finishing
+///> its evaluation.
+enum OptimizeReject
+{
+  OPTIMIZE_REJECT_SIGN = 0,
+  ///< the penalty of the negative coefficients reaches the cut-off.
+  OPTIMIZE_REJECT_BOUND = 1,
+  ///< the partial bound of the objective function reaches the cut-off.
+  OPTIMIZE_REJECT_N = 2         ///< number of rejection reasons.
+};
+
 /**
  * \struct Optimize
  * \brief struct defining the data to perform a method optimization.
@@ -43,38 +54,134 @@ struct _Optimize
 {
   int (*method) (Optimize * optimize);
   ///< pointer to the function to calculate the method variables.
-  long double (*objective) (Optimize * optimize);
+  Real (*objective) (Optimize * optimize);
   ///< pointer to the function to calculate the objective function.
-  gsl_rng *rng;                 ///< GSL pseudo-random numbers generator struct.
-  ///< pointer to the array of GSL pseudo-random numbers generator structs.
-  long double *coefficient;
+  void (*batch) (Optimize * optimize);
+  ///< pointer to the function to calculate the objective function of a batch
+  ///< of simulations in double precision (NULL if not available).
+  Real (*evaluate) (void *data);
+  ///< pointer to the specialized function to calculate the method variables
+  ///< and the objective function (NULL if not available).
+  Real (*sample) (void *data, Optimize * optimize,
+                  unsigned long long int first,
+                  unsigned long long int last, Real o2,
+                  unsigned long long int *i2, Real *vo);
+  ///< pointer to the specialized function to sample a range of simulations
+  ///< (NULL if not available).
+  Real (*probe) (Optimize * optimize, unsigned int j, Real v);
+  ///< pointer to the function to screen the objective function moving the
+  ///< freedom degree j to v from the point of the current method variables,
+  ///< updating only the variables depending on it (NULL if not available).
+  Real *coefficient;
   ///< array of method coefficientes.
-  long double *random_data;
+  Real *random_data;
   ///< array of freedom degree values.
-  long double *value_optimal;
+  Real *value_optimal;
   ///< pointer to the array of optimal values of the freedom degrees.
-  long double *minimum;
+  Real *minimum;
   ///< pointer to the array of minimum values of the freedom degrees.
-  long double *interval;
+  Real *interval;
   ///< pointer to the array of intervals of the freedom degrees.
-  long double *minimum0;
+  Real *minimum0;
   ///< pointer to the initial array of minimum values of the freedom degrees.
-  long double *interval0;
+  Real *interval0;
   ///< pointer to the initial array of intervals of the freedom degrees.
-  long double *optimal;
+  const Real *polytope;
+  ///< pointer to the matrix of the linear constraints of the feasible freedom
+  ///< degrees, a row of nfree + 1 values per constraint (constant term and
+  ///< coefficients) being non-negative on the feasible region (NULL if the
+  ///< simulations are not sampled by hit-and-run).
+  Real *walk;
+  ///< array of the hit-and-run point, the starting point and the direction
+  ///< (nfree values each) followed by the values and the directional
+  ///< derivatives of the constraints (npolytope values each).
+  Real *mean;
+  ///< array of means of the sampling distribution of the freedom degrees on
+  ///< the cross-entropy sampling.
+  Real *deviation;
+  ///< array of standard deviations of the sampling distribution of the
+  ///< freedom degrees on the cross-entropy sampling.
+  Real *elite;
+  ///< array of the elite simulations of the thread on the cross-entropy
+  ///< sampling, a row of nfree + 1 values per simulation (objective function
+  ///< value and freedom degree values) ordered as a max-heap.
+  unsigned long long int *elite_simulation;
+  ///< array of the simulation numbers of the elite simulations.
+  Real *work;
+  ///< array of work values of the thread (optimal point, climbing point,
+  ///< climbing intervals and local optimal point, nfree values each).
+  Real *batch_random;
+  ///< array of freedom degree values of a batch of simulations (a row per
+  ///< simulation).
+  double *uniform;
+  ///< array of uniform random numbers of up to OPTIMIZE_BATCH simulations (a
+  ///< row per simulation).
+  double *batch_data;
+  ///< array of double precision data of a batch of simulations, stored as
+  ///< structure of arrays (OPTIMIZE_BATCH values per freedom degree, then
+  ///< per coefficient and then the objective function values).
+  Real *optimal;
   ///< pointer to the optimal objective function value.
   unsigned int *random_type;
   ///< pointer the the array of random generation types for the freedom degrees.
+  unsigned int *sequence;
+  ///< pointer to the sequence counter of the optimal values.
+  unsigned long long int *simulation_optimal;
+  ///< pointer to the simulation number of the optimal values, breaking the
+  ///< ties of the optimal objective function value.
   void *data;
   ///< pointer to additional method data.
-  long double convergence_factor;       ///< convergence factor.
-  long double climbing_factor;
+  Real cutoff;
+  ///< cut-off of the objective function, the evaluation of a simulation can
+  ///< end as soon as its objective function value can not be lower.
+  Real range_optimal;
+  ///< optimal objective function value of the simulations of the thread range,
+  ///< sampled by any thread (the freedom degree values are the local optimal
+  ///< point of the work array).
+  Real convergence_factor;      ///< convergence factor.
+  Real climbing_factor;
   ///< factor to the coordinates hill climbing optimization algorithm.
+  unsigned long long int seed;
+  ///< seed of the pseudo-random numbers of the freedom degrees.
+  unsigned long long int uniform_seed;
+  ///< seed of the uniform random numbers stored on the uniform array.
+  unsigned long long int uniform_first;
+  ///< first simulation number of the uniform random numbers stored on the
+  ///< uniform array.
   unsigned long long int nsimulations;
   ///< number of total simulations on optimization algorithm.
+  unsigned long long int simulation;
+  ///< simulation number of the freedom degree values.
+  unsigned long long int range_simulation;
+  ///< simulation number of the optimal values of the thread range.
+  unsigned long long int walk_next;
+  ///< simulation number of the next point of the hit-and-run chain.
+  unsigned long long int rejected[OPTIMIZE_REJECT_N];
+  ///< numbers of simulations rejected by every reason.
   unsigned int thread;          ///< thread number.
+  unsigned int iteration;       ///< current iteration number.
+  unsigned int uniform_iteration;
+  ///< iteration number of the uniform random numbers stored on the uniform
+  ///< array.
+  unsigned int nuniform;
+  ///< number of simulations of the uniform random numbers stored on the
+  ///< uniform array.
+  unsigned int version;
+  ///< version of the search intervals on asynchronous optimization iterations.
+  unsigned int walk_iteration;
+  ///< iteration number of the hit-and-run chain.
+  unsigned int walking;
+  ///< 1 if the simulations are sampled by hit-and-run, 0 otherwise.
+  unsigned int npolytope;
+  ///< number of linear constraints of the feasible freedom degrees.
+  unsigned int nelite;
+  ///< number of elite simulations per iteration on the cross-entropy sampling
+  ///< (0 on the search intervals convergence).
+  unsigned int elite_size;
+  ///< number of elite simulations stored by the thread.
   unsigned int nvariable;
-  ///< number of total simulations per variable on optimization algorithm.
+  ///< number of total simulations per variable on optimization algorithm, 0
+  ///< on the sample budget mode.
   unsigned int nclimbings;
   ///< number of steps on coordinates hill climbing optimization algorithm.
   unsigned int niterations;     ///< iterations number.
@@ -83,87 +190,609 @@ struct _Optimize
   unsigned int type;            ///< method type.
   unsigned int order;           ///< accuracy order.
   unsigned int nsteps;          ///< steps number.
-};
+} __attribute__ ((aligned (CACHE_LINE_SIZE)));
+
+/**
+ * \struct OptimizeProbes
+ * \brief struct to define the probes of a hill climbing step, that the threads
+ *   waiting on a barrier can help to evaluate.
+ */
+typedef struct
+{
+  void (*help) (void *data, unsigned int thread);
+  ///< pointer to the function to help on the evaluation of the probes.
+  void *job;                    ///< data of the help function.
+  Real *centre;
+  ///< array of freedom degree values of the climbing centre.
+  Real *tail;
+  ///< array of freedom degree values after the moved freedom degree.
+  Real *step;                   ///< array of climbing intervals.
+  Real *probe;                  ///< array of objective function values.
+  Real cutoff;                  ///< cut-off of the evaluations.
+  unsigned long long int simulation;    ///< simulation number of the 1st probe.
+  unsigned int next;            ///< next probe to evaluate.
+  unsigned int last;            ///< end of the probes to evaluate.
+} OptimizeProbes;
 
 typedef int (*OptimizeMethod) (Optimize * optimize);
-typedef long double (*OptimizeObjective) (Optimize * optimize);
+typedef Real (*OptimizeObjective) (Optimize * optimize);
 typedef void (*OptimizePrint) (Optimize * optimize, FILE * file);
+typedef void (*OptimizeStep) (Optimize * optimize);
+typedef Real (*OptimizeSample) (void *data, Optimize * optimize,
+                                unsigned long long int first,
+                                unsigned long long int last, Real o2,
+                                unsigned long long int *i2, Real *vo);
 
 extern FILE *file_variables;
 extern int rank;
 extern int nnodes;
 extern unsigned nthreads;
+extern unsigned int asynchronous;
+extern unsigned int dynamic;
+extern unsigned int batch;
+extern double batch_margin;
 
 void optimize_print_random (Optimize * optimize, FILE * file);
+void optimize_probes_evaluate (Optimize * optimize, void *data,
+                               OptimizeProbes * probes);
+void optimize_probes_help (OptimizeProbes * probes, unsigned int thread);
+void optimize_probes_run (OptimizeProbes * probes, Optimize * optimize,
+                          void *data, unsigned int thread);
+Real optimize_sample_batch (Optimize * optimize,
+                            unsigned long long int first,
+                            unsigned long long int last,
+                            Real o2, unsigned long long int *i2, Real *vo);
 void optimize_step (Optimize * optimize);
-void optimize_init (Optimize * optimize, gsl_rng * rng, unsigned int thread);
+int optimize_asynchronous_next (Optimize * optimize,
+                                unsigned long long int *first,
+                                unsigned long long int *last);
+void optimize_asynchronous_report (Optimize * optimize,
+                                   unsigned long long int n,
+                                   OptimizeStep climb);
+void optimize_asynchronous_run (Optimize * optimize, OptimizeStep step,
+                                size_t size);
+void optimize_walk_start (Optimize * optimize);
+void optimize_walk (Optimize * optimize, unsigned long long int ns,
+                    Real *data);
+void optimize_iteration (Optimize * optimize, size_t size,
+                         unsigned int iteration);
+void optimize_print_rejected (Optimize * optimize, size_t size,
+                              const char *label);
+void optimize_init (Optimize * optimize);
 void optimize_delete (Optimize * optimize);
+#if HAVE_MPI
+int optimize_nodes_optimal (Real *optimal, unsigned long long int *simulation,
+                            Real *value_optimal, unsigned int n);
+void optimize_climb_step (Optimize * optimize);
+void optimize_dynamic_range (unsigned long long int n);
+void optimize_dynamic_init (void);
+void optimize_dynamic_free (void);
+#endif
 void optimize_bucle (Optimize * optimize);
-void optimize_create (Optimize * optimize, long double *optimal,
-                      long double *value_optimal);
+void optimize_create (Optimize * optimize, Real *optimal,
+                      Real *value_optimal, unsigned int *sequence,
+                      unsigned long long int *simulation);
 int optimize_read (Optimize * optimize, xmlNode * node);
 
 /**
- * Function to generate the freedom degree values.
+ * Function to get the scrambling key of the low-discrepancy sequences of a
+ * simulation, depending on the seed and the iteration and changing every 2^32
+ * simulations.
+ *
+ * \return scrambling key.
+ */
+static inline unsigned long long int
+optimize_scramble (Optimize * optimize, ///< Optimize struct.
+                   unsigned long long int ns)   ///< simulation number.
+{
+  return random_hash (optimize->seed
+                      ^ random_hash ((ns >> 32)
+                                     ^ ((unsigned long long int)
+                                        optimize->iteration << 32)));
+}
+
+/**
+ * Function to get the stratum of a freedom degree of a simulation on the Latin
+ * hypercube of the sample budget mode, by a random permutation of the
+ * simulation numbers depending on the seed, the iteration and the freedom
+ * degree.
+ *
+ * \return stratum number.
+ */
+static inline unsigned long long int
+optimize_stratum (Optimize * optimize,  ///< Optimize struct.
+                  unsigned long long int ns,    ///< simulation number.
+                  unsigned int i)       ///< freedom degree number.
+{
+  return random_permute (ns, optimize->nsimulations,
+                         random_hash (random_hash (optimize->seed + i)
+                                      ^ optimize->iteration));
+}
+
+/**
+ * Function to transform the uniform random numbers of a simulation in freedom
+ * degree values. On the cross-entropy sampling, after the first iteration, the
+ * values follow the normal distribution fitted to the elite simulations.
  */
 static inline void
-optimize_generate_freedom (Optimize * optimize, ///< Optimize struct.
-                           unsigned long long int ns)   ///< simulation number.
+optimize_transform (Optimize * optimize,        ///< Optimize struct.
+                    unsigned long long int ns,  ///< simulation number.
+                    const double *u,    ///< array of uniform random numbers.
+                    Real *data) ///< array of freedom degree values.
 {
-  gsl_rng *rng;
-  long double *data, *minimum, *interval;
-  unsigned long long int j;
+  Real *minimum, *interval;
+  unsigned long long int j, key;
   const unsigned int *type;
   unsigned int i, k, n;
   n = optimize->nfree;
-  data = optimize->random_data;
   minimum = optimize->minimum;
   interval = optimize->interval;
   type = optimize->random_type;
-  rng = optimize->rng;
+
+  // fitted normal distribution on the cross-entropy sampling, bounded by the
+  // initial search intervals
+  if (optimize->nelite && optimize->iteration)
+    {
+      minimum = optimize->minimum0;
+      interval = optimize->interval0;
+      for (i = 0; i < n; ++i)
+        data[i] = fminr (fmaxr (optimize->mean[i] + optimize->deviation[i]
+                                * (Real) random_normal (u[i]), minimum[i]),
+                         minimum[i] + interval[i]);
+      return;
+    }
+
+  key = 0;
   j = ns;
   for (i = 0; i < n; ++i)
     switch (type[i])
       {
       case RANDOM_TYPE_UNIFORM:
-        data[i] = minimum[i] + interval[i] * gsl_rng_uniform (rng);
+        data[i] = minimum[i] + interval[i] * u[i];
         break;
       case RANDOM_TYPE_BOTTOM:
-        data[i] = minimum[i] + interval[i] * random_zero (rng);
+        data[i] = minimum[i] + interval[i] * random_zero (u[i]);
         break;
       case RANDOM_TYPE_EXTREME:
-        data[i] = minimum[i] + interval[i] * random_extreme (rng);
+        data[i] = minimum[i] + interval[i] * random_extreme (u[i]);
         break;
       case RANDOM_TYPE_TOP:
-        data[i] = minimum[i] + interval[i] * random_one (rng);
+        data[i] = minimum[i] + interval[i] * random_one (u[i]);
         break;
       case RANDOM_TYPE_REGULAR:
+        if (!optimize->nvariable)
+          {
+            data[i] = minimum[i] + interval[i]
+              * ((Real) optimize_stratum (optimize, ns, i) + REAL (0.5))
+              / (Real) optimize->nsimulations;
+            break;
+          }
         k = j % optimize->nvariable;
         j /= optimize->nvariable;
         data[i] = minimum[i] + interval[i] * k / (optimize->nvariable - 1);
         break;
+      case RANDOM_TYPE_SOBOL:
+        if (!key)
+          key = optimize_scramble (optimize, ns);
+        data[i] = minimum[i] + interval[i]
+          * random_sobol ((unsigned int) ns, i,
+                          (unsigned int) ((key ^ i) * 0x9E3779B97F4A7C15ull
+                                          >> 32), u[i]);
+        break;
+      case RANDOM_TYPE_HALTON:
+        if (!key)
+          key = optimize_scramble (optimize, ns);
+        data[i] = minimum[i] + interval[i]
+          * random_halton (ns, random_prime[i],
+                           (key ^ i) * 0x9E3779B97F4A7C15ull, u[i],
+                           (double) optimize->nsimulations);
+        break;
       default:
+        if (!optimize->nvariable)
+          {
+            data[i] = minimum[i] + interval[i]
+              * ((Real) optimize_stratum (optimize, ns, i) + u[i])
+              / (Real) optimize->nsimulations;
+            break;
+          }
         k = j % optimize->nvariable;
         j /= optimize->nvariable;
         data[i] = minimum[i]
-          + interval[i] * (k + gsl_rng_uniform (rng)) / optimize->nvariable;
+          + interval[i] * (k + u[i]) / optimize->nvariable;
       }
 }
 
+/**
+ * Function to generate the freedom degree values. The uniform random numbers of
+ * the next simulations, up to OPTIMIZE_BATCH, are generated together and kept
+ * for the following calls. On the feasible region sampling the values are
+ * the points of the hit-and-run chain.
+ */
+static inline void
+optimize_generate_freedom (Optimize * optimize, ///< Optimize struct.
+                           unsigned long long int ns,   ///< simulation number.
+                           unsigned long long int last)
+                           ///< end of the simulations of the range.
+{
+  unsigned long long int n;
+  optimize->simulation = ns;
+  if (optimize->walking)
+    {
+      optimize_walk (optimize, ns, optimize->random_data);
+      return;
+    }
+  if (ns < optimize->uniform_first
+      || ns - optimize->uniform_first >= optimize->nuniform
+      || optimize->uniform_seed != optimize->seed
+      || optimize->uniform_iteration != optimize->iteration)
+    {
+      n = (last - ns > OPTIMIZE_BATCH) ? OPTIMIZE_BATCH : last - ns;
+      random_uniform (optimize->uniform, ns, n, optimize->nfree,
+                      optimize->iteration, optimize->seed);
+      optimize->uniform_seed = optimize->seed;
+      optimize->uniform_first = ns;
+      optimize->uniform_iteration = optimize->iteration;
+      optimize->nuniform = n;
+    }
+  optimize_transform (optimize, ns, optimize->uniform
+                      + (ns - optimize->uniform_first) * optimize->nfree,
+                      optimize->random_data);
+}
+
+/**
+ * Function to generate the freedom degree values of a batch of simulations on
+ * the batch_random array.
+ */
+static inline void
+optimize_generate_batch (Optimize * optimize,   ///< Optimize struct.
+                         unsigned long long int first,
+                         ///< first simulation number.
+                         unsigned int n)        ///< number of simulations.
+{
+  unsigned int i, nfree;
+  nfree = optimize->nfree;
+  if (optimize->walking)
+    {
+      for (i = 0; i < n; ++i)
+        optimize_walk (optimize, first + i,
+                       optimize->batch_random + i * nfree);
+      return;
+    }
+  random_uniform (optimize->uniform, first, n, nfree, optimize->iteration,
+                  optimize->seed);
+  optimize->uniform_seed = optimize->seed;
+  optimize->uniform_first = first;
+  optimize->uniform_iteration = optimize->iteration;
+  optimize->nuniform = n;
+  for (i = 0; i < n; ++i)
+    optimize_transform (optimize, first + i, optimize->uniform + i * nfree,
+                        optimize->batch_random + i * nfree);
+}
+
+/**
+ * Function to calculate the method variables and the objective function, by the
+ * specialized function if available. The evaluation can end as soon as the
+ * objective function value can not be lower than the cut-off, returning then a
+ * value not lower than the cut-off instead of the exact one.
+ *
+ * \return objective function value.
+ */
+static inline Real
+optimize_evaluate (Optimize * optimize, ///< Optimize struct.
+                   void *data,
+                   ///< argument of the method and objective functions.
+                   Real cutoff) ///< cut-off (INFINITY to get the exact value).
+{
+  Real o;
+  optimize->cutoff = cutoff;
+  if (optimize->evaluate)
+    o = optimize->evaluate (data);
+  else if (!optimize->method ((Optimize *) data))
+    o = INFINITY;
+  else
+    o = optimize->objective ((Optimize *) data);
+  optimize->cutoff = INFINITY;
+  return o;
+}
+
+/**
+ * Function to screen the objective function by the probe function with a
+ * cut-off, as the optimize_evaluate function.
+ *
+ * \return screened objective function value.
+ */
+static inline Real
+optimize_probe (Optimize * optimize,    ///< Optimize struct.
+                unsigned int j, ///< freedom degree number.
+                Real v,         ///< freedom degree value.
+                Real cutoff)    ///< cut-off (INFINITY to get the exact value).
+{
+  Real o;
+  optimize->cutoff = cutoff;
+  o = optimize->probe (optimize, j, v);
+  optimize->cutoff = INFINITY;
+  return o;
+}
+
+/**
+ * Function to get the value of the freedom degree moved by a hill climbing
+ * probe: the (j/2)-th freedom degree is increased by the climbing interval on
+ * even probes and decreased, but not below zero, on odd probes.
+ *
+ * \return freedom degree value.
+ */
+static inline Real
+optimize_probes_value (OptimizeProbes * probes, ///< OptimizeProbes struct.
+                       unsigned int j)  ///< probe number.
+{
+  Real v;
+  unsigned int k;
+  k = j >> 1;
+  v = probes->centre[k];
+  if (j & 1)
+    return fmaxr (REAL (0.), v - probes->step[k]);
+  return v + probes->step[k];
+}
+
+/**
+ * Function to get the freedom degree values of a hill climbing probe. The
+ * freedom degrees before the moved one take the values of the climbing centre
+ * and the freedom degrees after it the values of the tail array.
+ */
+static inline void
+optimize_probes_point (OptimizeProbes * probes, ///< OptimizeProbes struct.
+                       Real *x,
+                       ///< array of freedom degree values of the probe.
+                       unsigned int j,  ///< probe number.
+                       unsigned int nfree)      ///< number of freedom degrees.
+{
+  unsigned int k;
+  k = j >> 1;
+  memcpy (x, probes->centre, k * sizeof (Real));
+  x[k] = optimize_probes_value (probes, j);
+  memcpy (x + k + 1, probes->tail + k + 1, (nfree - k - 1) * sizeof (Real));
+}
+
+/**
+ * Function to check if a simulation can be rejected because a lower bound of
+ * its objective function value reaches the cut-off.
+ *
+ * \return 1 if the simulation is rejected, 0 otherwise.
+ */
+static inline int
+optimize_reject (Optimize * optimize,   ///< Optimize struct.
+                 Real bound,    ///< lower bound of the objective function.
+                 unsigned int reason)   ///< rejection reason.
+{
+  if (bound < optimize->cutoff)
+    return 0;
+  ++optimize->rejected[reason];
+  return 1;
+}
+
+/**
+ * Function to check if a simulation screened by a double precision or by a
+ * probe objective function value has to be confirmed in full precision. The
+ * simulations within the batch_margin relative margin to the optimal value,
+ * bound included so the ties can be broken on the simulation number, are
+ * confirmed, covering the rounding errors of the screening, the not a number
+ * values and all the simulations while there is not a finite optimal value.
+ * The infinite values, set by the batch and probe functions to the
+ * simulations without solution, are discarded.
+ *
+ * \return 1 if the simulation has to be confirmed, 0 otherwise.
+ */
+static inline int
+optimize_screen (double o,      ///< screened objective function value.
+                 Real o2)       ///< optimal objective function value.
+{
+  return isinf (o2) || isnan (o)
+    || o <= o2 + batch_margin * (REAL (1.) + fabsr (o2));
+}
+
+/**
+ * Function to compare the keys of two simulations: the objective function
+ * value and, on equal values, the simulation number, so the optimal simulation
+ * does not depend on the distribution of the simulations between the threads.
+ *
+ * \return 1 if the first key is lower, 0 otherwise.
+ */
+static inline int
+optimize_lower (Real o1,        ///< 1st objective function value.
+                unsigned long long int n1,      ///< 1st simulation number.
+                Real o2,        ///< 2nd objective function value.
+                unsigned long long int n2)      ///< 2nd simulation number.
+{
+  return o1 < o2 || (o1 == o2 && n1 < n2);
+}
+
+/**
+ * Function to get the cut-off of the evaluation of a simulation from the
+ * optimal values. It is just over the optimal objective function value if the
+ * simulation number is lower than the optimal one, so an equal value is
+ * evaluated exactly and wins the tie.
+ *
+ * \return cut-off.
+ */
+static inline Real
+optimize_cutoff (Real o2,       ///< optimal objective function value.
+                 unsigned long long int i2,
+                 ///< optimal simulation number.
+                 unsigned long long int ns)     ///< simulation number.
+{
+  return (ns < i2) ? nextafterr (o2, INFINITY) : o2;
+}
+
+/**
+ * Macro to define the specialized functions of a pair of method and objective
+ * functions: name_evaluate, to calculate the method variables and the objective
+ * function, and name_sample, to sample a range of simulations keeping the
+ * optimal one, on input the optimal values, and breaking the ties by the
+ * simulation number. The method and objective functions are called directly,
+ * so the compiler can inline them on the sampling loop, with the optimal value
+ * as cut-off.
+ */
+#define OPTIMIZE_SPECIALIZE(name, method, objective) \
+static Real \
+name##_evaluate (void *data) \
+{ \
+  if (!method (data)) \
+    return INFINITY; \
+  return objective (data); \
+} \
+static Real \
+name##_sample (void *data, Optimize * optimize, \
+               unsigned long long int first, unsigned long long int last, \
+               Real o2, unsigned long long int *i2, Real *vo) \
+{ \
+  Real o; \
+  for (; first < last; ++first) \
+    { \
+      optimize_generate_freedom (optimize, first, last); \
+      optimize->cutoff = optimize_cutoff (o2, *i2, first); \
+      o = name##_evaluate (data); \
+      if (optimize_lower (o, first, o2, *i2)) \
+        { \
+          o2 = o; \
+          *i2 = first; \
+          memcpy (vo, optimize->random_data, \
+                  optimize->nfree * sizeof (Real)); \
+        } \
+    } \
+  optimize->cutoff = INFINITY; \
+  return o2; \
+}
+
+/**
+ * Function to read the optimal values without blocking. The sequence counter is
+ * odd while a thread is updating the optimal values, so the reading is retried
+ * if the counter is odd or changes.
+ *
+ * \return optimal objective function value.
+ */
+static inline Real
+optimize_best_read (Optimize * optimize,        ///< Optimize struct.
+                    Real *value_optimal,
+                    ///< array to copy the optimal freedom degree values or
+                    ///< NULL.
+                    unsigned long long int *simulation)
+                    ///< pointer to copy the optimal simulation number or NULL.
+{
+  Real optimal;
+  unsigned long long int ns;
+  unsigned int sequence;
+  while (1)
+    {
+      sequence = __atomic_load_n (optimize->sequence, __ATOMIC_ACQUIRE);
+      if (sequence & 1)
+        continue;
+      optimal = *optimize->optimal;
+      ns = *optimize->simulation_optimal;
+      if (value_optimal)
+        memcpy (value_optimal, optimize->value_optimal,
+                optimize->nfree * sizeof (Real));
+      __atomic_thread_fence (__ATOMIC_ACQUIRE);
+      if (__atomic_load_n (optimize->sequence, __ATOMIC_RELAXED) == sequence)
+        {
+          if (simulation)
+            *simulation = ns;
+          return optimal;
+        }
+    }
+}
+
+/**
+ * Function to get the sequence counter of the optimal values to write them. The
+ * writing threads get the counter by an atomic compare-and-swap making it odd
+ * and release it even.
+ *
+ * \return even sequence counter to release adding 2.
+ */
+static inline unsigned int
+optimize_best_lock (Optimize * optimize)        ///< Optimize struct.
+{
+  unsigned int sequence;
+  while (1)
+    {
+      sequence = __atomic_load_n (optimize->sequence, __ATOMIC_RELAXED);
+      if (!(sequence & 1)
+          && __atomic_compare_exchange_n (optimize->sequence, &sequence,
+                                          sequence + 1, 0, __ATOMIC_ACQUIRE,
+                                          __ATOMIC_RELAXED))
+        break;
+    }
+  __atomic_thread_fence (__ATOMIC_RELEASE);
+  return sequence;
+}
+
+/**
+ * Function to set the optimal objective function value keeping the optimal
+ * freedom degree values. The simulation number is reset, so the simulations
+ * with equal objective function value do not update the optimal values.
+ */
+static inline void
+optimize_best_set (Optimize * optimize, ///< Optimize struct.
+                   Real optimal)        ///< objective function value.
+{
+  unsigned int sequence;
+  sequence = optimize_best_lock (optimize);
+  *optimize->optimal = optimal;
+  *optimize->simulation_optimal = 0L;
+  __atomic_store_n (optimize->sequence, sequence + 2, __ATOMIC_RELEASE);
+}
+
+/**
+ * Function to update the optimal values if the key of a simulation, the
+ * objective function value and the simulation number, is lower.
+ *
+ * \return 1 if the optimal values have been updated, 0 otherwise.
+ */
+static inline int
+optimize_best_update (Optimize * optimize,      ///< Optimize struct.
+                      Real optimal,     ///< objective function value.
+                      unsigned long long int simulation,
+                      ///< simulation number.
+                      Real *value_optimal)
+                      ///< array of freedom degree values.
+{
+  Real o;
+  unsigned long long int ns;
+  unsigned int sequence;
+  int updated;
+  o = optimize_best_read (optimize, NULL, &ns);
+  if (!optimize_lower (optimal, simulation, o, ns))
+    return 0;
+  sequence = optimize_best_lock (optimize);
+  updated = optimize_lower (optimal, simulation, *optimize->optimal,
+                            *optimize->simulation_optimal);
+  if (updated)
+    {
+      *optimize->optimal = optimal;
+      *optimize->simulation_optimal = simulation;
+      memcpy (optimize->value_optimal, value_optimal,
+              optimize->nfree * sizeof (Real));
+    }
+  __atomic_store_n (optimize->sequence, sequence + 2, __ATOMIC_RELEASE);
+  return updated;
+}
+
 /**
  * Function to reduce the search variable intervals to increase convergence.
  */
 static inline void
-optimize_converge (Optimize * optimize) ///< Optimize struct.
+optimize_converge (Optimize * optimize, ///< Optimize struct.
+                   Real *value_optimal)
+                   ///< array of optimal freedom degree values.
 {
-  long double d, factor;
+  Real d, factor;
   unsigned int i, n;
   n = optimize->nfree;
   factor = optimize->convergence_factor;
   for (i = 0; i < n; ++i)
     {
       d = optimize->interval[i] *= factor;
-      optimize->minimum[i] = fmaxl (0.L, optimize->value_optimal[i] - d * 0.5L);
+      optimize->minimum[i]
+        = fmaxr (REAL (0.), value_optimal[i] - d * REAL (0.5));
     }
 }
 
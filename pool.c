@@ -0,0 +1,749 @@
+/*
+ODE: a program to get optime Runge-Kutta and multi-steps methods.
+
+Copyright 2011-2019, Javier Burguete Tolosa.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice,
+		this list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+		this list of conditions and the following disclaimer in the
+		documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY Javier Burguete Tolosa ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL Javier Burguete Tolosa OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+/**
+ * \file pool.c
+ * \brief Source file with the persistent pool of worker threads.
+ * \author Javier Burguete Tolosa.
+ * \copyright Copyright 2011-2019.
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <glib.h>
+#ifdef __linux__
+#include <sched.h>
+#include <dirent.h>
+#endif
+#include "config.h"
+#include "pool.h"
+
+#define DEBUG_POOL 0            ///< macro to debug.
+
+/**
+ * \struct PoolRange
+ * \brief struct to define the range of indexes pending on a thread.
+ */
+typedef struct
+{
+  unsigned long long int first; ///< next pending index.
+  unsigned long long int last;  ///< end of the range of indexes.
+  unsigned long long int chunk; ///< number of indexes to get every time.
+  char padding[CACHE_LINE_SIZE - 3 * sizeof (unsigned long long int)];
+  ///< padding to avoid to share cache lines with other threads.
+} PoolRange;
+
+/**
+ * \struct PoolJob
+ * \brief struct to define a job in flight of a thread that the threads waiting
+ *   on a barrier can help to perform.
+ */
+typedef struct
+{
+  PoolHelp function;            ///< function to help on the job.
+  void *data;                   ///< job data.
+  unsigned int active;          ///< number of threads helping on the job.
+} PoolJob;
+
+/**
+ * \struct Pool
+ * \brief struct to define a persistent pool of worker threads.
+ */
+typedef struct
+{
+  PoolRange *range;             ///< array of ranges of indexes per thread.
+  PoolJob *job;                 ///< array of jobs in flight per thread.
+  GMutex mutex[1];              ///< GMutex struct to access the barrier data.
+  GCond cond[1];                ///< GCond struct to wake the waiting threads.
+  GThread **thread;             ///< array of worker GThread structs.
+#ifdef __linux__
+  cpu_set_t *affinity;          ///< array of CPU sets to pin every thread.
+#endif
+  PoolFunction function;        ///< function to execute by every thread.
+  PoolRefill refill;
+  ///< function to get new chunks of indexes when all the ranges are empty.
+  char *data;                   ///< array of data of every thread.
+  size_t size;                  ///< size of the data of every thread.
+  unsigned int nthreads;        ///< threads number.
+  unsigned int count;           ///< number of threads waiting on the barrier.
+  unsigned int generation;      ///< barrier generation counter.
+} Pool;
+
+static Pool pool[1];            ///< persistent pool of worker threads.
+
+#ifdef __linux__
+
+/**
+ * Function to read a list of CPUs in the format of the Linux sysfs files
+ * (e.g. "0-3,8,10-11").
+ *
+ * \return 1 on success, 0 on error.
+ */
+static int
+pool_cpulist_read (const char *name,    ///< file name.
+                   cpu_set_t * set)     ///< CPU set.
+{
+  char buffer[4096];
+  FILE *file;
+  char *c;
+  long int i, j;
+  file = fopen (name, "r");
+  if (!file)
+    return 0;
+  c = fgets (buffer, sizeof (buffer), file);
+  fclose (file);
+  if (!c)
+    return 0;
+  CPU_ZERO (set);
+  while (*c >= '0' && *c <= '9')
+    {
+      i = j = strtol (c, &c, 10);
+      if (*c == '-')
+        j = strtol (c + 1, &c, 10);
+      for (; i <= j && i < CPU_SETSIZE; ++i)
+        CPU_SET (i, set);
+      if (*c == ',')
+        ++c;
+    }
+  return 1;
+}
+
+/**
+ * Function to read the CPUs limit of a directory of the control groups
+ * hierarchy. It reads the cpu.max file of the cgroup v2 hierarchy or the
+ * cpu.cfs_quota_us and cpu.cfs_period_us files of the cgroup v1 hierarchy.
+ *
+ * \return CPUs limit, 0 if not limited.
+ */
+static unsigned int
+pool_cgroup_read (const char *directory,        ///< directory name.
+                  unsigned int version) ///< cgroup version.
+{
+  char name[4200];
+  FILE *file;
+  long long int quota, period;
+  quota = -1;
+  period = 0;
+  if (version == 2)
+    {
+      snprintf (name, sizeof (name), "%s/cpu.max", directory);
+      file = fopen (name, "r");
+      if (file)
+        {
+          if (fscanf (file, "%lld %lld", &quota, &period) != 2)
+            quota = -1;
+          fclose (file);
+        }
+    }
+  else
+    {
+      snprintf (name, sizeof (name), "%s/cpu.cfs_quota_us", directory);
+      file = fopen (name, "r");
+      if (file)
+        {
+          if (fscanf (file, "%lld", &quota) != 1)
+            quota = -1;
+          fclose (file);
+          snprintf (name, sizeof (name), "%s/cpu.cfs_period_us", directory);
+          file = fopen (name, "r");
+          if (file)
+            {
+              if (fscanf (file, "%lld", &period) != 1)
+                quota = -1;
+              fclose (file);
+            }
+        }
+    }
+  if (quota <= 0 || period <= 0)
+    return 0;
+  return (unsigned int) ((quota + period - 1) / period);
+}
+
+/**
+ * Function to get the CPUs limit of the control group of the process. The
+ * limit of a control group is the minimum of the limits of the group and all
+ * its ancestors, so the hierarchy is walked up to the root.
+ *
+ * \return CPUs limit, 0 if not limited.
+ */
+static unsigned int
+pool_cgroup_cpus (void)
+{
+  char buffer[4096], name[4200];
+  FILE *file;
+  char *c, *d;
+  size_t length;
+  unsigned int m, n, version;
+
+  // cgroup path of the process, on the cgroup v1 cpu controller if it is
+  // mounted, else on the cgroup v2 hierarchy
+  name[0] = 0;
+  version = 0;
+  file = fopen ("/proc/self/cgroup", "r");
+  if (file)
+    {
+      while (fgets (buffer, sizeof (buffer), file))
+        {
+          c = strchr (buffer, '\n');
+          if (c)
+            *c = 0;
+          c = strchr (buffer, ':');
+          if (!c)
+            continue;
+          d = strchr (++c, ':');
+          if (!d)
+            continue;
+          *d++ = 0;
+          if (!*c && !version)
+            {
+              version = 2;
+              snprintf (name, sizeof (name), "/sys/fs/cgroup%s", d);
+            }
+          else if (strstr (c, "cpu"))
+            {
+              // controllers list, e.g. "cpu,cpuacct"
+              for (c = strtok (c, ","); c; c = strtok (NULL, ","))
+                if (!strcmp (c, "cpu"))
+                  break;
+              if (c)
+                {
+                  version = 1;
+                  snprintf (name, sizeof (name), "/sys/fs/cgroup/cpu%s", d);
+                  break;
+                }
+            }
+        }
+      fclose (file);
+    }
+
+  // unknown path, only the roots of the hierarchies
+  if (!version)
+    {
+      n = pool_cgroup_read ("/sys/fs/cgroup", 2);
+      if (!n)
+        n = pool_cgroup_read ("/sys/fs/cgroup/cpu", 1);
+      return n;
+    }
+
+  // walking up the hierarchy
+  length = strlen ((version == 2) ? "/sys/fs/cgroup" : "/sys/fs/cgroup/cpu");
+  for (n = 0;;)
+    {
+      m = pool_cgroup_read (name, version);
+      if (m && (!n || m < n))
+        n = m;
+      c = strrchr (name + length, '/');
+      if (!c)
+        break;
+      *c = 0;
+    }
+  return n;
+}
+
+/**
+ * Function to compare two unsigned integers to sort them.
+ *
+ * \return -1 if the first is lower, 1 if greater, 0 if equal.
+ */
+static int
+pool_compare (const void *a,    ///< pointer to the first unsigned integer.
+              const void *b)    ///< pointer to the second unsigned integer.
+{
+  unsigned int x, y;
+  x = *(const unsigned int *) a;
+  y = *(const unsigned int *) b;
+  return (x > y) - (x < y);
+}
+
+/**
+ * Function to get the CPUs allowed to the process ordered by NUMA nodes. The
+ * NUMA nodes are the node entries of the sysfs directory, that can be not
+ * consecutive.
+ *
+ * \return number of allowed CPUs.
+ */
+static unsigned int
+pool_cpus_ordered (int *cpu,    ///< array of CPU numbers.
+                   unsigned int *node,
+                   ///< array of NUMA node numbers of every CPU.
+                   unsigned int *nnodes)        ///< number of NUMA nodes.
+{
+  char name[64];
+  unsigned int id[CPU_SETSIZE];
+  cpu_set_t allowed[1], set[1];
+  DIR *directory;
+  struct dirent *entry;
+  char *c;
+  unsigned int i, j, k, n, m, ncpus;
+  if (sched_getaffinity (0, sizeof (cpu_set_t), allowed))
+    return 0;
+  ncpus = CPU_COUNT (allowed);
+
+  // NUMA node numbers
+  m = 0;
+  directory = opendir ("/sys/devices/system/node");
+  if (directory)
+    {
+      while ((entry = readdir (directory)) && m < CPU_SETSIZE)
+        if (!strncmp (entry->d_name, "node", 4) && entry->d_name[4] >= '0'
+            && entry->d_name[4] <= '9')
+          {
+            id[m] = (unsigned int) strtoul (entry->d_name + 4, &c, 10);
+            if (!*c)
+              ++m;
+          }
+      closedir (directory);
+      qsort (id, m, sizeof (unsigned int), pool_compare);
+    }
+
+  for (i = n = k = 0; i < m && n < ncpus; ++i)
+    {
+      snprintf (name, sizeof (name), "/sys/devices/system/node/node%u/cpulist",
+                id[i]);
+      if (!pool_cpulist_read (name, set))
+        continue;
+      for (j = 0; j < CPU_SETSIZE; ++j)
+        if (CPU_ISSET (j, set) && CPU_ISSET (j, allowed))
+          {
+            cpu[n] = j;
+            node[n++] = k;
+            CPU_CLR (j, allowed);
+          }
+      if (n && node[n - 1] == k)
+        ++k;
+    }
+
+  // CPUs not found on any NUMA node
+  if (CPU_COUNT (allowed))
+    {
+      for (j = 0; j < CPU_SETSIZE; ++j)
+        if (CPU_ISSET (j, allowed))
+          {
+            cpu[n] = j;
+            node[n++] = k;
+          }
+      ++k;
+    }
+  *nnodes = k;
+  return n;
+}
+
+/**
+ * Function to set the CPUs to pin every thread of the pool.
+ */
+static void
+pool_affinity (unsigned int pinning)    ///< pinning type.
+{
+  int cpu[CPU_SETSIZE];
+  unsigned int node[CPU_SETSIZE];
+  cpu_set_t *set;
+  unsigned int i, j, k, n, nnodes;
+  pool->affinity = NULL;
+  if (pinning == POOL_PIN_NONE)
+    return;
+  n = pool_cpus_ordered (cpu, node, &nnodes);
+  if (!n)
+    return;
+  pool->affinity
+    = (cpu_set_t *) g_slice_alloc (pool->nthreads * sizeof (cpu_set_t));
+  for (i = 0; i < pool->nthreads; ++i)
+    {
+      set = pool->affinity + i;
+      CPU_ZERO (set);
+      if (pinning == POOL_PIN_CORES)
+        CPU_SET (cpu[i % n], set);
+      else
+        {
+          // consecutive threads share the same NUMA node
+          k = i * nnodes / pool->nthreads;
+          for (j = 0; j < n; ++j)
+            if (node[j] == k)
+              CPU_SET (cpu[j], set);
+        }
+    }
+}
+
+#endif
+
+/**
+ * Function to pin the calling thread to its CPUs.
+ */
+static inline void
+pool_pin (unsigned int thread)  ///< thread number.
+{
+#ifdef __linux__
+  if (pool->affinity)
+    sched_setaffinity (0, sizeof (cpu_set_t), pool->affinity + thread);
+#endif
+}
+
+/**
+ * Function to get the number of CPUs available to the process. It uses the
+ * CPUs allowed by the affinity mask of the process limited by the CPU quota of
+ * the control group.
+ *
+ * \return number of available CPUs.
+ */
+unsigned int
+pool_cpus (void)
+{
+  long int n;
+#ifdef __linux__
+  cpu_set_t set[1];
+  unsigned int m;
+  if (!sched_getaffinity (0, sizeof (cpu_set_t), set))
+    n = CPU_COUNT (set);
+  else
+    n = sysconf (_SC_NPROCESSORS_ONLN);
+  m = pool_cgroup_cpus ();
+  if (m && m < n)
+    n = m;
+#else
+  n = sysconf (_SC_NPROCESSORS_ONLN);
+#endif
+  if (n < 1)
+    n = 1;
+  return (unsigned int) n;
+}
+
+/**
+ * Function to get a chunk of indexes of a range.
+ *
+ * \return 1 on success, 0 if the range is empty.
+ */
+static inline int
+pool_range_get (PoolRange * range,      ///< PoolRange struct.
+                unsigned long long int *first,  ///< first index of the chunk.
+                unsigned long long int *last)
+                ///< end of the chunk of indexes.
+{
+  unsigned long long int i;
+  if (__atomic_load_n (&range->first, __ATOMIC_RELAXED) >= range->last)
+    return 0;
+  i = __atomic_fetch_add (&range->first, range->chunk, __ATOMIC_RELAXED);
+  if (i >= range->last)
+    return 0;
+  *first = i;
+  *last = (range->last - i > range->chunk) ? i + range->chunk : range->last;
+  return 1;
+}
+
+/**
+ * Function to get the next chunk of indexes to process by a thread. The thread
+ * gets chunks of its own range while they are available, then steals chunks of
+ * the ranges of the other threads and finally calls the refill function if it
+ * is defined.
+ *
+ * \return 1 on success, 0 if all the indexes have been distributed.
+ */
+int
+pool_range_next (unsigned int thread,   ///< thread number.
+                 unsigned long long int *first,
+                 ///< first index of the chunk.
+                 unsigned long long int *last,
+                 ///< end of the chunk of indexes.
+                 unsigned int *range)
+                 ///< number of the range of the chunk (the thread number on
+                 ///< the chunks got by the refill function).
+{
+  unsigned int i, n;
+  n = pool->nthreads;
+  *range = thread;
+  for (i = 0; i < n; ++i, ++*range)
+    {
+      if (*range == n)
+        *range = 0;
+      if (pool_range_get (pool->range + *range, first, last))
+        return 1;
+    }
+  *range = thread;
+  if (pool->refill)
+    return pool->refill (first, last);
+  return 0;
+}
+
+/**
+ * Function to distribute a range of indexes between the threads of the pool.
+ * It has to be called when the worker threads are stopped and it removes the
+ * refill function.
+ */
+void
+pool_range_init (unsigned long long int first,  ///< first index.
+                 unsigned long long int last)   ///< end of the indexes.
+{
+  PoolRange *range;
+  unsigned long long int n, q, r, chunk;
+  unsigned int i, nthreads;
+  nthreads = pool->nthreads;
+  n = last - first;
+  chunk = n / (nthreads * POOL_CHUNKS);
+  if (!chunk)
+    chunk = 1;
+
+  // n * i / nthreads = i * q + i * r / nthreads, with n = q * nthreads + r,
+  // computed without overflowing
+  q = n / nthreads;
+  r = n % nthreads;
+  for (i = 0; i < nthreads; ++i)
+    {
+      range = pool->range + i;
+      range->first = first + i * q + i * r / nthreads;
+      range->last = first + (i + 1) * q + (i + 1) * r / nthreads;
+      range->chunk = chunk;
+    }
+  pool->refill = NULL;
+}
+
+/**
+ * Function to set the function to get new chunks of indexes when all the
+ * ranges of the threads are empty. It has to be called when the worker threads
+ * are stopped, after pool_range_init.
+ */
+void
+pool_range_refill (PoolRefill refill)   ///< refill function.
+{
+  pool->refill = refill;
+}
+
+/**
+ * Function to get a job in flight to help. It has to be called with the mutex
+ * of the pool locked.
+ *
+ * \return PoolJob struct or NULL if there is not any job in flight.
+ */
+static inline PoolJob *
+pool_job (void)
+{
+  unsigned int i;
+  for (i = 0; i < pool->nthreads; ++i)
+    if (pool->job[i].function)
+      return pool->job + i;
+  return NULL;
+}
+
+/**
+ * Function to publish a job in flight of a thread. The threads waiting on a
+ * barrier call the help function while the job is published.
+ */
+void
+pool_job_post (unsigned int thread,     ///< thread number.
+               PoolHelp function,       ///< function to help on the job.
+               void *data)      ///< job data.
+{
+  PoolJob *job;
+  job = pool->job + thread;
+  g_mutex_lock (pool->mutex);
+  job->data = data;
+  job->function = function;
+  if (pool->count)
+    g_cond_broadcast (pool->cond);
+  g_mutex_unlock (pool->mutex);
+}
+
+/**
+ * Function to remove the job in flight of a thread. It waits until all the
+ * helping threads have finished.
+ */
+void
+pool_job_remove (unsigned int thread)   ///< thread number.
+{
+  PoolJob *job;
+  job = pool->job + thread;
+  g_mutex_lock (pool->mutex);
+  job->function = NULL;
+  g_mutex_unlock (pool->mutex);
+  while (__atomic_load_n (&job->active, __ATOMIC_ACQUIRE))
+    g_thread_yield ();
+}
+
+/**
+ * Function to wait until all the threads of the pool reach the barrier. It can
+ * be reused as many times as needed. The waiting threads help on the jobs in
+ * flight of the other threads.
+ */
+void
+pool_barrier (unsigned int thread)      ///< thread number.
+{
+  PoolJob *job;
+  PoolHelp function;
+  void *data;
+  unsigned int generation;
+  g_mutex_lock (pool->mutex);
+  generation = pool->generation;
+  if (++pool->count == pool->nthreads)
+    {
+      pool->count = 0;
+      ++pool->generation;
+      g_cond_broadcast (pool->cond);
+    }
+  else
+    while (generation == pool->generation)
+      {
+        job = pool_job ();
+        if (!job)
+          {
+            g_cond_wait (pool->cond, pool->mutex);
+            continue;
+          }
+        function = job->function;
+        data = job->data;
+        ++job->active;
+        g_mutex_unlock (pool->mutex);
+        function (data, thread);
+        g_mutex_lock (pool->mutex);
+
+        // the help function returns when all the job has been distributed
+        job->function = NULL;
+        __atomic_store_n (&job->active, job->active - 1, __ATOMIC_RELEASE);
+      }
+  g_mutex_unlock (pool->mutex);
+}
+
+/**
+ * Function executed by every worker thread of the pool.
+ *
+ * \return NULL.
+ */
+static gpointer
+pool_worker (gpointer data)     ///< thread number.
+{
+  unsigned int thread;
+  thread = GPOINTER_TO_UINT (data);
+#if DEBUG_POOL
+  fprintf (stderr, "pool_worker: start thread=%u\n", thread);
+#endif
+  pool_pin (thread);
+  while (1)
+    {
+      pool_barrier (thread);
+      if (!pool->function)
+        break;
+      pool->function (pool->data + thread * pool->size);
+      pool_barrier (thread);
+    }
+#if DEBUG_POOL
+  fprintf (stderr, "pool_worker: end thread=%u\n", thread);
+#endif
+  return NULL;
+}
+
+/**
+ * Function to get the data of a thread on the function executed by the pool.
+ *
+ * \return pointer to the data of the thread.
+ */
+void *
+pool_data (unsigned int thread) ///< thread number.
+{
+  return pool->data + thread * pool->size;
+}
+
+/**
+ * Function to execute a function on every thread of the pool. The calling
+ * thread works as the first thread of the pool and the function returns when
+ * all the threads have finished.
+ */
+void
+pool_run (PoolFunction function,        ///< function to execute.
+          void *data,
+          ///< array of data of every thread, the n-th thread uses the n-th
+          ///< element.
+          size_t size)          ///< size of every element of the data array.
+{
+  pool->function = function;
+  pool->data = (char *) data;
+  pool->size = size;
+  pool_barrier (0);
+  function (data);
+  pool_barrier (0);
+}
+
+/**
+ * Function to create the persistent pool of worker threads. The calling thread
+ * works as the first thread of the pool. With pinning every thread is pinned to
+ * a CPU or to the CPUs of a NUMA node before allocating its data, so the memory
+ * of the threads is first touched on its own NUMA node.
+ */
+void
+pool_init (unsigned int n,      ///< threads number.
+           unsigned int pinning)        ///< pinning type.
+{
+  unsigned int i;
+#if DEBUG_POOL
+  fprintf (stderr, "pool_init: start\n");
+#endif
+  g_mutex_init (pool->mutex);
+  g_cond_init (pool->cond);
+  pool->function = NULL;
+  pool->refill = NULL;
+  pool->nthreads = n;
+  pool->count = pool->generation = 0;
+  pool->thread = (GThread **) g_slice_alloc (n * sizeof (GThread *));
+  pool->range = (PoolRange *) g_slice_alloc0 (n * sizeof (PoolRange));
+  pool->job = (PoolJob *) g_slice_alloc0 (n * sizeof (PoolJob));
+#ifdef __linux__
+  pool_affinity (pinning);
+#endif
+  pool_pin (0);
+  for (i = 1; i < n; ++i)
+    pool->thread[i] = g_thread_new (NULL, pool_worker, GUINT_TO_POINTER (i));
+#if DEBUG_POOL
+  fprintf (stderr, "pool_init: end\n");
+#endif
+}
+
+/**
+ * Function to finish the worker threads and to free the memory used by the
+ * pool.
+ */
+void
+pool_free (void)
+{
+  unsigned int i;
+#if DEBUG_POOL
+  fprintf (stderr, "pool_free: start\n");
+#endif
+  pool->function = NULL;
+  pool_barrier (0);
+  for (i = 1; i < pool->nthreads; ++i)
+    g_thread_join (pool->thread[i]);
+#ifdef __linux__
+  if (pool->affinity)
+    g_slice_free1 (pool->nthreads * sizeof (cpu_set_t), pool->affinity);
+#endif
+  g_slice_free1 (pool->nthreads * sizeof (PoolJob), pool->job);
+  g_slice_free1 (pool->nthreads * sizeof (PoolRange), pool->range);
+  g_slice_free1 (pool->nthreads * sizeof (GThread *), pool->thread);
+  g_cond_clear (pool->cond);
+  g_mutex_clear (pool->mutex);
+#if DEBUG_POOL
+  fprintf (stderr, "pool_free: end\n");
+#endif
+}
@@ -0,0 +1,69 @@
+/*
+ODE: a program to get optime Runge-Kutta and multi-steps methods.
+
+Copyright 2011-2019, Javier Burguete Tolosa.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice,
+		this list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+		this list of conditions and the following disclaimer in the
+		documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY Javier Burguete Tolosa ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL Javier Burguete Tolosa OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+/**
+ * \file pool.h
+ * \brief Header file with the persistent pool of worker threads.
+ * \author Javier Burguete Tolosa.
+ * \copyright Copyright 2011-2019.
+ */
+#ifndef POOL__H
+#define POOL__H 1
+
+///> enumeration to define the pinning of the threads of the pool.
+enum PoolPinning
+{
+  POOL_PIN_NONE = 0,            ///< no pinning.
+  POOL_PIN_CORES = 1,           ///< every thread pinned to a CPU.
+  POOL_PIN_NUMA = 2             ///< every thread pinned to a NUMA node.
+};
+
+typedef void (*PoolFunction) (void *data);
+///< type of the functions executed by every thread of the pool.
+typedef void (*PoolHelp) (void *data, unsigned int thread);
+///< type of the functions to help on the jobs in flight of other threads.
+typedef int (*PoolRefill) (unsigned long long int *first,
+                           unsigned long long int *last);
+///< type of the functions to get new chunks of indexes when all the ranges of
+///< the threads are empty.
+
+int pool_range_next (unsigned int thread, unsigned long long int *first,
+                     unsigned long long int *last, unsigned int *range);
+void pool_range_init (unsigned long long int first,
+                      unsigned long long int last);
+void pool_range_refill (PoolRefill refill);
+void pool_job_post (unsigned int thread, PoolHelp function, void *data);
+void pool_job_remove (unsigned int thread);
+void pool_barrier (unsigned int thread);
+void *pool_data (unsigned int thread);
+void pool_run (PoolFunction function, void *data, size_t size);
+unsigned int pool_cpus (void);
+void pool_init (unsigned int n, unsigned int pinning);
+void pool_free (void);
+
+#endif
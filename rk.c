@@ -41,12 +41,12 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #if HAVE_MPI
 #include <mpi.h>
 #endif
 #include "config.h"
 #include "utils.h"
+#include "pool.h"
 #include "optimize.h"
 #include "rk.h"
 #include "rk_2_2.h"
@@ -64,6 +64,29 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define DEBUG_RK 0              ///< macro to debug.
 
+/**
+ * \struct RKJob
+ * \brief struct to define the sampling or the hill climbing probes of the a-c
+ *   Runge-Kutta coefficients of a thread, that the other threads can help to
+ *   perform.
+ */
+typedef struct
+{
+  RK snapshot[1];
+  ///< copy of the RK struct of the thread owning the job, taken when the job
+  ///< is posted and not modified while the job is in flight.
+  GMutex mutex[1];              ///< GMutex struct to update the optimal.
+  OptimizeProbes *probes;
+  ///< pointer to the probes of the hill climbing step (NULL on the sampling).
+  Real *value_optimal;
+  ///< array of optimal values of the freedom degrees.
+  Real optimal;                 ///< optimal objective function value.
+  unsigned long long int index; ///< simulation number of the optimal.
+  unsigned long long int next;  ///< next simulation to distribute.
+  unsigned long long int last;  ///< end of the simulations.
+  unsigned long long int chunk; ///< number of simulations to get every time.
+} RKJob;
+
 /**
  * Function to print the t-b Runge-Kutta coefficients.
  */
@@ -72,15 +95,15 @@ rk_print_tb (Optimize * tb,     ///< Optimize struct.
              char *label,       ///< label.
              FILE * file)       ///< file.
 {
-  long double *x;
+  Real *x;
   unsigned int i, j, k;
   x = tb->coefficient;
-  fprintf (file, "%s: t1=%.19Le\n", label, x[0]);
+  fprintf (file, "%s: t1=" REAL_E "\n", label, real_e (x[0]));
   for (i = 2, k = 0; i <= tb->nsteps; ++i)
     {
-      fprintf (file, "%s: t%u=%.19Le\n", label, i, x[++k]);
+      fprintf (file, "%s: t%u=" REAL_E "\n", label, i, real_e (x[++k]));
       for (j = 0; j < i; ++j)
-        fprintf (file, "%s: b%u%u=%.19Le\n", label, i, j, x[++k]);
+        fprintf (file, "%s: b%u%u=" REAL_E "\n", label, i, j, real_e (x[++k]));
     }
 }
 
@@ -92,13 +115,13 @@ rk_print_e (Optimize * tb,      ///< Optimize struct.
             char *label,        ///< label.
             FILE * file)        ///< file.
 {
-  long double *x;
+  Real *x;
   unsigned int i, k, nsteps;
   x = tb->coefficient;
   nsteps = tb->nsteps;
   k = (nsteps + 2) * (nsteps + 1) / 2 - 2;
   for (i = 0; i < nsteps - 1; ++i)
-    fprintf (file, "%s: e%u%u=%.19Le\n", label, nsteps, i, x[k++]);
+    fprintf (file, "%s: e%u%u=" REAL_E "\n", label, nsteps, i, real_e (x[k++]));
 }
 
 /**
@@ -109,29 +132,29 @@ rk_print (RK * rk,              ///< RK struct.
           FILE * file)          ///< file.
 {
   Optimize *tb, *ac;
-  long double *x, *y;
+  Real *x, *y;
   unsigned int i, j, k, l, nsteps;
   tb = rk->tb;
   ac = rk->ac;
   x = tb->coefficient;
   y = ac->coefficient;
-  fprintf (file, "t1:%.19Le;\n", x[0]);
+  fprintf (file, "t1:" REAL_E ";\n", real_e (x[0]));
   nsteps = tb->nsteps;
   for (i = 2, k = l = 0; i <= nsteps; ++i)
     {
-      fprintf (file, "t%u:%.19Le;\n", i, x[++k]);
+      fprintf (file, "t%u:" REAL_E ";\n", i, real_e (x[++k]));
       for (j = 0; j < i; ++j)
-        fprintf (file, "b%u%u:%.19Le;\n", i, j, x[++k]);
+        fprintf (file, "b%u%u:" REAL_E ";\n", i, j, real_e (x[++k]));
       if (!rk->strong)
         continue;
       for (j = 0; j < i; ++j)
-        fprintf (file, "a%u%u:%.19Le;\n", i, j, y[l++]);
+        fprintf (file, "a%u%u:" REAL_E ";\n", i, j, real_e (y[l++]));
       for (j = 0; j < i; ++j)
-        fprintf (file, "c%u%u:%.19Le;\n", i, j, y[l++]);
+        fprintf (file, "c%u%u:" REAL_E ";\n", i, j, real_e (y[l++]));
     }
   if (rk->pair)
     for (i = 0; i < nsteps - 1; ++i)
-      fprintf (file, "e%u%u:%.19Le;\n", nsteps, i, x[++k]);
+      fprintf (file, "e%u%u:" REAL_E ";\n", nsteps, i, real_e (x[++k]));
 }
 
 /**
@@ -334,6 +357,43 @@ ac_print_maxima (FILE * file,   ///< file.
     }
 }
 
+/**
+ * Function to check if a simulation of the a-c Runge-Kutta coefficients can be
+ * rejected after getting the coefficients of a step. The penalties of the
+ * negative a and c coefficients of the step and the maximum of its c
+ * coefficients are lower bounds of the objective function value of the
+ * rk_objective_ac_N functions.
+ *
+ * \return 1 if the simulation is rejected, 0 otherwise.
+ */
+static inline int
+rk_ac_reject (RK * rk,          ///< RK struct.
+              unsigned int i)   ///< step number.
+{
+  Real *a, *c;
+  Real ka, kc, m;
+  unsigned int j;
+  a = rk->ac->coefficient + i * (i - 1) - 2;
+  c = a + i;
+  ka = kc = REAL (0.);
+  m = t1 (rk->tb->coefficient);
+  for (j = 0; j < i; ++j)
+    {
+      if (a[j] < REAL (0.))
+        ka += a[j];
+      if (c[j] < REAL (0.))
+        kc += c[j];
+      m = fmaxr (m, c[j]);
+    }
+  if (ka < REAL (0.))
+    return optimize_reject (rk->ac, REAL (20.) - ka, OPTIMIZE_REJECT_SIGN);
+  if (kc < REAL (0.))
+    return optimize_reject (rk->ac, fminr (REAL (20.), REAL (10.) - kc),
+                            OPTIMIZE_REJECT_SIGN);
+  return optimize_reject (rk->ac, fminr (REAL (10.), m),
+                          OPTIMIZE_REJECT_BOUND);
+}
+
 /**
  * Function to get \f$a_{ij}\f$ and \f$c_{ij}\f$ coefficients of the Runge-Kutta
  * 2nd step.
@@ -341,8 +401,8 @@ ac_print_maxima (FILE * file,   ///< file.
 static int
 rk_ac_2 (RK * rk)               ///< RK struct.
 {
-  long double *tb, *ac, *r;
-  register long double ac0;
+  Real *tb, *ac, *r;
+  register Real ac0;
 #if DEBUG_RK
   fprintf (stderr, "rk_ac_2: start\n");
 #endif
@@ -351,12 +411,14 @@ rk_ac_2 (RK * rk)               ///< RK struct.
   r = rk->ac->random_data;
   c21 (ac) = r[0];
   a21 (ac) = b21 (tb) / c21 (ac);
-  a20 (ac) = 1.L - a21 (ac);
+  a20 (ac) = REAL (1.) - a21 (ac);
   ac0 = b20 (tb) - a21 (ac) * t1 (tb);
-  c20 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / a20 (ac);
+  c20 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / a20 (ac);
 #if DEBUG_RK
-  fprintf (stderr, "rk_ac_2: a20=%Lg c20=%Lg\n", a20 (ac), c20 (ac));
-  fprintf (stderr, "rk_ac_2: a21=%Lg c21=%Lg\n", a21 (ac), c21 (ac));
+  fprintf (stderr, "rk_ac_2: a20=" REAL_G " c20=" REAL_G "\n",
+           real_g (a20 (ac)), real_g (c20 (ac)));
+  fprintf (stderr, "rk_ac_2: a21=" REAL_G " c21=" REAL_G "\n",
+           real_g (a21 (ac)), real_g (c21 (ac)));
   fprintf (stderr, "rk_ac_2: end\n");
 #endif
   if (isnan (c20 (ac)) || isnan (a21 (ac)))
@@ -371,12 +433,12 @@ rk_ac_2 (RK * rk)               ///< RK struct.
 static int
 rk_ac_3 (RK * rk)               ///< RK struct.
 {
-  long double *tb, *ac, *r;
-  register long double ac0;
+  Real *tb, *ac, *r;
+  register Real ac0;
 #if DEBUG_RK
   fprintf (stderr, "rk_ac_3: start\n");
 #endif
-  if (!rk_ac_2 (rk))
+  if (!rk_ac_2 (rk) || rk_ac_reject (rk, 2))
     {
 #if DEBUG_RK
       fprintf (stderr, "rk_ac_3: end\n");
@@ -390,14 +452,17 @@ rk_ac_3 (RK * rk)               ///< RK struct.
   c32 (ac) = r[2];
   a32 (ac) = b32 (tb) / c32 (ac);
   ac0 = b31 (tb) - a32 (ac) * b21 (tb);
-  a31 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / c31 (ac);
-  a30 (ac) = 1.L - a31 (ac) - a32 (ac);
+  a31 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / c31 (ac);
+  a30 (ac) = REAL (1.) - a31 (ac) - a32 (ac);
   ac0 = b30 (tb) - a31 (ac) * t1 (tb) - a32 (ac) * b20 (tb);
-  c30 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / a30 (ac);
-#if DEBUG_RK
-  fprintf (stderr, "rk_ac_3: a30=%Lg c30=%Lg\n", a30 (ac), c30 (ac));
-  fprintf (stderr, "rk_ac_3: a31=%Lg c31=%Lg\n", a31 (ac), c31 (ac));
-  fprintf (stderr, "rk_ac_3: a32=%Lg c32=%Lg\n", a32 (ac), c32 (ac));
+  c30 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / a30 (ac);
+#if DEBUG_RK
+  fprintf (stderr, "rk_ac_3: a30=" REAL_G " c30=" REAL_G "\n",
+           real_g (a30 (ac)), real_g (c30 (ac)));
+  fprintf (stderr, "rk_ac_3: a31=" REAL_G " c31=" REAL_G "\n",
+           real_g (a31 (ac)), real_g (c31 (ac)));
+  fprintf (stderr, "rk_ac_3: a32=" REAL_G " c32=" REAL_G "\n",
+           real_g (a32 (ac)), real_g (c32 (ac)));
   fprintf (stderr, "rk_ac_3: end\n");
 #endif
   if (isnan (c30 (ac)) || isnan (a31 (ac)) || isnan (a32 (ac)))
@@ -412,12 +477,12 @@ rk_ac_3 (RK * rk)               ///< RK struct.
 static int
 rk_ac_4 (RK * rk)               ///< RK struct.
 {
-  long double *tb, *ac, *r;
-  register long double ac0;
+  Real *tb, *ac, *r;
+  register Real ac0;
 #if DEBUG_RK
   fprintf (stderr, "rk_ac_4: start\n");
 #endif
-  if (!rk_ac_3 (rk))
+  if (!rk_ac_3 (rk) || rk_ac_reject (rk, 3))
     {
 #if DEBUG_RK
       fprintf (stderr, "rk_ac_4: end\n");
@@ -432,18 +497,22 @@ rk_ac_4 (RK * rk)               ///< RK struct.
   c43 (ac) = r[5];
   a43 (ac) = b43 (tb) / c43 (ac);
   ac0 = b42 (tb) - a43 (ac) * b32 (tb);
-  a42 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / c42 (ac);
+  a42 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / c42 (ac);
   ac0 = b41 (tb) - a42 (ac) * b21 (tb) - a43 (ac) * b31 (tb);
-  a41 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / c41 (ac);
-  a40 (ac) = 1.L - a41 (ac) - a42 (ac) - a43 (ac);
+  a41 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / c41 (ac);
+  a40 (ac) = REAL (1.) - a41 (ac) - a42 (ac) - a43 (ac);
   ac0 = b40 (tb) - a41 (ac) * t1 (tb) - a42 (ac) * b20 (tb)
     - a43 (ac) * b30 (tb);
-  c40 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / a40 (ac);
-#if DEBUG_RK
-  fprintf (stderr, "rk_ac_4: a40=%Lg c40=%Lg\n", a40 (ac), c40 (ac));
-  fprintf (stderr, "rk_ac_4: a41=%Lg c41=%Lg\n", a41 (ac), c41 (ac));
-  fprintf (stderr, "rk_ac_4: a42=%Lg c42=%Lg\n", a42 (ac), c42 (ac));
-  fprintf (stderr, "rk_ac_4: a43=%Lg c43=%Lg\n", a43 (ac), c43 (ac));
+  c40 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / a40 (ac);
+#if DEBUG_RK
+  fprintf (stderr, "rk_ac_4: a40=" REAL_G " c40=" REAL_G "\n",
+           real_g (a40 (ac)), real_g (c40 (ac)));
+  fprintf (stderr, "rk_ac_4: a41=" REAL_G " c41=" REAL_G "\n",
+           real_g (a41 (ac)), real_g (c41 (ac)));
+  fprintf (stderr, "rk_ac_4: a42=" REAL_G " c42=" REAL_G "\n",
+           real_g (a42 (ac)), real_g (c42 (ac)));
+  fprintf (stderr, "rk_ac_4: a43=" REAL_G " c43=" REAL_G "\n",
+           real_g (a43 (ac)), real_g (c43 (ac)));
   fprintf (stderr, "rk_ac_4: end\n");
 #endif
   if (isnan (c40 (ac)) || isnan (a41 (ac)) || isnan (a42 (ac))
@@ -459,12 +528,12 @@ rk_ac_4 (RK * rk)               ///< RK struct.
 static int
 rk_ac_5 (RK * rk)               ///< RK struct.
 {
-  long double *tb, *ac, *r;
-  register long double ac0;
+  Real *tb, *ac, *r;
+  register Real ac0;
 #if DEBUG_RK
   fprintf (stderr, "rk_ac_5: start\n");
 #endif
-  if (!rk_ac_4 (rk))
+  if (!rk_ac_4 (rk) || rk_ac_reject (rk, 4))
     {
 #if DEBUG_RK
       fprintf (stderr, "rk_ac_5: end\n");
@@ -480,22 +549,27 @@ rk_ac_5 (RK * rk)               ///< RK struct.
   c54 (ac) = r[9];
   a54 (ac) = b54 (tb) / c54 (ac);
   ac0 = b53 (tb) - a54 (ac) * b43 (tb);
-  a53 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / c53 (ac);
+  a53 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / c53 (ac);
   ac0 = b52 (tb) - a53 (ac) * b32 (tb) - a54 (ac) * b42 (tb);
-  a52 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / c52 (ac);
+  a52 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / c52 (ac);
   ac0 = b51 (tb) - a52 (ac) * b21 (tb) - a53 (ac) * b31 (tb)
     - a54 (ac) * b41 (tb);
-  a51 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / c51 (ac);
-  a50 (ac) = 1.L - a51 (ac) - a52 (ac) - a53 (ac) - a54 (ac);
+  a51 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / c51 (ac);
+  a50 (ac) = REAL (1.) - a51 (ac) - a52 (ac) - a53 (ac) - a54 (ac);
   ac0 = b50 (tb) - a51 (ac) * t1 (tb) - a52 (ac) * b20 (tb)
     - a53 (ac) * b30 (tb) - a54 (ac) * b40 (tb);
-  c50 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / a50 (ac);
-#if DEBUG_RK
-  fprintf (stderr, "rk_ac_5: a50=%Lg c50=%Lg\n", a50 (ac), c50 (ac));
-  fprintf (stderr, "rk_ac_5: a51=%Lg c51=%Lg\n", a51 (ac), c51 (ac));
-  fprintf (stderr, "rk_ac_5: a52=%Lg c52=%Lg\n", a52 (ac), c52 (ac));
-  fprintf (stderr, "rk_ac_5: a53=%Lg c53=%Lg\n", a53 (ac), c53 (ac));
-  fprintf (stderr, "rk_ac_5: a54=%Lg c54=%Lg\n", a54 (ac), c54 (ac));
+  c50 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / a50 (ac);
+#if DEBUG_RK
+  fprintf (stderr, "rk_ac_5: a50=" REAL_G " c50=" REAL_G "\n",
+           real_g (a50 (ac)), real_g (c50 (ac)));
+  fprintf (stderr, "rk_ac_5: a51=" REAL_G " c51=" REAL_G "\n",
+           real_g (a51 (ac)), real_g (c51 (ac)));
+  fprintf (stderr, "rk_ac_5: a52=" REAL_G " c52=" REAL_G "\n",
+           real_g (a52 (ac)), real_g (c52 (ac)));
+  fprintf (stderr, "rk_ac_5: a53=" REAL_G " c53=" REAL_G "\n",
+           real_g (a53 (ac)), real_g (c53 (ac)));
+  fprintf (stderr, "rk_ac_5: a54=" REAL_G " c54=" REAL_G "\n",
+           real_g (a54 (ac)), real_g (c54 (ac)));
   fprintf (stderr, "rk_ac_5: end\n");
 #endif
   if (isnan (c50 (ac)) || isnan (a51 (ac)) || isnan (a52 (ac))
@@ -511,12 +585,12 @@ rk_ac_5 (RK * rk)               ///< RK struct.
 static int
 rk_ac_6 (RK * rk)               ///< RK struct.
 {
-  long double *tb, *ac, *r;
-  register long double ac0;
+  Real *tb, *ac, *r;
+  register Real ac0;
 #if DEBUG_RK
   fprintf (stderr, "rk_ac_6: start\n");
 #endif
-  if (!rk_ac_5 (rk))
+  if (!rk_ac_5 (rk) || rk_ac_reject (rk, 5))
     {
 #if DEBUG_RK
       fprintf (stderr, "rk_ac_6: end\n");
@@ -533,26 +607,32 @@ rk_ac_6 (RK * rk)               ///< RK struct.
   c65 (ac) = r[14];
   a65 (ac) = b65 (tb) / c65 (ac);
   ac0 = b64 (tb) - a65 (ac) * b54 (tb);
-  a64 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / c64 (ac);
+  a64 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / c64 (ac);
   ac0 = b63 (tb) - a64 (ac) * b43 (tb) - a65 (ac) * b53 (tb);
-  a63 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / c63 (ac);
+  a63 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / c63 (ac);
   ac0 = b62 (tb) - a63 (ac) * b32 (tb) - a64 (ac) * b42 (tb)
     - a65 (ac) * b52 (tb);
-  a62 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / c62 (ac);
+  a62 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / c62 (ac);
   ac0 = b61 (tb) - a62 (ac) * b21 (tb) - a63 (ac) * b31 (tb)
     - a64 (ac) * b41 (tb) - a65 (ac) * b51 (tb);
-  a61 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / c61 (ac);
-  a60 (ac) = 1.L - a61 (ac) - a62 (ac) - a63 (ac) - a64 (ac) - a65 (ac);
+  a61 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / c61 (ac);
+  a60 (ac) = REAL (1.) - a61 (ac) - a62 (ac) - a63 (ac) - a64 (ac) - a65 (ac);
   ac0 = b60 (tb) - a61 (ac) * t1 (tb) - a62 (ac) * b20 (tb)
     - a63 (ac) * b30 (tb) - a64 (ac) * b40 (tb) - a65 (ac) * b50 (tb);
-  c60 (ac) = fabsl (ac0) < LDBL_EPSILON ? 0.L : ac0 / a60 (ac);
-#if DEBUG_RK
-  fprintf (stderr, "rk_ac_6: a60=%Lg c60=%Lg\n", a60 (ac), c60 (ac));
-  fprintf (stderr, "rk_ac_6: a61=%Lg c61=%Lg\n", a61 (ac), c61 (ac));
-  fprintf (stderr, "rk_ac_6: a62=%Lg c62=%Lg\n", a62 (ac), c62 (ac));
-  fprintf (stderr, "rk_ac_6: a63=%Lg c63=%Lg\n", a63 (ac), c63 (ac));
-  fprintf (stderr, "rk_ac_6: a64=%Lg c64=%Lg\n", a64 (ac), c64 (ac));
-  fprintf (stderr, "rk_ac_6: a65=%Lg c65=%Lg\n", a65 (ac), c65 (ac));
+  c60 (ac) = fabsr (ac0) < REAL_EPSILON ? REAL (0.) : ac0 / a60 (ac);
+#if DEBUG_RK
+  fprintf (stderr, "rk_ac_6: a60=" REAL_G " c60=" REAL_G "\n",
+           real_g (a60 (ac)), real_g (c60 (ac)));
+  fprintf (stderr, "rk_ac_6: a61=" REAL_G " c61=" REAL_G "\n",
+           real_g (a61 (ac)), real_g (c61 (ac)));
+  fprintf (stderr, "rk_ac_6: a62=" REAL_G " c62=" REAL_G "\n",
+           real_g (a62 (ac)), real_g (c62 (ac)));
+  fprintf (stderr, "rk_ac_6: a63=" REAL_G " c63=" REAL_G "\n",
+           real_g (a63 (ac)), real_g (c63 (ac)));
+  fprintf (stderr, "rk_ac_6: a64=" REAL_G " c64=" REAL_G "\n",
+           real_g (a64 (ac)), real_g (c64 (ac)));
+  fprintf (stderr, "rk_ac_6: a65=" REAL_G " c65=" REAL_G "\n",
+           real_g (a65 (ac)), real_g (c65 (ac)));
   fprintf (stderr, "rk_ac_6: end\n");
 #endif
   if (isnan (c60 (ac)) || isnan (a61 (ac)) || isnan (a62 (ac))
@@ -566,36 +646,36 @@ rk_ac_6 (RK * rk)               ///< RK struct.
  *
  * \return objective function value.
  */
-static long double
+static Real
 rk_objective_ac_2 (RK * rk)     ///< RK struct.
 {
-  long double *tb, *ac;
-  long double k;
+  Real *tb, *ac;
+  Real k;
 #if DEBUG_RK
   fprintf (stderr, "rk_objective ac_2: start\n");
 #endif
   tb = rk->tb->coefficient;
   ac = rk->ac->coefficient;
-  k = fminl (0.L, a20 (ac));
-  if (a21 (ac) < 0.L)
+  k = fminr (REAL (0.), a20 (ac));
+  if (a21 (ac) < REAL (0.))
     k += a21 (ac);
-  if (k < 0.L)
+  if (k < REAL (0.))
     {
-      k = 20.L - k;
+      k = REAL (20.) - k;
       goto end;
     }
-  k = fminl (0.L, c20 (ac));
-  if (c21 (ac) < 0.L)
+  k = fminr (REAL (0.), c20 (ac));
+  if (c21 (ac) < REAL (0.))
     k += c21 (ac);
-  if (k < 0.L)
+  if (k < REAL (0.))
     {
-      k = 10.L - k;
+      k = REAL (10.) - k;
       goto end;
     }
-  k = 1.L / rk_cfl_2 (tb, ac);
+  k = REAL (1.) / rk_cfl_2 (tb, ac);
 end:
 #if DEBUG_RK
-  fprintf (stderr, "rk_objective ac_2: objective=%Lg\n", k);
+  fprintf (stderr, "rk_objective ac_2: objective=" REAL_G "\n", real_g (k));
   fprintf (stderr, "rk_objective ac_2: end\n");
 #endif
   return k;
@@ -606,48 +686,48 @@ end:
  *
  * \return objective function value.
  */
-static long double
+static Real
 rk_objective_ac_3 (RK * rk)     ///< RK struct.
 {
-  long double *tb, *ac;
-  long double k;
+  Real *tb, *ac;
+  Real k;
 #if DEBUG_RK
   fprintf (stderr, "rk_objective ac_3: start\n");
 #endif
   tb = rk->tb->coefficient;
   ac = rk->ac->coefficient;
-  k = fminl (0.L, a20 (ac));
-  if (a21 (ac) < 0.L)
+  k = fminr (REAL (0.), a20 (ac));
+  if (a21 (ac) < REAL (0.))
     k += a21 (ac);
-  if (a30 (ac) < 0.L)
+  if (a30 (ac) < REAL (0.))
     k += a30 (ac);
-  if (a31 (ac) < 0.L)
+  if (a31 (ac) < REAL (0.))
     k += a31 (ac);
-  if (a32 (ac) < 0.L)
+  if (a32 (ac) < REAL (0.))
     k += a32 (ac);
-  if (k < 0.L)
+  if (k < REAL (0.))
     {
-      k = 20.L - k;
+      k = REAL (20.) - k;
       goto end;
     }
-  k = fminl (0.L, c20 (ac));
-  if (c21 (ac) < 0.L)
+  k = fminr (REAL (0.), c20 (ac));
+  if (c21 (ac) < REAL (0.))
     k += c21 (ac);
-  if (c30 (ac) < 0.L)
+  if (c30 (ac) < REAL (0.))
     k += c30 (ac);
-  if (c31 (ac) < 0.L)
+  if (c31 (ac) < REAL (0.))
     k += c31 (ac);
-  if (c32 (ac) < 0.L)
+  if (c32 (ac) < REAL (0.))
     k += c32 (ac);
-  if (k < 0.L)
+  if (k < REAL (0.))
     {
-      k = 10.L - k;
+      k = REAL (10.) - k;
       goto end;
     }
-  k = 1.L / rk_cfl_3 (tb, ac);
+  k = REAL (1.) / rk_cfl_3 (tb, ac);
 end:
 #if DEBUG_RK
-  fprintf (stderr, "rk_objective ac_3: objective=%Lg\n", k);
+  fprintf (stderr, "rk_objective ac_3: objective=" REAL_G "\n", real_g (k));
   fprintf (stderr, "rk_objective ac_3: end\n");
 #endif
   return k;
@@ -658,64 +738,64 @@ end:
  *
  * \return objective function value.
  */
-static long double
+static Real
 rk_objective_ac_4 (RK * rk)     ///< RK struct.
 {
-  long double *tb, *ac;
-  long double k;
+  Real *tb, *ac;
+  Real k;
 #if DEBUG_RK
   fprintf (stderr, "rk_objective ac_4: start\n");
 #endif
   tb = rk->tb->coefficient;
   ac = rk->ac->coefficient;
-  k = fminl (0.L, a20 (ac));
-  if (a21 (ac) < 0.L)
+  k = fminr (REAL (0.), a20 (ac));
+  if (a21 (ac) < REAL (0.))
     k += a21 (ac);
-  if (a30 (ac) < 0.L)
+  if (a30 (ac) < REAL (0.))
     k += a30 (ac);
-  if (a31 (ac) < 0.L)
+  if (a31 (ac) < REAL (0.))
     k += a31 (ac);
-  if (a32 (ac) < 0.L)
+  if (a32 (ac) < REAL (0.))
     k += a32 (ac);
-  if (a40 (ac) < 0.L)
+  if (a40 (ac) < REAL (0.))
     k += a40 (ac);
-  if (a41 (ac) < 0.L)
+  if (a41 (ac) < REAL (0.))
     k += a41 (ac);
-  if (a42 (ac) < 0.L)
+  if (a42 (ac) < REAL (0.))
     k += a42 (ac);
-  if (a43 (ac) < 0.L)
+  if (a43 (ac) < REAL (0.))
     k += a43 (ac);
-  if (k < 0.L)
+  if (k < REAL (0.))
     {
-      k = 20.L - k;
+      k = REAL (20.) - k;
       goto end;
     }
-  k = fminl (0.L, c20 (ac));
-  if (c21 (ac) < 0.L)
+  k = fminr (REAL (0.), c20 (ac));
+  if (c21 (ac) < REAL (0.))
     k += c21 (ac);
-  if (c30 (ac) < 0.L)
+  if (c30 (ac) < REAL (0.))
     k += c30 (ac);
-  if (c31 (ac) < 0.L)
+  if (c31 (ac) < REAL (0.))
     k += c31 (ac);
-  if (c32 (ac) < 0.L)
+  if (c32 (ac) < REAL (0.))
     k += c32 (ac);
-  if (c40 (ac) < 0.L)
+  if (c40 (ac) < REAL (0.))
     k += c40 (ac);
-  if (c41 (ac) < 0.L)
+  if (c41 (ac) < REAL (0.))
     k += c41 (ac);
-  if (c42 (ac) < 0.L)
+  if (c42 (ac) < REAL (0.))
     k += c42 (ac);
-  if (c43 (ac) < 0.L)
+  if (c43 (ac) < REAL (0.))
     k += c43 (ac);
-  if (k < 0.L)
+  if (k < REAL (0.))
     {
-      k = 10.L - k;
+      k = REAL (10.) - k;
       goto end;
     }
-  k = 1.L / rk_cfl_4 (tb, ac);
+  k = REAL (1.) / rk_cfl_4 (tb, ac);
 end:
 #if DEBUG_RK
-  fprintf (stderr, "rk_objective ac_4: objective=%Lg\n", k);
+  fprintf (stderr, "rk_objective ac_4: objective=" REAL_G "\n", real_g (k));
   fprintf (stderr, "rk_objective ac_4: end\n");
 #endif
   return k;
@@ -726,84 +806,84 @@ end:
  *
  * \return objective function value.
  */
-static long double
+static Real
 rk_objective_ac_5 (RK * rk)     ///< RK struct.
 {
-  long double *tb, *ac;
-  long double k;
+  Real *tb, *ac;
+  Real k;
 #if DEBUG_RK
   fprintf (stderr, "rk_objective ac_5: start\n");
 #endif
   tb = rk->tb->coefficient;
   ac = rk->ac->coefficient;
-  k = fminl (0.L, a20 (ac));
-  if (a21 (ac) < 0.L)
+  k = fminr (REAL (0.), a20 (ac));
+  if (a21 (ac) < REAL (0.))
     k += a21 (ac);
-  if (a30 (ac) < 0.L)
+  if (a30 (ac) < REAL (0.))
     k += a30 (ac);
-  if (a31 (ac) < 0.L)
+  if (a31 (ac) < REAL (0.))
     k += a31 (ac);
-  if (a32 (ac) < 0.L)
+  if (a32 (ac) < REAL (0.))
     k += a32 (ac);
-  if (a40 (ac) < 0.L)
+  if (a40 (ac) < REAL (0.))
     k += a40 (ac);
-  if (a41 (ac) < 0.L)
+  if (a41 (ac) < REAL (0.))
     k += a41 (ac);
-  if (a42 (ac) < 0.L)
+  if (a42 (ac) < REAL (0.))
     k += a42 (ac);
-  if (a43 (ac) < 0.L)
+  if (a43 (ac) < REAL (0.))
     k += a43 (ac);
-  if (a50 (ac) < 0.L)
+  if (a50 (ac) < REAL (0.))
     k += a50 (ac);
-  if (a51 (ac) < 0.L)
+  if (a51 (ac) < REAL (0.))
     k += a51 (ac);
-  if (a52 (ac) < 0.L)
+  if (a52 (ac) < REAL (0.))
     k += a52 (ac);
-  if (a53 (ac) < 0.L)
+  if (a53 (ac) < REAL (0.))
     k += a53 (ac);
-  if (a54 (ac) < 0.L)
+  if (a54 (ac) < REAL (0.))
     k += a54 (ac);
-  if (k < 0.L)
+  if (k < REAL (0.))
     {
-      k = 20.L - k;
+      k = REAL (20.) - k;
       goto end;
     }
-  k = fminl (0.L, c20 (ac));
-  if (c21 (ac) < 0.L)
+  k = fminr (REAL (0.), c20 (ac));
+  if (c21 (ac) < REAL (0.))
     k += c21 (ac);
-  if (c30 (ac) < 0.L)
+  if (c30 (ac) < REAL (0.))
     k += c30 (ac);
-  if (c31 (ac) < 0.L)
+  if (c31 (ac) < REAL (0.))
     k += c31 (ac);
-  if (c32 (ac) < 0.L)
+  if (c32 (ac) < REAL (0.))
     k += c32 (ac);
-  if (c40 (ac) < 0.L)
+  if (c40 (ac) < REAL (0.))
     k += c40 (ac);
-  if (c41 (ac) < 0.L)
+  if (c41 (ac) < REAL (0.))
     k += c41 (ac);
-  if (c42 (ac) < 0.L)
+  if (c42 (ac) < REAL (0.))
     k += c42 (ac);
-  if (c43 (ac) < 0.L)
+  if (c43 (ac) < REAL (0.))
     k += c43 (ac);
-  if (c50 (ac) < 0.L)
+  if (c50 (ac) < REAL (0.))
     k += c50 (ac);
-  if (c51 (ac) < 0.L)
+  if (c51 (ac) < REAL (0.))
     k += c51 (ac);
-  if (c52 (ac) < 0.L)
+  if (c52 (ac) < REAL (0.))
     k += c52 (ac);
-  if (c53 (ac) < 0.L)
+  if (c53 (ac) < REAL (0.))
     k += c53 (ac);
-  if (c54 (ac) < 0.L)
+  if (c54 (ac) < REAL (0.))
     k += c54 (ac);
-  if (k < 0.L)
+  if (k < REAL (0.))
     {
-      k = 10.L - k;
+      k = REAL (10.) - k;
       goto end;
     }
-  k = 1.L / rk_cfl_5 (tb, ac);
+  k = REAL (1.) / rk_cfl_5 (tb, ac);
 end:
 #if DEBUG_RK
-  fprintf (stderr, "rk_objective ac_5: objective=%Lg\n", k);
+  fprintf (stderr, "rk_objective ac_5: objective=" REAL_G "\n", real_g (k));
   fprintf (stderr, "rk_objective ac_5: end\n");
 #endif
   return k;
@@ -814,124 +894,276 @@ end:
  *
  * \return objective function value.
  */
-static long double
+static Real
 rk_objective_ac_6 (RK * rk)     ///< RK struct.
 {
-  long double *tb, *ac;
-  long double k;
+  Real *tb, *ac;
+  Real k;
 #if DEBUG_RK
   fprintf (stderr, "rk_objective ac_6: start\n");
 #endif
   tb = rk->tb->coefficient;
   ac = rk->ac->coefficient;
-  k = fminl (0.L, a20 (ac));
-  if (a21 (ac) < 0.L)
+  k = fminr (REAL (0.), a20 (ac));
+  if (a21 (ac) < REAL (0.))
     k += a21 (ac);
-  if (a30 (ac) < 0.L)
+  if (a30 (ac) < REAL (0.))
     k += a30 (ac);
-  if (a31 (ac) < 0.L)
+  if (a31 (ac) < REAL (0.))
     k += a31 (ac);
-  if (a32 (ac) < 0.L)
+  if (a32 (ac) < REAL (0.))
     k += a32 (ac);
-  if (a40 (ac) < 0.L)
+  if (a40 (ac) < REAL (0.))
     k += a40 (ac);
-  if (a41 (ac) < 0.L)
+  if (a41 (ac) < REAL (0.))
     k += a41 (ac);
-  if (a42 (ac) < 0.L)
+  if (a42 (ac) < REAL (0.))
     k += a42 (ac);
-  if (a43 (ac) < 0.L)
+  if (a43 (ac) < REAL (0.))
     k += a43 (ac);
-  if (a50 (ac) < 0.L)
+  if (a50 (ac) < REAL (0.))
     k += a50 (ac);
-  if (a51 (ac) < 0.L)
+  if (a51 (ac) < REAL (0.))
     k += a51 (ac);
-  if (a52 (ac) < 0.L)
+  if (a52 (ac) < REAL (0.))
     k += a52 (ac);
-  if (a53 (ac) < 0.L)
+  if (a53 (ac) < REAL (0.))
     k += a53 (ac);
-  if (a54 (ac) < 0.L)
+  if (a54 (ac) < REAL (0.))
     k += a54 (ac);
-  if (a60 (ac) < 0.L)
+  if (a60 (ac) < REAL (0.))
     k += a60 (ac);
-  if (a61 (ac) < 0.L)
+  if (a61 (ac) < REAL (0.))
     k += a61 (ac);
-  if (a62 (ac) < 0.L)
+  if (a62 (ac) < REAL (0.))
     k += a62 (ac);
-  if (a63 (ac) < 0.L)
+  if (a63 (ac) < REAL (0.))
     k += a63 (ac);
-  if (a64 (ac) < 0.L)
+  if (a64 (ac) < REAL (0.))
     k += a64 (ac);
-  if (a65 (ac) < 0.L)
+  if (a65 (ac) < REAL (0.))
     k += a65 (ac);
-  if (k < 0.L)
+  if (k < REAL (0.))
     {
-      k = 20.L - k;
+      k = REAL (20.) - k;
       goto end;
     }
-  k = fminl (0.L, c20 (ac));
-  if (c21 (ac) < 0.L)
+  k = fminr (REAL (0.), c20 (ac));
+  if (c21 (ac) < REAL (0.))
     k += c21 (ac);
-  if (c30 (ac) < 0.L)
+  if (c30 (ac) < REAL (0.))
     k += c30 (ac);
-  if (c31 (ac) < 0.L)
+  if (c31 (ac) < REAL (0.))
     k += c31 (ac);
-  if (c32 (ac) < 0.L)
+  if (c32 (ac) < REAL (0.))
     k += c32 (ac);
-  if (c40 (ac) < 0.L)
+  if (c40 (ac) < REAL (0.))
     k += c40 (ac);
-  if (c41 (ac) < 0.L)
+  if (c41 (ac) < REAL (0.))
     k += c41 (ac);
-  if (c42 (ac) < 0.L)
+  if (c42 (ac) < REAL (0.))
     k += c42 (ac);
-  if (c43 (ac) < 0.L)
+  if (c43 (ac) < REAL (0.))
     k += c43 (ac);
-  if (c50 (ac) < 0.L)
+  if (c50 (ac) < REAL (0.))
     k += c50 (ac);
-  if (c51 (ac) < 0.L)
+  if (c51 (ac) < REAL (0.))
     k += c51 (ac);
-  if (c52 (ac) < 0.L)
+  if (c52 (ac) < REAL (0.))
     k += c52 (ac);
-  if (c53 (ac) < 0.L)
+  if (c53 (ac) < REAL (0.))
     k += c53 (ac);
-  if (c54 (ac) < 0.L)
+  if (c54 (ac) < REAL (0.))
     k += c54 (ac);
-  if (c60 (ac) < 0.L)
+  if (c60 (ac) < REAL (0.))
     k += c60 (ac);
-  if (c61 (ac) < 0.L)
+  if (c61 (ac) < REAL (0.))
     k += c61 (ac);
-  if (c62 (ac) < 0.L)
+  if (c62 (ac) < REAL (0.))
     k += c62 (ac);
-  if (c63 (ac) < 0.L)
+  if (c63 (ac) < REAL (0.))
     k += c63 (ac);
-  if (c64 (ac) < 0.L)
+  if (c64 (ac) < REAL (0.))
     k += c64 (ac);
-  if (c65 (ac) < 0.L)
+  if (c65 (ac) < REAL (0.))
     k += c65 (ac);
-  if (k < 0.L)
+  if (k < REAL (0.))
     {
-      k = 10.L - k;
+      k = REAL (10.) - k;
       goto end;
     }
-  k = 1.L / rk_cfl_6 (tb, ac);
+  k = REAL (1.) / rk_cfl_6 (tb, ac);
 end:
 #if DEBUG_RK
-  fprintf (stderr, "rk_objective ac_6: objective=%Lg\n", k);
+  fprintf (stderr, "rk_objective ac_6: objective=" REAL_G "\n", real_g (k));
   fprintf (stderr, "rk_objective ac_6: end\n");
 #endif
   return k;
 }
 
+#if OPTIMIZE_SPECIALIZED
+OPTIMIZE_SPECIALIZE (rk_ac_2, rk_ac_2, rk_objective_ac_2)
+///< specialized functions of the 2 steps a-c Runge-Kutta coefficients.
+OPTIMIZE_SPECIALIZE (rk_ac_3, rk_ac_3, rk_objective_ac_3)
+///< specialized functions of the 3 steps a-c Runge-Kutta coefficients.
+OPTIMIZE_SPECIALIZE (rk_ac_4, rk_ac_4, rk_objective_ac_4)
+///< specialized functions of the 4 steps a-c Runge-Kutta coefficients.
+OPTIMIZE_SPECIALIZE (rk_ac_5, rk_ac_5, rk_objective_ac_5)
+///< specialized functions of the 5 steps a-c Runge-Kutta coefficients.
+OPTIMIZE_SPECIALIZE (rk_ac_6, rk_ac_6, rk_objective_ac_6)
+///< specialized functions of the 6 steps a-c Runge-Kutta coefficients.
+OPTIMIZE_SPECIALIZE (rk_tb_2_2, rk_tb_2_2, rk_objective_tb_2_2)
+///< specialized functions of the 2 steps 2nd order t-b coefficients.
+OPTIMIZE_SPECIALIZE (rk_tb_3_2, rk_tb_3_2, rk_objective_tb_3_2)
+///< specialized functions of the 3 steps 2nd order t-b coefficients.
+OPTIMIZE_SPECIALIZE (rk_tb_3_3, rk_tb_3_3, rk_objective_tb_3_3)
+///< specialized functions of the 3 steps 3rd order t-b coefficients.
+OPTIMIZE_SPECIALIZE (rk_tb_4_2, rk_tb_4_2, rk_objective_tb_4_2)
+///< specialized functions of the 4 steps 2nd order t-b coefficients.
+OPTIMIZE_SPECIALIZE (rk_tb_4_3, rk_tb_4_3, rk_objective_tb_4_3)
+///< specialized functions of the 4 steps 3rd order t-b coefficients.
+OPTIMIZE_SPECIALIZE (rk_tb_4_4, rk_tb_4_4, rk_objective_tb_4_4)
+///< specialized functions of the 4 steps 4th order t-b coefficients.
+OPTIMIZE_SPECIALIZE (rk_tb_5_2, rk_tb_5_2, rk_objective_tb_5_2)
+///< specialized functions of the 5 steps 2nd order t-b coefficients.
+OPTIMIZE_SPECIALIZE (rk_tb_5_3, rk_tb_5_3, rk_objective_tb_5_3)
+///< specialized functions of the 5 steps 3rd order t-b coefficients.
+OPTIMIZE_SPECIALIZE (rk_tb_5_4, rk_tb_5_4, rk_objective_tb_5_4)
+///< specialized functions of the 5 steps 4th order t-b coefficients.
+OPTIMIZE_SPECIALIZE (rk_tb_6_2, rk_tb_6_2, rk_objective_tb_6_2)
+///< specialized functions of the 6 steps 2nd order t-b coefficients.
+OPTIMIZE_SPECIALIZE (rk_tb_6_3, rk_tb_6_3, rk_objective_tb_6_3)
+///< specialized functions of the 6 steps 3rd order t-b coefficients.
+OPTIMIZE_SPECIALIZE (rk_tb_6_4, rk_tb_6_4, rk_objective_tb_6_4)
+///< specialized functions of the 6 steps 4th order t-b coefficients.
+#endif
+
 /**
- * Function to init required variables on a RK struct data.
+ * Function to get the a-c coefficients and the objective function values of a
+ * batch of OPTIMIZE_BATCH samples, stored as structure of arrays, in double
+ * precision. It follows the rk_ac_N and rk_objective_ac_N functions for any
+ * steps number, applying the penalties and discarding the samples without
+ * solution by masks instead of branches.
  */
-static inline void
-rk_init (RK * rk,               ///< RK struct.
-         gsl_rng * rng,         ///< GSL pseudo-random number generator struct.
-         unsigned int thread)   ///< thread number.
+static void
+rk_batch_ac (RK * rk)           ///< RK struct.
+{
+  double ka[OPTIMIZE_BATCH], kc[OPTIMIZE_BATCH], m[OPTIMIZE_BATCH],
+    v[OPTIMIZE_BATCH];
+  unsigned int nan[OPTIMIZE_BATCH];
+  Real *tb, *bi;
+  double *r, *x, *o, *a, *c, *q, *y;
+  double bkj;
+  unsigned int i, j, k, l, nsteps;
+#if DEBUG_RK
+  fprintf (stderr, "rk_batch_ac: start\n");
+#endif
+  tb = rk->tb->coefficient;
+  nsteps = rk->tb->nsteps;
+  r = rk->ac->batch_data;
+  x = r + OPTIMIZE_BATCH * rk->ac->nfree;
+  o = x + OPTIMIZE_BATCH * rk->ac->size;
+  for (l = 0; l < OPTIMIZE_BATCH; ++l)
+    {
+      ka[l] = kc[l] = 0.;
+      m[l] = (double) t1 (tb);
+      nan[l] = 0;
+    }
+  for (i = 2; i <= nsteps; ++i)
+    {
+
+      // a_ij, c_ij and b_ij coefficients of the step i, with b_10 = t1
+      a = x + OPTIMIZE_BATCH * (i * (i - 1) - 2);
+      c = x + OPTIMIZE_BATCH * (i * i - 2);
+      q = r + OPTIMIZE_BATCH * ((i - 1) * (i - 2) / 2);
+      bi = tb + i * (i + 1) / 2 - 1;
+      memcpy (c + OPTIMIZE_BATCH, q,
+              (i - 1) * OPTIMIZE_BATCH * sizeof (double));
+      y = a + (i - 1) * OPTIMIZE_BATCH;
+      q = c + (i - 1) * OPTIMIZE_BATCH;
+      for (l = 0; l < OPTIMIZE_BATCH; ++l)
+        y[l] = (double) bi[i - 1] / q[l];
+      for (j = i - 2; j > 0; --j)
+        {
+          for (l = 0; l < OPTIMIZE_BATCH; ++l)
+            v[l] = (double) bi[j];
+          for (k = j + 1; k < i; ++k)
+            {
+              bkj = (double) tb[k * (k + 1) / 2 - 1 + j];
+              y = a + k * OPTIMIZE_BATCH;
+              for (l = 0; l < OPTIMIZE_BATCH; ++l)
+                v[l] -= y[l] * bkj;
+            }
+          y = a + j * OPTIMIZE_BATCH;
+          q = c + j * OPTIMIZE_BATCH;
+          for (l = 0; l < OPTIMIZE_BATCH; ++l)
+            y[l] = (fabs (v[l]) < DBL_EPSILON) ? 0. : v[l] / q[l];
+        }
+      for (l = 0; l < OPTIMIZE_BATCH; ++l)
+        v[l] = 1.;
+      for (k = 1; k < i; ++k)
+        {
+          y = a + k * OPTIMIZE_BATCH;
+          for (l = 0; l < OPTIMIZE_BATCH; ++l)
+            v[l] -= y[l];
+        }
+      for (l = 0; l < OPTIMIZE_BATCH; ++l)
+        a[l] = v[l];
+      for (l = 0; l < OPTIMIZE_BATCH; ++l)
+        v[l] = (double) bi[0];
+      for (k = 1; k < i; ++k)
+        {
+          bkj = (double) tb[k * (k + 1) / 2 - 1];
+          y = a + k * OPTIMIZE_BATCH;
+          for (l = 0; l < OPTIMIZE_BATCH; ++l)
+            v[l] -= y[l] * bkj;
+        }
+      for (l = 0; l < OPTIMIZE_BATCH; ++l)
+        c[l] = (fabs (v[l]) < DBL_EPSILON) ? 0. : v[l] / a[l];
+
+      // masks of the samples without solution, sums of the negative
+      // coefficients and maximum of the c_ij coefficients
+      for (l = 0; l < OPTIMIZE_BATCH; ++l)
+        nan[l] |= isnan (c[l]);
+      for (j = 0; j < i; ++j)
+        {
+          y = a + j * OPTIMIZE_BATCH;
+          q = c + j * OPTIMIZE_BATCH;
+          for (l = 0; l < OPTIMIZE_BATCH; ++l)
+            {
+              nan[l] |= (j > 0 && isnan (y[l]));
+              ka[l] += (y[l] < 0.) ? y[l] : 0.;
+              kc[l] += (q[l] < 0.) ? q[l] : 0.;
+              m[l] = (q[l] > m[l]) ? q[l] : m[l];
+            }
+        }
+    }
+
+  // objective function values
+  for (l = 0; l < OPTIMIZE_BATCH; ++l)
+    {
+      o[l] = (ka[l] < 0.) ? 20. - ka[l] : (kc[l] < 0.) ? 10. - kc[l] : m[l];
+      o[l] = nan[l] ? INFINITY : o[l];
+    }
+#if DEBUG_RK
+  fprintf (stderr, "rk_batch_ac: end\n");
+#endif
+}
+
+/**
+ * Function to init required variables on a RK struct data. It is executed by
+ * the thread owning the RK struct. On allocation error the random_data field
+ * of the failing Optimize struct is NULL.
+ */
+static void
+rk_init (RK * rk)               ///< RK struct.
 {
-  optimize_init (rk->tb, rng, thread);
+  optimize_init (rk->tb);
   if (rk->strong)
-    optimize_init (rk->ac0, rng, 0);
+    {
+      memcpy (rk->ac, rk->ac0, sizeof (Optimize));
+      optimize_init (rk->ac);
+    }
 }
 
 /**
@@ -941,10 +1173,187 @@ static inline void
 rk_delete (RK * rk)             ///< RK struct.
 {
   if (rk->strong)
-    optimize_delete (rk->ac0);
+    optimize_delete (rk->ac);
   optimize_delete (rk->tb);
 }
 
+/**
+ * Function to sample a range of simulations of the a-c Runge-Kutta
+ * coefficients on batches evaluated in double precision. The simulations
+ * passing the optimize_screen function are confirmed in full precision
+ * following the simulations order, so the ties are won by the lowest
+ * simulation number as on the scalar sampling.
+ *
+ * \return optimal objective function value.
+ */
+static Real
+rk_step_ac_batch (RK * rk,      ///< RK struct.
+                  unsigned long long int first, ///< first simulation.
+                  unsigned long long int last,  ///< end of the simulations.
+                  Real o2,
+                  ///< initial optimal objective function value.
+                  unsigned long long int *i2,
+                  ///< pointer to the optimal simulation number.
+                  Real *vo)
+                  ///< array of optimal freedom degree values.
+{
+  Optimize *ac;
+  Real *random, *rows;
+  double *r, *o;
+  Real v;
+  unsigned int i, j, n, nfree;
+  ac = rk->ac;
+  nfree = ac->nfree;
+  random = ac->random_data;
+  rows = ac->batch_random;
+  r = ac->batch_data;
+  o = r + OPTIMIZE_BATCH * (nfree + ac->size);
+  for (; first < last; first += n)
+    {
+      n = (last - first > OPTIMIZE_BATCH) ? OPTIMIZE_BATCH : last - first;
+      optimize_generate_batch (ac, first, n);
+      for (i = 0; i < n; ++i)
+        for (j = 0; j < nfree; ++j)
+          r[j * OPTIMIZE_BATCH + i] = (double) rows[i * nfree + j];
+      ac->batch ((Optimize *) rk);
+      for (i = 0; i < n; ++i)
+        if (optimize_screen (o[i], o2))
+          {
+            memcpy (random, rows + i * nfree, nfree * sizeof (Real));
+            v = optimize_evaluate (ac, rk, o2);
+            if (v < o2)
+              {
+                o2 = v;
+                *i2 = first + i;
+                memcpy (vo, random, nfree * sizeof (Real));
+              }
+          }
+    }
+  return o2;
+}
+
+/**
+ * Function to perform the sampling of an RKJob struct by a thread. The optimal
+ * values are updated selecting the lowest simulation number on equal objective
+ * function values, so the result is the same than on the serial sampling.
+ */
+static void
+rk_step_ac_sample (RK * rk,     ///< RK struct.
+                   RKJob * job) ///< RKJob struct.
+{
+  Optimize *tb, *ac;
+  Real *vo;
+  Real o, o2;
+  unsigned long long int ii, i2, nrandom;
+  unsigned int nfree;
+  tb = rk->tb;
+  ac = rk->ac;
+  nfree = ac->nfree;
+  vo = ac->work + nfree;
+  o2 = INFINITY;
+  i2 = 0L;
+  while (1)
+    {
+      ii = __atomic_fetch_add (&job->next, job->chunk, __ATOMIC_RELAXED);
+      if (ii >= job->last)
+        break;
+      nrandom = (job->last - ii > job->chunk) ? ii + job->chunk : job->last;
+      if (ac->batch && !file_variables)
+        {
+          o2 = rk_step_ac_batch (rk, ii, nrandom, o2, &i2, vo);
+          continue;
+        }
+      if (ac->sample && !file_variables)
+        {
+          o2 = ac->sample (rk, ac, ii, nrandom, o2, &i2, vo);
+          continue;
+        }
+      for (; ii < nrandom; ++ii)
+        {
+
+          // random freedom degrees
+#if DEBUG_RK
+          fprintf (stderr, "rk_step_ac_sample: random freedom degrees\n");
+#endif
+          optimize_generate_freedom (ac, ii, nrandom);
+
+          // method coefficients
+#if DEBUG_RK
+          fprintf (stderr, "rk_step_ac_sample: method coefficients\n");
+#endif
+          o = optimize_evaluate (ac, rk, file_variables ? INFINITY : o2);
+#if DEBUG_RK
+          fprintf (stderr,
+                   "rk_step_ac_sample: objective=" REAL_G " o2=" REAL_G "\n",
+                   real_g (o), real_g (o2));
+#endif
+          if (o < o2)
+            {
+              o2 = o;
+              i2 = ii;
+              memcpy (vo, ac->random_data, nfree * sizeof (Real));
+            }
+          if (file_variables)
+            {
+              g_mutex_lock (mutex);
+              print_variables (tb->random_data, tb->nfree, file_variables);
+              print_variables (ac->random_data, nfree, file_variables);
+              fprintf (file_variables, REAL_E "\n", real_e (o));
+              g_mutex_unlock (mutex);
+            }
+        }
+    }
+  if (o2 == INFINITY)
+    return;
+  g_mutex_lock (job->mutex);
+  if (o2 < job->optimal || (o2 == job->optimal && i2 < job->index))
+    {
+      job->optimal = o2;
+      job->index = i2;
+      memcpy (job->value_optimal, vo, nfree * sizeof (Real));
+    }
+  g_mutex_unlock (job->mutex);
+}
+
+/**
+ * Function to help on the sampling or on the hill climbing probes of the a-c
+ * Runge-Kutta coefficients of other thread. The helping thread uses the t-b
+ * coefficients and the pseudo-random numbers seed of the owner thread with its
+ * own a-c arrays. The data of the owner thread are read from the snapshot of
+ * the job, as the owner thread updates its own RK struct while sampling.
+ */
+static void
+rk_step_ac_help (RKJob * job,   ///< RKJob struct.
+                 unsigned int thread)   ///< helping thread number.
+{
+  RK rk[1];
+  RK *helper;
+  Optimize *ac;
+  unsigned int i;
+  memcpy (rk, job->snapshot, sizeof (RK));
+  ac = rk->ac;
+  memset (ac->rejected, 0, OPTIMIZE_REJECT_N * sizeof (unsigned long long int));
+
+  helper = (RK *) pool_data (thread);
+  ac->random_data = helper->ac->random_data;
+  ac->coefficient = helper->ac->coefficient;
+  ac->work = helper->ac->work;
+  ac->uniform = helper->ac->uniform;
+  ac->nuniform = 0;
+  ac->batch_random = helper->ac->batch_random;
+  ac->batch_data = helper->ac->batch_data;
+  if (job->probes)
+    optimize_probes_evaluate (ac, rk, job->probes);
+  else
+    rk_step_ac_sample (rk, job);
+
+  // the rejected simulations are counted by the helping thread, which uniform
+  // random numbers have been overwritten
+  for (i = 0; i < OPTIMIZE_REJECT_N; ++i)
+    helper->ac->rejected[i] += ac->rejected[i];
+  helper->ac->nuniform = 0;
+}
+
 /**
  * Function to perform every optimization step for the a-c Runge-Kutta 
  * coefficients.
@@ -952,11 +1361,12 @@ rk_delete (RK * rk)             ///< RK struct.
 static inline void
 rk_step_ac (RK * rk)            ///< RK struct.
 {
+  RKJob job[1];
+  OptimizeProbes probes[1];
   Optimize *tb, *ac;
-  long double *is, *vo, *vo2;
-  long double o, o2, v, f;
-  unsigned long long int ii, nsimulations;
-  unsigned int i, j, k, n, nfree;
+  Real *is, *vo, *vo2, *tail, *probe;
+  Real o, o2, f;
+  unsigned int i, j, k, n, nfree, nprobes;
 
 #if DEBUG_RK
   fprintf (stderr, "rk_step_ac: start\n");
@@ -969,145 +1379,119 @@ rk_step_ac (RK * rk)            ///< RK struct.
   tb = rk->tb;
   ac = rk->ac;
   nfree = ac->nfree;
-  o2 = INFINITY;
-  vo = (long double *) alloca (nfree * sizeof (long double));
-  vo2 = (long double *) alloca (nfree * sizeof (long double));
-  memcpy (vo, ac->value_optimal, nfree * sizeof (long double));
+  nprobes = 2 * nfree;
+  vo = ac->work;
+  vo2 = vo + nfree;
+  memcpy (vo, ac->value_optimal, nfree * sizeof (Real));
 
-  // optimzation algorithm sampling
+  // optimzation algorithm sampling helped by the waiting threads
 #if DEBUG_RK
   fprintf (stderr, "rk_step_ac: optimization algorithm sampling\n");
   fprintf (stderr, "rk_step_ac: nsimulations=%Lu nclimbings=%u nfree=%u\n",
            ac->nsimulations, ac->nclimbings, ac->nfree);
 #endif
-  nsimulations = ac->nsimulations;
-  for (ii = 0L; ii < nsimulations; ++ii)
-    {
-
-      // random freedom degrees
-#if DEBUG_RK
-      fprintf (stderr, "rk_step_ac: random freedom degrees\n");
-#endif
-      optimize_generate_freedom (ac, ii);
-
-      // method coefficients
-#if DEBUG_RK
-      fprintf (stderr, "rk_step_ac: method coefficients\n");
-#endif
-      if (!ac->method ((Optimize *) rk))
-        o = INFINITY;
-      else
-        o = ac->objective ((Optimize *) rk);
-#if DEBUG_RK
-      fprintf (stderr, "rk_step_ac: objective=%Lg o2=%Lg\n", o, o2);
-#endif
-      if (o < o2)
-        {
-          o2 = o;
-          memcpy (vo, ac->random_data, nfree * sizeof (long double));
-        }
-      if (file_variables)
-        {
-          g_mutex_lock (mutex);
-          print_variables (tb->random_data, tb->nfree, file_variables);
-          print_variables (ac->random_data, nfree, file_variables);
-          fprintf (file_variables, "%.19Le\n", o);
-          g_mutex_unlock (mutex);
-        }
-    }
+  memcpy (job->snapshot, rk, sizeof (RK));
+  job->probes = NULL;
+  job->value_optimal = vo;
+  job->optimal = INFINITY;
+  job->index = ~0L;
+  job->next = 0L;
+  job->last = ac->nsimulations;
+  job->chunk = job->last / (nthreads * POOL_CHUNKS);
+  if (!job->chunk)
+    job->chunk = 1L;
+  g_mutex_init (job->mutex);
+  pool_job_post (tb->thread, (PoolHelp) (void (*)(void)) rk_step_ac_help,
+                 job);
+  rk_step_ac_sample (rk, job);
+  pool_job_remove (tb->thread);
+  g_mutex_clear (job->mutex);
+  o2 = job->optimal;
 
   // array of intervals to climb around the optimal
 #if DEBUG_RK
   fprintf (stderr,
            "rk_step_ac: array of intervals to climb around the optimal\n");
-  fprintf (stderr, "rk_step_ac: nclimbings=%u climbing_factor=%Lg\n",
-           ac->nclimbings, ac->climbing_factor);
+  fprintf (stderr, "rk_step_ac: nclimbings=%u climbing_factor=" REAL_G "\n",
+           ac->nclimbings, real_g (ac->climbing_factor));
 #endif
-  is = (long double *) alloca (nfree * sizeof (long double));
+  is = ac->work + 2 * nfree;
   for (j = 0; j < nfree; ++j)
     is[j] = ac->interval0[j] * ac->climbing_factor;
 #if DEBUG_RK
   for (j = 0; j < nfree; ++j)
-    fprintf (stderr, "rk_step_ac: i=%u is=%Lg\n", j, is[j]);
+    fprintf (stderr, "rk_step_ac: i=%u is=" REAL_G "\n", j, real_g (is[j]));
 #endif
 
-  // hill climbing algorithm bucle
+  // hill climbing algorithm bucle, the probes of a step after an accepted move
+  // keeping the previous centre values on the freedom degrees after the moved
+  // one
 #if DEBUG_RK
   fprintf (stderr, "rk_step_ac: hill climbing algorithm bucle\n");
 #endif
-  memcpy (vo2, vo, nfree * sizeof (long double));
-  memcpy (ac->random_data, vo, nfree * sizeof (long double));
+  tail = (Real *) alloca (nfree * sizeof (Real));
+  probe = (Real *) alloca (nprobes * sizeof (Real));
+  probes->help = (void (*)(void *, unsigned int)) rk_step_ac_help;
+  probes->job = job;
+  probes->centre = vo;
+  probes->tail = tail;
+  probes->step = is;
+  probes->probe = probe;
+  job->probes = probes;
+  memcpy (vo2, vo, nfree * sizeof (Real));
+  memcpy (tail, vo, nfree * sizeof (Real));
   n = ac->nclimbings;
   for (i = 0; i < n; ++i)
     {
 #if DEBUG_RK
       for (j = 0; j < nfree; ++j)
-        fprintf (stderr, "rk_step_ac: j=%u is=%Lg\n", j, is[j]);
+        fprintf (stderr, "rk_step_ac: j=%u is=" REAL_G "\n", j, real_g (is[j]));
 #endif
-      for (j = k = 0; j < nfree; ++j)
+
+      // evaluate the probes helped by the waiting threads with the optimal
+      // value as cut-off
+      probes->cutoff = file_variables ? INFINITY : o2;
+      probes->simulation = ac->nsimulations + i * nprobes;
+      probes->next = 0;
+      probes->last = nprobes;
+      optimize_probes_run (probes, ac, rk, tb->thread);
+
+      // reduce the probes in the serial order
+      for (j = 0, k = nprobes; j < nprobes; ++j)
         {
-          v = vo[j];
-          ac->random_data[j] = v + is[j];
+          o = probe[j];
 #if DEBUG_RK
-          fprintf (stderr, "rk_step_ac: j=%u random=%Lg\n", j,
-                   ac->random_data[j]);
-#endif
-          if (!ac->method ((Optimize *) rk))
-            o = INFINITY;
-          else
-            o = ac->objective ((Optimize *) rk);
-#if DEBUG_RK
-          fprintf (stderr, "rk_step_ac: k=%u objective=%Lg o2=%Lg\n", k, o, o2);
+          fprintf (stderr,
+                   "rk_step_ac: j=%u objective=" REAL_G " o2=" REAL_G "\n", j,
+                   real_g (o), real_g (o2));
 #endif
           if (o < o2)
             {
-              k = 1;
               o2 = o;
-              memcpy (vo2, ac->random_data, nfree * sizeof (long double));
+              k = j;
             }
           if (file_variables)
             {
+              optimize_probes_point (probes, ac->random_data, j, nfree);
               g_mutex_lock (mutex);
               print_variables (tb->random_data, tb->nfree, file_variables);
               print_variables (ac->random_data, nfree, file_variables);
-              fprintf (file_variables, "%.19Le\n", o);
+              fprintf (file_variables, REAL_E "\n", real_e (o));
               g_mutex_unlock (mutex);
             }
-          ac->random_data[j] = fmaxl (0.L, v - is[j]);
-          if (!ac->method ((Optimize *) rk))
-            o = INFINITY;
-          else
-            o = ac->objective ((Optimize *) rk);
-#if DEBUG_RK
-          fprintf (stderr, "rk_step_ac: k=%u objective=%Lg o2=%Lg\n", k, o, o2);
-#endif
-          if (o < o2)
-            {
-              k = 1;
-              o2 = o;
-              memcpy (vo2, ac->random_data, nfree * sizeof (long double));
-            }
-          if (file_variables)
-            {
-              g_mutex_lock (mutex);
-              print_variables (tb->random_data, tb->nfree, file_variables);
-              print_variables (ac->random_data, nfree, file_variables);
-              fprintf (file_variables, "%.19Le\n", o);
-              g_mutex_unlock (mutex);
-            }
-          ac->random_data[j] = v;
         }
 
-
       // update optimal values and increase or reduce intervals if converging or
       // not
-      if (!k)
-        f = 0.5L;
+      if (k == nprobes)
+        f = REAL (0.5);
       else
         {
-          f = 1.2L;
-          memcpy (vo, vo2, nfree * sizeof (long double));
+          f = REAL (1.2);
+          optimize_probes_point (probes, vo2, k, nfree);
         }
+      memcpy (tail, vo, nfree * sizeof (Real));
+      memcpy (vo, vo2, nfree * sizeof (Real));
       for (j = 0; j < nfree; ++j)
         is[j] *= f;
     }
@@ -1115,12 +1499,13 @@ rk_step_ac (RK * rk)            ///< RK struct.
   // update optimal values
 #if DEBUG_RK
   fprintf (stderr, "rk_step_ac: update optimal values\n");
-  fprintf (stderr, "rk_step_ac: optimal=%Lg o2=%Lg\n", *ac->optimal, o2);
+  fprintf (stderr, "rk_step_ac: optimal=" REAL_G " o2=" REAL_G "\n",
+           real_g (*ac->optimal), real_g (o2));
 #endif
   if (o2 < *ac->optimal)
     {
       *ac->optimal = o2;
-      memcpy (ac->value_optimal, vo2, nfree * sizeof (long double));
+      memcpy (ac->value_optimal, vo2, nfree * sizeof (Real));
     }
 
 #if DEBUG_RK
@@ -1128,6 +1513,33 @@ rk_step_ac (RK * rk)            ///< RK struct.
 #endif
 }
 
+/**
+ * Function to get the pseudo-random numbers seed of the a-c Runge-Kutta
+ * coefficients sampling, mixing the initial seed with the t-b coefficients, so
+ * every t-b point gets its own a-c random numbers independently of the thread
+ * evaluating it.
+ *
+ * \return seed.
+ */
+static inline unsigned long long int
+rk_seed_ac (RK * rk)            ///< RK struct.
+{
+  Optimize *tb;
+  double x;
+  unsigned long long int h, k;
+  unsigned int i;
+  tb = rk->tb;
+  h = rk->ac0->seed;
+  for (i = 0; i < tb->nfree; ++i)
+    {
+      x = (double) tb->random_data[i];
+      memcpy (&k, &x, sizeof (double));
+      h = (h ^ k) * 0x9E3779B97F4A7C15ull;
+      h ^= h >> 29;
+    }
+  return h;
+}
+
 /**
  * Function to do the optimization bucle for the a-c Runge-Kutta coefficients.
  */
@@ -1135,8 +1547,8 @@ void
 rk_bucle_ac (RK * rk)           ///< RK struct.
 {
   Optimize *tb, *ac, *ac0;
-  long double *vo;
-  long double optimal;
+  Real *vo;
+  Real optimal;
   unsigned int i, nfree;
 
 #if DEBUG_RK
@@ -1147,25 +1559,30 @@ rk_bucle_ac (RK * rk)           ///< RK struct.
   ac = rk->ac;
   ac0 = rk->ac0;
   nfree = ac0->nfree;
-  vo = (long double *) alloca (nfree * sizeof (long double));
+  vo = ac->work + 3 * nfree;
 
   // Init some parameters
 #if DEBUG_RK
-  fprintf (stderr, "rk_bucle_ac: nfree=%u optimal=%Lg\n", nfree, *tb->optimal);
+  fprintf (stderr, "rk_bucle_ac: nfree=%u optimal=" REAL_G "\n", nfree,
+           real_g (*tb->optimal));
 #endif
-  *ac0->optimal = optimal = *tb->optimal;
+  optimal = optimize_best_read (tb, NULL, NULL);
+  optimize_best_set (ac0, optimal);
   for (i = 0; i < nfree; ++i)
-    vo[i] = ac0->minimum[i] + 0.5L * ac0->interval[i];
-  memcpy (ac, ac0, sizeof (Optimize));
+    vo[i] = ac0->minimum0[i] + REAL (0.5) * ac0->interval0[i];
+  memcpy (ac->minimum, ac0->minimum0, nfree * sizeof (Real));
+  memcpy (ac->interval, ac0->interval0, nfree * sizeof (Real));
   ac->optimal = &optimal;
   ac->value_optimal = vo;
-  optimize_init (ac, ac0->rng, 0);
+  ac->seed = rk_seed_ac (rk);
 #if DEBUG_RK
   for (i = 0; i < tb->nfree; ++i)
-    fprintf (stderr, "rk_bucle_ac: i=%u random=%Lg\n", i, tb->random_data[i]);
+    fprintf (stderr, "rk_bucle_ac: i=%u random=" REAL_G "\n", i,
+             real_g (tb->random_data[i]));
   for (i = 0; i < nfree; ++i)
-    fprintf (stderr, "rk_bucle_ac: i=%u minimum=%Lg interval=%Lg type=%u\n",
-             i, ac->minimum[i], ac->interval[i], ac->random_type[i]);
+    fprintf (stderr, "rk_bucle_ac: i=%u minimum=" REAL_G " interval=" REAL_G
+             " type=%u\n", i, real_g (ac->minimum[i]), real_g (ac->interval[i]),
+             ac->random_type[i]);
 #endif
 
   // Iterate
@@ -1174,12 +1591,13 @@ rk_bucle_ac (RK * rk)           ///< RK struct.
 #endif
   for (i = 0; i < ac->niterations; ++i)
     {
+      ac->iteration = i;
 
       // Optimization step
       rk_step_ac (rk);
 
       // Updating coefficient intervals to converge
-      optimize_converge (ac);
+      optimize_converge (ac, vo);
 
       // Iterate
 #if DEBUG_RK
@@ -1188,30 +1606,116 @@ rk_bucle_ac (RK * rk)           ///< RK struct.
     }
 
   // Check and save optimal
-  if (optimal < *ac0->optimal)
+  rk->ac_optimal = optimal;
+  if (optimize_best_update (ac0, optimal, tb->simulation, vo))
     {
 #if DEBUG_RK
-      fprintf (stderr, "rk_bucle_ac: optimal=%Lg\n", *ac0->optimal);
-#endif
-      g_mutex_lock (mutex);
-      *ac0->optimal = optimal;
-      memcpy (ac0->value_optimal, vo, nfree * sizeof (long double));
-      g_mutex_unlock (mutex);
-#if DEBUG_RK
-      fprintf (stderr, "rk_bucle_ac: optimal=%Lg\n", *ac0->optimal);
+      fprintf (stderr, "rk_bucle_ac: optimal=" REAL_G "\n",
+               real_g (*ac0->optimal));
       for (i = 0; i < ac0->nfree; ++i)
-        fprintf (stderr, "rk_bucle_ac: vo%u=%Lg\n", i, ac0->value_optimal[i]);
+        fprintf (stderr, "rk_bucle_ac: vo%u=" REAL_G "\n", i,
+                 real_g (ac0->value_optimal[i]));
 #endif
     }
 
-  // Free memory
-  optimize_delete (ac);
-
 #if DEBUG_RK
   fprintf (stderr, "rk_bucle_ac: end\n");
 #endif
 }
 
+/**
+ * Function to perform the coordinates hill climbing optimization algorithm
+ * for the t-b Runge-Kutta coefficients around the optimal point. The probes of
+ * every climbing step are evaluated helped by the threads waiting on a barrier
+ * and they update the optimal values in the serial order. With strong
+ * stability the a-c optimization of a probe starts from the optimal values, so
+ * the probes are evaluated one by one.
+ */
+static void
+rk_climb_tb (RK * rk)           ///< RK struct.
+{
+  OptimizeProbes probes[1];
+  Optimize *tb;
+  Real *is, *vo, *tail, *probe;
+  Real f;
+  unsigned int b, i, j, k, m, n, nfree, nprobes;
+
+  tb = rk->tb;
+  nfree = tb->nfree;
+  nprobes = 2 * nfree;
+  vo = tb->work;
+  tail = vo + nfree;
+  b = (file_variables && !rk->strong) ? 1 : 0;
+
+  // array of intervals to climb around the optimal
+#if DEBUG_RK
+  fprintf (stderr,
+           "rk_climb_tb: array of intervals to climb around the optimal\n");
+#endif
+  is = tb->work + 2 * nfree;
+  for (j = 0; j < nfree; ++j)
+    is[j] = tb->interval0[j] * tb->climbing_factor;
+
+  // hill climbing algorithm bucle, the probes of a step after an accepted move
+  // keeping the previous centre values on the freedom degrees after the moved
+  // one
+#if DEBUG_RK
+  fprintf (stderr, "rk_climb_tb: hill climbing algorithm bucle\n");
+#endif
+  probe = (Real *) alloca (nprobes * sizeof (Real));
+  probes->help = (void (*)(void *, unsigned int)) optimize_probes_help;
+  probes->job = probes;
+  probes->centre = vo;
+  probes->tail = tail;
+  probes->step = is;
+  probes->probe = probe;
+  optimize_best_read (tb, vo, NULL);
+  memcpy (tail, vo, nfree * sizeof (Real));
+  n = tb->nclimbings;
+  for (i = 0; i < n; ++i)
+    {
+      probes->simulation = tb->nsimulations + i * nprobes;
+      for (j = k = 0; j < nprobes; j = m)
+        {
+
+          // evaluate the probes with the optimal value as cut-off
+          m = rk->strong ? j + 1 : nprobes;
+          probes->cutoff = b ? INFINITY : optimize_best_read (tb, NULL, NULL);
+          probes->next = j;
+          probes->last = m;
+          optimize_probes_run (probes, tb, tb, tb->thread);
+
+          // update the optimal values in the serial order
+          for (; j < m; ++j)
+            {
+              optimize_probes_point (probes, tb->random_data, j, nfree);
+              if (optimize_best_update (tb, probe[j], probes->simulation + j,
+                                        tb->random_data))
+                k = 1;
+              if (b)
+                {
+                  g_mutex_lock (mutex);
+                  print_variables (tb->random_data, nfree, file_variables);
+                  fprintf (file_variables, REAL_E "\n", real_e (probe[j]));
+                  g_mutex_unlock (mutex);
+                }
+            }
+        }
+
+      // increase or reduce intervals if converging or not
+      memcpy (tail, vo, nfree * sizeof (Real));
+      if (!k)
+        f = REAL (0.5);
+      else
+        {
+          f = REAL (1.2);
+          optimize_best_read (tb, vo, NULL);
+        }
+      for (j = 0; j < nfree; ++j)
+        is[j] *= f;
+    }
+}
+
 /**
  * Function to perform every optimization step for the t-b Runge-Kutta 
  * coefficients.
@@ -1220,10 +1724,9 @@ static inline void
 rk_step_tb (RK * rk)            ///< RK struct.
 {
   Optimize *tb;
-  long double *is, *vo;
-  long double o, v, f;
-  unsigned long long int ii, nrandom;
-  unsigned int b, i, j, k, n, nfree;
+  Real o;
+  unsigned long long int ii, i2, nrandom;
+  unsigned int b, nfree, range;
 
 #if DEBUG_RK
   fprintf (stderr, "rk_step_tb: start\n");
@@ -1235,7 +1738,6 @@ rk_step_tb (RK * rk)            ///< RK struct.
 #endif
   tb = rk->tb;
   nfree = tb->nfree;
-  vo = (long double *) alloca (nfree * sizeof (long double));
   b = (file_variables && !rk->strong) ? 1 : 0;
 
   // optimization algorithm sampling
@@ -1244,138 +1746,181 @@ rk_step_tb (RK * rk)            ///< RK struct.
   fprintf (stderr, "rk_step_tb: nsimulations=%Lu nclimbings=%u\n",
            tb->nsimulations, tb->nclimbings);
 #endif
-  ii = tb->nsimulations * (rank * nthreads + tb->thread) / (nnodes * nthreads);
-  nrandom = tb->nsimulations * (rank * nthreads + tb->thread + 1)
-    / (nnodes * nthreads);
-  for (; ii < nrandom; ++ii)
-    {
+  if (tb->batch && !b)
+    while (pool_range_next (tb->thread, &ii, &nrandom, &range))
+      {
+        o = optimize_best_read (tb, NULL, &i2);
+        o = optimize_sample_batch (tb, ii, nrandom, o, &i2, tb->work);
+        optimize_best_update (tb, o, i2, tb->work);
+      }
+  else if (tb->sample && !b)
+    while (pool_range_next (tb->thread, &ii, &nrandom, &range))
+      {
+        o = optimize_best_read (tb, NULL, &i2);
+        o = tb->sample (tb, tb, ii, nrandom, o, &i2, tb->work);
+        optimize_best_update (tb, o, i2, tb->work);
+      }
+  else
+    while (pool_range_next (tb->thread, &ii, &nrandom, &range))
+      for (; ii < nrandom; ++ii)
+        {
 
-      // random freedom degrees
+          // random freedom degrees
 #if DEBUG_RK
-      fprintf (stderr, "rk_step_tb: random freedom degrees\n");
+          fprintf (stderr, "rk_step_tb: random freedom degrees\n");
 #endif
-      optimize_generate_freedom (tb, ii);
+          optimize_generate_freedom (tb, ii, nrandom);
 
-      // method coefficients
+          // method coefficients
 #if DEBUG_RK
-      fprintf (stderr, "rk_step_tb: method coefficients\n");
+          fprintf (stderr, "rk_step_tb: method coefficients\n");
 #endif
-      if (!tb->method (tb))
-        o = INFINITY;
-      else
-        o = tb->objective (tb);
-      if (o < *tb->optimal)
-        {
-          g_mutex_lock (mutex);
-          *tb->optimal = o;
-          memcpy (tb->value_optimal, tb->random_data,
-                  nfree * sizeof (long double));
-          g_mutex_unlock (mutex);
-        }
-      if (b)
-        {
-          g_mutex_lock (mutex);
-          print_variables (tb->random_data, nfree, file_variables);
-          fprintf (file_variables, "%.19Le\n", o);
-          g_mutex_unlock (mutex);
+          o = optimize_best_read (tb, NULL, &i2);
+          o = optimize_evaluate (tb, tb, b ? INFINITY
+                                 : optimize_cutoff (o, i2, ii));
+          optimize_best_update (tb, o, ii, tb->random_data);
+          if (b)
+            {
+              g_mutex_lock (mutex);
+              print_variables (tb->random_data, nfree, file_variables);
+              fprintf (file_variables, REAL_E "\n", real_e (o));
+              g_mutex_unlock (mutex);
+            }
         }
-    }
 
-  // array of intervals to climb around the optimal
+  // hill climbing algorithm, performed after selecting the optimal values of
+  // all the nodes on dynamic mode
+  if (!dynamic)
+    rk_climb_tb (rk);
+
 #if DEBUG_RK
-  fprintf (stderr,
-           "rk_step_tb: array of intervals to climb around the optimal\n");
+  fprintf (stderr, "rk_step_tb: end\n");
+#endif
+}
+
+#if HAVE_MPI
+
+/**
+ * Function to perform the hill climbing of an optimization step for the t-b
+ * Runge-Kutta coefficients on dynamic mode. The first thread climbs around the
+ * optimal values of all the nodes helped by the other threads, waiting on the
+ * barrier of the pool.
+ */
+static void
+rk_climb_step (RK * rk)         ///< RK struct.
+{
+  if (!rk->tb->thread)
+    rk_climb_tb (rk);
+}
+
 #endif
-  is = (long double *) alloca (nfree * sizeof (long double));
-  for (j = 0; j < nfree; ++j)
-    is[j] = tb->interval0[j] * tb->climbing_factor;
 
-  // hill climbing algorithm bucle
+/**
+ * Function to perform the sampling of the asynchronous optimization iterations
+ * for the t-b Runge-Kutta coefficients.
+ */
+static void
+rk_step_tb_asynchronous (RK * rk)       ///< RK struct.
+{
+  Optimize *tb;
+  Real o;
+  unsigned long long int ii, i2, nrandom, n;
+  unsigned int b, nfree;
 #if DEBUG_RK
-  fprintf (stderr, "rk_step_tb: hill climbing algorithm bucle\n");
+  fprintf (stderr, "rk_step_tb_asynchronous: start\n");
 #endif
-  memcpy (tb->random_data, tb->value_optimal, nfree * sizeof (long double));
-  memcpy (vo, tb->value_optimal, nfree * sizeof (long double));
-  n = tb->nclimbings;
-  for (i = 0; i < n; ++i)
+  tb = rk->tb;
+  nfree = tb->nfree;
+  b = (file_variables && !rk->strong) ? 1 : 0;
+  while (optimize_asynchronous_next (tb, &ii, &nrandom))
     {
-      for (j = k = 0; j < nfree; ++j)
+      n = nrandom - ii;
+      if (tb->batch && !b)
         {
-          v = vo[j];
-          tb->random_data[j] = v + is[j];
-          if (!tb->method (tb))
-            o = INFINITY;
-          else
-            o = tb->objective (tb);
-          if (o < *tb->optimal)
-            {
-              k = 1;
-              g_mutex_lock (mutex);
-              *tb->optimal = o;
-              memcpy (tb->value_optimal, tb->random_data,
-                      nfree * sizeof (long double));
-              g_mutex_unlock (mutex);
-            }
-          if (b)
-            {
-              g_mutex_lock (mutex);
-              print_variables (tb->random_data, nfree, file_variables);
-              fprintf (file_variables, "%.19Le\n", o);
-              g_mutex_unlock (mutex);
-            }
-          tb->random_data[j] = fmaxl (0.L, v - is[j]);
-          if (!tb->method (tb))
-            o = INFINITY;
-          else
-            o = tb->objective (tb);
-          if (o < *tb->optimal)
-            {
-              k = 1;
-              g_mutex_lock (mutex);
-              *tb->optimal = o;
-              memcpy (tb->value_optimal, tb->random_data,
-                      nfree * sizeof (long double));
-              g_mutex_unlock (mutex);
-            }
+          o = optimize_best_read (tb, NULL, &i2);
+          o = optimize_sample_batch (tb, ii, nrandom, o, &i2, tb->work);
+          optimize_best_update (tb, o, i2, tb->work);
+          ii = nrandom;
+        }
+      else if (tb->sample && !b)
+        {
+          o = optimize_best_read (tb, NULL, &i2);
+          o = tb->sample (tb, tb, ii, nrandom, o, &i2, tb->work);
+          optimize_best_update (tb, o, i2, tb->work);
+          ii = nrandom;
+        }
+      for (; ii < nrandom; ++ii)
+        {
+          optimize_generate_freedom (tb, ii, nrandom);
+          o = optimize_best_read (tb, NULL, &i2);
+          o = optimize_evaluate (tb, tb, b ? INFINITY
+                                 : optimize_cutoff (o, i2, ii));
+          optimize_best_update (tb, o, ii, tb->random_data);
           if (b)
             {
               g_mutex_lock (mutex);
               print_variables (tb->random_data, nfree, file_variables);
-              fprintf (file_variables, "%.19Le\n", o);
+              fprintf (file_variables, REAL_E "\n", real_e (o));
               g_mutex_unlock (mutex);
             }
-          tb->random_data[j] = v;
-        }
-
-      // increase or reduce intervals if converging or not
-      if (!k)
-        f = 0.5L;
-      else
-        {
-          f = 1.2L;
-          memcpy (vo, tb->value_optimal, nfree * sizeof (long double));
         }
-      for (j = 0; j < nfree; ++j)
-        is[j] *= f;
+      optimize_asynchronous_report (tb, n,
+                                    (OptimizeStep) (void (*)(void))
+                                    rk_climb_tb);
     }
 #if DEBUG_RK
-  fprintf (stderr, "rk_step_tb: end\n");
+  fprintf (stderr, "rk_step_tb_asynchronous: end\n");
 #endif
 }
 
+#if HAVE_MPI
+
+/**
+ * Function to select the optimal t-b and a-c coefficients of all the nodes.
+ */
+static void
+rk_nodes_optimal (RK * rk,      ///< RK struct.
+                  Real *vo)
+                  ///< array to pack the optimal values of the node.
+{
+  Optimize *tb, *ac;
+  int r;
+  unsigned int nfree, nfree2;
+  tb = rk->tb;
+  nfree = tb->nfree;
+  if (!rk->strong)
+    {
+      optimize_nodes_optimal (tb->optimal, tb->simulation_optimal,
+                              tb->value_optimal, nfree);
+      return;
+    }
+  ac = rk->ac0;
+  nfree2 = ac->nfree;
+  memcpy (vo, tb->value_optimal, nfree * sizeof (Real));
+  vo[nfree] = *ac->optimal;
+  memcpy (vo + nfree + 1, ac->value_optimal, nfree2 * sizeof (Real));
+  r = optimize_nodes_optimal (tb->optimal, tb->simulation_optimal, vo,
+                              nfree + 1 + nfree2);
+  memcpy (tb->value_optimal, vo, nfree * sizeof (Real));
+  *ac->optimal = vo[nfree];
+  memcpy (ac->value_optimal, vo + nfree + 1, nfree2 * sizeof (Real));
+  MPI_Bcast (ac->simulation_optimal, 1, MPI_UNSIGNED_LONG_LONG, r,
+             MPI_COMM_WORLD);
+}
+
+#endif
+
 /**
  * Function to do the optimization bucle.
  */
 static inline void
 rk_bucle_tb (RK * rk)           ///< RK struct.
 {
-  GThread *thread[nthreads];
   Optimize *tb, *ac;
 #if HAVE_MPI
-  long double *vo;
-  MPI_Status status;
+  Real *vo;
 #endif
-  unsigned int i, j, nfree, nfree2, strong;
+  unsigned int i, nfree, nfree2, strong;
 
 #if DEBUG_RK
   fprintf (stderr, "rk_bucle_tb: start\n");
@@ -1394,9 +1939,12 @@ rk_bucle_tb (RK * rk)           ///< RK struct.
       nfree2 = ac->nfree;
     }
   else
-    nfree2 = 0;
+    {
+      ac = NULL;
+      nfree2 = 0;
+    }
 #if HAVE_MPI
-  vo = (long double *) alloca ((1 + nfree + nfree2) * sizeof (long double));
+  vo = (Real *) alloca ((nfree + 1 + nfree2) * sizeof (Real));
 #endif
 
   // Init some parameters
@@ -1406,10 +1954,24 @@ rk_bucle_tb (RK * rk)           ///< RK struct.
 #endif
   *tb->optimal = INFINITY;
   for (i = 0; i < nfree; ++i)
-    tb->value_optimal[i] = tb->minimum[i] + 0.5L * tb->interval[i];
+    tb->value_optimal[i] = tb->minimum[i] + REAL (0.5) * tb->interval[i];
   if (strong)
-    for (i = 0; i < nfree2; ++i)
-      ac->value_optimal[i] = ac->minimum[i] + 0.5L * ac->interval[i];
+    {
+      *ac->optimal = INFINITY;
+      for (i = 0; i < nfree2; ++i)
+        ac->value_optimal[i] = ac->minimum0[i] + REAL (0.5) * ac->interval0[i];
+    }
+
+  // Asynchronous iterations
+  if (asynchronous)
+    {
+      optimize_asynchronous_run (tb, (OptimizeStep) (void (*)(void))
+                                 rk_step_tb_asynchronous, sizeof (RK));
+#if DEBUG_RK
+      fprintf (stderr, "rk_bucle_tb: end\n");
+#endif
+      return;
+    }
 
   // Iterate
 #if DEBUG_RK
@@ -1417,77 +1979,38 @@ rk_bucle_tb (RK * rk)           ///< RK struct.
 #endif
   for (i = 0; i < tb->niterations; ++i)
     {
-
-      // Optimization step parallelized for every node by GThreads
-      if (nthreads > 1)
-        {
-          for (j = 0; j < nthreads; ++j)
-            thread[j]
-              = g_thread_new (NULL,
-                              (GThreadFunc) (void (*)(void)) rk_step_tb,
-                              (void *) (rk + j));
-          for (j = 0; j < nthreads; ++j)
-            g_thread_join (thread[j]);
-        }
-      else
-        rk_step_tb (rk);
+      optimize_iteration (tb, sizeof (RK), i);
+      if (strong)
+        *ac->simulation_optimal = 0L;
 
 #if HAVE_MPI
-      if (rank > 0)
+      // Optimization step dynamically distributed between the nodes, the hill
+      // climbing starts from the optimal values of all the nodes
+      if (dynamic)
         {
-
-          // Secondary nodes send the optimal coefficients to the master node
-          vo[0] = *tb->optimal;
-          memcpy (vo + 1, tb->value_optimal, nfree * sizeof (long double));
-          if (strong)
-            memcpy (vo + 1 + nfree, ac->value_optimal,
-                    nfree2 * sizeof (long double));
-          MPI_Send (vo, 1 + nfree + nfree2, MPI_LONG_DOUBLE, 0, 1,
-                    MPI_COMM_WORLD);
-
-          // Secondary nodes receive the optimal coefficients
-          MPI_Recv (vo, 1 + nfree + nfree2, MPI_LONG_DOUBLE, 0, 1,
-                    MPI_COMM_WORLD, &status);
-          *tb->optimal = *ac->optimal = vo[0];
-          memcpy (tb->value_optimal, vo + 1, nfree * sizeof (long double));
-          if (strong)
-            memcpy (ac->value_optimal, vo + 1 + nfree,
-                    nfree2 * sizeof (long double));
+          optimize_dynamic_range (tb->nsimulations);
+          pool_run ((PoolFunction) (void (*)(void)) rk_step_tb, rk,
+                    sizeof (RK));
+          rk_nodes_optimal (rk, vo);
+          pool_run ((PoolFunction) (void (*)(void)) rk_climb_step, rk,
+                    sizeof (RK));
         }
       else
+#endif
         {
-          printf ("rank=%d optimal=%.19Le\n", rank, *tb->optimal);
-
-          for (j = 1; j < nnodes; ++j)
-            {
-
-              // Master node receives the optimal coefficients obtained by
-              // secondary nodes
-              MPI_Recv (vo, 1 + nfree + nfree2, MPI_LONG_DOUBLE, j, 1,
-                        MPI_COMM_WORLD, &status);
+          // Optimization step parallelized for every node by the threads pool
+          pool_range_init (tb->nsimulations * rank / nnodes,
+                           tb->nsimulations * (rank + 1) / nnodes);
+          pool_run ((PoolFunction) (void (*)(void)) rk_step_tb, rk,
+                    sizeof (RK));
+        }
 
-              // Master node selects the optimal coefficients
-              if (vo[0] < *tb->optimal)
-                {
-                  *tb->optimal = *ac->optimal = vo[0];
-                  memcpy (tb->value_optimal, vo + 1,
-                          nfree * sizeof (long double));
-                  if (strong)
-                    memcpy (ac->value_optimal, vo + 1 + nfree,
-                            nfree2 * sizeof (long double));
-                }
-            }
+#if HAVE_MPI
 
-          // Master node sends the optimal coefficients to secondary nodes
-          vo[0] = *tb->optimal;
-          memcpy (vo + 1, tb->value_optimal, nfree * sizeof (long double));
-          if (strong)
-            memcpy (vo + 1 + nfree, ac->value_optimal,
-                    nfree2 * sizeof (long double));
-          for (j = 1; j < nnodes; ++i)
-            MPI_Send (vo, 1 + nfree + nfree2, MPI_LONG_DOUBLE, j, 1,
-                      MPI_COMM_WORLD);
-        }
+      // Selecting the optimal coefficients of all the nodes
+      if (!rank)
+        printf ("rank=%d optimal=" REAL_E "\n", rank, real_e (*tb->optimal));
+      rk_nodes_optimal (rk, vo);
 
 #endif
 
@@ -1496,14 +2019,14 @@ rk_bucle_tb (RK * rk)           ///< RK struct.
       optimize_print_random (tb, stderr);
       if (strong)
         optimize_print_random (ac, stderr);
-      fprintf (stderr, "optimal=%.19Le\n", *tb->optimal);
+      fprintf (stderr, "optimal=" REAL_E "\n", real_e (*tb->optimal));
 #endif
 
       // Updating coefficient intervals to converge
-      optimize_converge (tb);
+      optimize_converge (tb, tb->value_optimal);
 
       // Iterate
-      printf ("Iteration %u Optimal %.19Le\n", i, *tb->optimal);
+      printf ("Iteration %u Optimal " REAL_E "\n", i, real_e (*tb->optimal));
     }
 
 #if DEBUG_RK
@@ -1589,7 +2112,7 @@ rk_select (RK * rk,             ///< RK struct.
     {
     NULL, NULL, &rk_tb_6_2tp, &rk_tb_6_3tp, &rk_tb_6_4tp, NULL}
   };
-  static long double (*tb_objective[7][6]) (RK *) =
+  static Real (*tb_objective[7][6]) (RK *) =
   {
     {
     NULL, NULL, NULL, NULL, NULL, NULL},
@@ -1609,7 +2132,7 @@ rk_select (RK * rk,             ///< RK struct.
     NULL, NULL, &rk_objective_tb_6_2, &rk_objective_tb_6_3,
         &rk_objective_tb_6_4, NULL}
   };
-  static long double (*tb_objective_t[7][6]) (RK *) =
+  static Real (*tb_objective_t[7][6]) (RK *) =
   {
     {
     NULL, NULL, NULL, NULL, NULL, NULL},
@@ -1629,7 +2152,7 @@ rk_select (RK * rk,             ///< RK struct.
     NULL, NULL, &rk_objective_tb_6_2t, &rk_objective_tb_6_3t,
         &rk_objective_tb_6_4t, NULL}
   };
-  static long double (*tb_objective_p[7][6]) (RK *) =
+  static Real (*tb_objective_p[7][6]) (RK *) =
   {
     {
     NULL, NULL, NULL, NULL, NULL, NULL},
@@ -1648,7 +2171,7 @@ rk_select (RK * rk,             ///< RK struct.
     NULL, NULL, &rk_objective_tb_6_2, &rk_objective_tb_6_3p,
         &rk_objective_tb_6_4p, NULL}
   };
-  static long double (*tb_objective_tp[7][6]) (RK *) =
+  static Real (*tb_objective_tp[7][6]) (RK *) =
   {
     {
     NULL, NULL, NULL, NULL, NULL, NULL},
@@ -1667,10 +2190,76 @@ rk_select (RK * rk,             ///< RK struct.
     NULL, NULL, &rk_objective_tb_6_2t, &rk_objective_tb_6_3tp,
         &rk_objective_tb_6_4tp, NULL}
   };
+  static void (*tb_batch[7][6]) (Optimize *) =
+  {
+    {
+    NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+    NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+    NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+    NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+    NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+    NULL, NULL, NULL, &rk_batch_tb_5_3, &rk_batch_tb_5_4, NULL},
+    {
+    NULL, NULL, NULL, &rk_batch_tb_6_3, &rk_batch_tb_6_4, NULL}
+  };
+#if OPTIMIZE_SPECIALIZED
+  static Real (*tb_evaluate[7][6]) (void *) =
+  {
+    {
+    NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+    NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+    NULL, NULL, &rk_tb_2_2_evaluate, NULL, NULL, NULL},
+    {
+    NULL, NULL, &rk_tb_3_2_evaluate, &rk_tb_3_3_evaluate, NULL, NULL},
+    {
+    NULL, NULL, &rk_tb_4_2_evaluate, &rk_tb_4_3_evaluate,
+        &rk_tb_4_4_evaluate, NULL},
+    {
+    NULL, NULL, &rk_tb_5_2_evaluate, &rk_tb_5_3_evaluate,
+        &rk_tb_5_4_evaluate, NULL},
+    {
+    NULL, NULL, &rk_tb_6_2_evaluate, &rk_tb_6_3_evaluate,
+        &rk_tb_6_4_evaluate, NULL}
+  };
+  static OptimizeSample tb_sample[7][6] = {
+    {
+     NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+     NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+     NULL, NULL, &rk_tb_2_2_sample, NULL, NULL, NULL},
+    {
+     NULL, NULL, &rk_tb_3_2_sample, &rk_tb_3_3_sample, NULL, NULL},
+    {
+     NULL, NULL, &rk_tb_4_2_sample, &rk_tb_4_3_sample, &rk_tb_4_4_sample,
+     NULL},
+    {
+     NULL, NULL, &rk_tb_5_2_sample, &rk_tb_5_3_sample, &rk_tb_5_4_sample,
+     NULL},
+    {
+     NULL, NULL, &rk_tb_6_2_sample, &rk_tb_6_3_sample, &rk_tb_6_4_sample,
+     NULL}
+  };
+  static Real (*ac_evaluate[7]) (void *) =
+  {
+  NULL, NULL, &rk_ac_2_evaluate, &rk_ac_3_evaluate, &rk_ac_4_evaluate,
+      &rk_ac_5_evaluate, &rk_ac_6_evaluate};
+  static OptimizeSample ac_sample[7] = {
+    NULL, NULL, &rk_ac_2_sample, &rk_ac_3_sample, &rk_ac_4_sample,
+    &rk_ac_5_sample, &rk_ac_6_sample
+  };
+#endif
   static int (*ac_method[7]) (RK *) =
   {
   NULL, NULL, &rk_ac_2, &rk_ac_3, &rk_ac_4, &rk_ac_5, &rk_ac_6};
-  static long double (*ac_objective[7]) (RK * rk) =
+  static Real (*ac_objective[7]) (RK * rk) =
   {
   NULL, NULL, &rk_objective_ac_2, &rk_objective_ac_3, &rk_objective_ac_4,
       &rk_objective_ac_5, &rk_objective_ac_6};
@@ -1685,6 +2274,13 @@ rk_select (RK * rk,             ///< RK struct.
   tb->order = order;
   tb->size = nsteps * (nsteps + 3) / 2 - 1;
   tb->nfree = tb->size - nsteps + 1 - nequations[order];
+  tb->batch = NULL;
+  tb->evaluate = NULL;
+  tb->sample = NULL;
+  tb->probe = NULL;
+  tb->polytope = NULL;
+  tb->npolytope = 0;
+  tb->nelite = 0;
   if (rk->pair)
     {
       tb->size += nsteps - 1;
@@ -1710,6 +2306,12 @@ rk_select (RK * rk,             ///< RK struct.
         {
           tb->method = tb_method[nsteps][order];
           tb->objective = (OptimizeObjective) tb_objective[nsteps][order];
+          if (batch && !rk->strong)
+            tb->batch = tb_batch[nsteps][order];
+#if OPTIMIZE_SPECIALIZED
+          tb->evaluate = tb_evaluate[nsteps][order];
+          tb->sample = tb_sample[nsteps][order];
+#endif
         }
     }
   if (!tb->method)
@@ -1737,9 +2339,9 @@ rk_select (RK * rk,             ///< RK struct.
           }
     }
   tb->minimum0
-    = (long double *) g_slice_alloc (tb->nfree * sizeof (long double));
+    = (Real *) g_slice_alloc (tb->nfree * sizeof (Real));
   tb->interval0
-    = (long double *) g_slice_alloc (tb->nfree * sizeof (long double));
+    = (Real *) g_slice_alloc (tb->nfree * sizeof (Real));
   tb->random_type
     = (unsigned int *) g_slice_alloc (tb->nfree * sizeof (unsigned int));
   if (rk->strong)
@@ -1748,15 +2350,27 @@ rk_select (RK * rk,             ///< RK struct.
       ac->size = nsteps * (nsteps + 1) - 2;
       ac->nfree = nsteps * (nsteps - 1) / 2;
       ac->minimum0
-        = (long double *) g_slice_alloc (ac->nfree * sizeof (long double));
+        = (Real *) g_slice_alloc (ac->nfree * sizeof (Real));
       ac->interval0
-        = (long double *) g_slice_alloc (ac->nfree * sizeof (long double));
+        = (Real *) g_slice_alloc (ac->nfree * sizeof (Real));
       ac->random_type
         = (unsigned int *) g_slice_alloc (ac->nfree * sizeof (unsigned int));
       ac->method = (OptimizeMethod) ac_method[nsteps];
       if (!ac->method)
         goto exit_on_error;
       ac->objective = (OptimizeObjective) ac_objective[nsteps];
+      ac->batch = batch ? (void (*)(Optimize *)) &rk_batch_ac : NULL;
+#if OPTIMIZE_SPECIALIZED
+      ac->evaluate = ac_evaluate[nsteps];
+      ac->sample = ac_sample[nsteps];
+#else
+      ac->evaluate = NULL;
+      ac->sample = NULL;
+#endif
+      ac->probe = NULL;
+      ac->polytope = NULL;
+      ac->npolytope = 0;
+      ac->nelite = 0;
     }
 
 #if DEBUG_RK
@@ -1779,23 +2393,33 @@ exit_on_error:
  */
 int
 rk_run (xmlNode * node,         ///< XML node.
-        gsl_rng ** rng)         ///< array of gsl_rng structs.
+        unsigned long long int seed)    ///< pseudo-random numbers seed.
 {
-  RK rk[nthreads];
+  RK *rk;
   char filename[64];
   Optimize *tb, *ac;
   gchar *buffer;
   xmlChar *prop;
   FILE *file;
-  long double *value_optimal, *value_optimal2;
-  long double optimal, optimal2;
+  Real *value_optimal, *value_optimal2;
+  Real optimal, optimal2;
+  size_t size;
+  unsigned long long int simulation, simulation2;
   int code;
-  unsigned int i, j, nsteps, order, nfree, nfree2;
+  unsigned int i, nsteps, order, nfree, nfree2, sequence, sequence2;
 
 #if DEBUG_RK
   fprintf (stderr, "rk_run: start\n");
 #endif
 
+  size = nthreads * sizeof (RK);
+  size = (size + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+  rk = (RK *) aligned_alloc (CACHE_LINE_SIZE, size);
+  if (!rk)
+    {
+      error_message = g_strdup (_("Not enough memory"));
+      goto exit_on_error;
+    }
   tb = rk->tb;
   nsteps = xml_node_get_uint (node, XML_STEPS, &code);
   if (code)
@@ -1847,8 +2471,8 @@ rk_run (xmlNode * node,         ///< XML node.
   if (!optimize_read (tb, node))
     goto exit_on_error;
   nfree = tb->nfree;
-  value_optimal = (long double *) g_slice_alloc (nfree * sizeof (long double));
-  optimize_create (tb, &optimal, value_optimal);
+  value_optimal = (Real *) g_slice_alloc (nfree * sizeof (Real));
+  optimize_create (tb, &optimal, value_optimal, &sequence, &simulation);
   node = node->children;
   for (i = 0; i < nfree; ++i, node = node->next)
     if (!read_variable (node, tb->minimum0, tb->interval0, tb->random_type, i))
@@ -1876,8 +2500,9 @@ rk_run (xmlNode * node,         ///< XML node.
         }
       nfree2 = ac->nfree;
       value_optimal2
-        = (long double *) g_slice_alloc (nfree2 * sizeof (long double));
-      optimize_create (ac, &optimal2, value_optimal2);
+        = (Real *) g_slice_alloc (nfree2 * sizeof (Real));
+      optimize_create (ac, &optimal2, value_optimal2, &sequence2,
+                       &simulation2);
       for (i = 0; i < nfree2; ++i)
         {
           node = node->next;
@@ -1888,23 +2513,40 @@ rk_run (xmlNode * node,         ///< XML node.
     }
   for (i = 1; i < nthreads; ++i)
     memcpy (rk + i, rk, sizeof (RK));
-  j = rank * nthreads;
   for (i = 0; i < nthreads; ++i)
-    rk_init (rk + i, rng[j + i], i);
+    {
+      rk[i].tb->seed = rk[i].ac0->seed = seed;
+      rk[i].tb->thread = i;
+      rk[i].ac0->thread = 0;
+    }
+  pool_run ((PoolFunction) (void (*)(void)) rk_init, rk, sizeof (RK));
+  for (i = 0; i < nthreads; ++i)
+    if (!rk[i].tb->random_data || (rk->strong && !rk[i].ac->random_data))
+      {
+        for (i = 0; i < nthreads; ++i)
+          rk_delete (rk + i);
+        error_message = g_strdup (_("Not enough memory"));
+        goto exit_on_error;
+      }
 
   // Method bucle
   printf ("Optimize bucle\n");
   rk_bucle_tb (rk);
+  if (rk->strong)
+    optimize_print_rejected (rk->ac, sizeof (RK), "a-c");
 
-  // Print the optimal coefficients
+  // Print the optimal coefficients, the coefficients not calculated by a
+  // failing method are printed as zero instead of the ones of the last
+  // evaluation of the thread
   printf ("Print the optimal coefficients\n");
-  memcpy (tb->random_data, tb->value_optimal, nfree * sizeof (long double));
+  memcpy (tb->random_data, tb->value_optimal, nfree * sizeof (Real));
+  memset (tb->coefficient, 0, tb->size * sizeof (Real));
   code = tb->method (tb);
   if (rk->strong)
     {
-      memcpy (ac->random_data, ac->value_optimal,
-              nfree2 * sizeof (long double));
-      memcpy (rk->ac, ac, sizeof (Optimize));
+      memcpy (rk->ac->random_data, ac->value_optimal,
+              nfree2 * sizeof (Real));
+      memset (rk->ac->coefficient, 0, rk->ac->size * sizeof (Real));
       code = ac->method ((Optimize *) rk);
     }
   snprintf (filename, 64, "rk-%u-%u-%u-%u-%u.mc",
@@ -1929,16 +2571,17 @@ rk_run (xmlNode * node,         ///< XML node.
   if (rk->strong)
     {
       g_slice_free1 (nfree2 * sizeof (unsigned int), ac->random_type);
-      g_slice_free1 (nfree2 * sizeof (long double), ac->interval0);
-      g_slice_free1 (nfree2 * sizeof (long double), ac->minimum0);
-      g_slice_free1 (nfree2 * sizeof (long double), value_optimal2);
+      g_slice_free1 (nfree2 * sizeof (Real), ac->interval0);
+      g_slice_free1 (nfree2 * sizeof (Real), ac->minimum0);
+      g_slice_free1 (nfree2 * sizeof (Real), value_optimal2);
     }
   for (i = 0; i < nthreads; ++i)
     rk_delete (rk + i);
   g_slice_free1 (nfree * sizeof (unsigned int), tb->random_type);
-  g_slice_free1 (nfree * sizeof (long double), tb->interval0);
-  g_slice_free1 (nfree * sizeof (long double), tb->minimum0);
-  g_slice_free1 (nfree * sizeof (long double), value_optimal);
+  g_slice_free1 (nfree * sizeof (Real), tb->interval0);
+  g_slice_free1 (nfree * sizeof (Real), tb->minimum0);
+  g_slice_free1 (nfree * sizeof (Real), value_optimal);
+  free (rk);
 
 
 #if DEBUG_RK
@@ -1947,6 +2590,7 @@ rk_run (xmlNode * node,         ///< XML node.
   return 1;
 
 exit_on_error:
+  free (rk);
   buffer = error_message;
   error_message = g_strconcat ("Runge-Kutta:\n", buffer, NULL);
   g_free (buffer);
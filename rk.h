@@ -47,6 +47,9 @@ typedef struct
   ///< Optimize struct to define a-c coefficients data and methods.
   Optimize ac0[1];
   ///< Optimize struct to define initial a-c coefficients data and methods.
+  Real ac_optimal;
+  ///< optimal objective function value of the a-c coefficients for the actual
+  ///< t-b coefficients.
   unsigned int strong;          ///< boolean to cope with strong stability.
   unsigned int time_accuracy;
   ///< boolean to cope with extended time accuracy.
@@ -55,6 +58,9 @@ typedef struct
 
 #define RUNGE_KUTTA(o) ((Optimize *)((Optimize *)o)->data)
 ///< macro to get the Optimize external data.
+#define rk_lane(c, x, l) ((x)[OPTIMIZE_BATCH * (&c (x) - (x)) + (l)])
+///< macro to get a Runge-Kutta coefficient of the lane l of a batch stored as
+///< structure of arrays.
 #define t1(x) x[0]              ///< t1 Runge-Kutta coefficient.
 #define t2(x) x[1]              ///< t2 Runge-Kutta coefficient.
 #define b20(x) x[2]             ///< b20 Runge-Kutta coefficient.
@@ -140,13 +146,13 @@ typedef struct
 void rk_print_tb (Optimize * tb, char *label, FILE * file);
 void rk_print_e (Optimize * tb, char *label, FILE * file);
 void rk_bucle_ac (RK * rk);
-int rk_run (xmlNode * node, gsl_rng ** rng);
+int rk_run (xmlNode * node, unsigned long long int seed);
 
 /**
  * Function to get \f$b_{i0}\f$ coefficients of the 2 steps Runge-Kutta methods.
  */
 static inline void
-rk_b_2 (long double *tb)        ///< array of Runge-Kutta t-b coefficients.
+rk_b_2 (Real *tb)               ///< array of Runge-Kutta t-b coefficients.
 {
   b20 (tb) = t2 (tb) - b21 (tb);
 }
@@ -155,7 +161,7 @@ rk_b_2 (long double *tb)        ///< array of Runge-Kutta t-b coefficients.
  * Function to get \f$b_{i0}\f$ coefficients of the 3 steps Runge-Kutta methods.
  */
 static inline void
-rk_b_3 (long double *tb)        ///< array of Runge-Kutta coefficients.
+rk_b_3 (Real *tb)               ///< array of Runge-Kutta coefficients.
 {
   rk_b_2 (tb);
   b30 (tb) = t3 (tb) - b31 (tb) - b32 (tb);
@@ -165,7 +171,7 @@ rk_b_3 (long double *tb)        ///< array of Runge-Kutta coefficients.
  * Function to get \f$b_{i0}\f$ coefficients of the 4 steps Runge-Kutta methods.
  */
 static inline void
-rk_b_4 (long double *tb)        ///< array of Runge-Kutta coefficients.
+rk_b_4 (Real *tb)               ///< array of Runge-Kutta coefficients.
 {
   rk_b_3 (tb);
   b40 (tb) = t4 (tb) - b41 (tb) - b42 (tb) - b43 (tb);
@@ -175,7 +181,7 @@ rk_b_4 (long double *tb)        ///< array of Runge-Kutta coefficients.
  * Function to get \f$b_{i0}\f$ coefficients of the 5 steps Runge-Kutta methods.
  */
 static inline void
-rk_b_5 (long double *tb)        ///< array of Runge-Kutta coefficients.
+rk_b_5 (Real *tb)               ///< array of Runge-Kutta coefficients.
 {
   rk_b_4 (tb);
   b50 (tb) = t5 (tb) - b51 (tb) - b52 (tb) - b53 (tb) - b54 (tb);
@@ -185,20 +191,84 @@ rk_b_5 (long double *tb)        ///< array of Runge-Kutta coefficients.
  * Function to get \f$b_{i0}\f$ coefficients of the 6 steps Runge-Kutta methods.
  */
 static inline void
-rk_b_6 (long double *tb)        ///< array of Runge-Kutta coefficients.
+rk_b_6 (Real *tb)               ///< array of Runge-Kutta coefficients.
 {
   rk_b_5 (tb);
   b60 (tb) = t6 (tb) - b61 (tb) - b62 (tb) - b63 (tb) - b64 (tb) - b65 (tb);
 }
 
+/**
+ * Function to get \f$b_{i0}\f$ coefficients of a lane of a batch of 2 steps
+ * Runge-Kutta methods.
+ */
+static inline void
+rk_batch_b_2 (double *tb,       ///< batch of Runge-Kutta t-b coefficients.
+              unsigned int l)   ///< lane.
+{
+  rk_lane (b20, tb, l) = rk_lane (t2, tb, l) - rk_lane (b21, tb, l);
+}
+
+/**
+ * Function to get \f$b_{i0}\f$ coefficients of a lane of a batch of 3 steps
+ * Runge-Kutta methods.
+ */
+static inline void
+rk_batch_b_3 (double *tb,       ///< batch of Runge-Kutta t-b coefficients.
+              unsigned int l)   ///< lane.
+{
+  rk_batch_b_2 (tb, l);
+  rk_lane (b30, tb, l) = rk_lane (t3, tb, l) - rk_lane (b31, tb, l)
+    - rk_lane (b32, tb, l);
+}
+
+/**
+ * Function to get \f$b_{i0}\f$ coefficients of a lane of a batch of 4 steps
+ * Runge-Kutta methods.
+ */
+static inline void
+rk_batch_b_4 (double *tb,       ///< batch of Runge-Kutta t-b coefficients.
+              unsigned int l)   ///< lane.
+{
+  rk_batch_b_3 (tb, l);
+  rk_lane (b40, tb, l) = rk_lane (t4, tb, l) - rk_lane (b41, tb, l)
+    - rk_lane (b42, tb, l) - rk_lane (b43, tb, l);
+}
+
+/**
+ * Function to get \f$b_{i0}\f$ coefficients of a lane of a batch of 5 steps
+ * Runge-Kutta methods.
+ */
+static inline void
+rk_batch_b_5 (double *tb,       ///< batch of Runge-Kutta t-b coefficients.
+              unsigned int l)   ///< lane.
+{
+  rk_batch_b_4 (tb, l);
+  rk_lane (b50, tb, l) = rk_lane (t5, tb, l) - rk_lane (b51, tb, l)
+    - rk_lane (b52, tb, l) - rk_lane (b53, tb, l) - rk_lane (b54, tb, l);
+}
+
+/**
+ * Function to get \f$b_{i0}\f$ coefficients of a lane of a batch of 6 steps
+ * Runge-Kutta methods.
+ */
+static inline void
+rk_batch_b_6 (double *tb,       ///< batch of Runge-Kutta t-b coefficients.
+              unsigned int l)   ///< lane.
+{
+  rk_batch_b_5 (tb, l);
+  rk_lane (b60, tb, l) = rk_lane (t6, tb, l) - rk_lane (b61, tb, l)
+    - rk_lane (b62, tb, l) - rk_lane (b63, tb, l) - rk_lane (b64, tb, l)
+    - rk_lane (b65, tb, l);
+}
+
 /**
  * Function to get \f$\hat{b}_{30}\f$ coefficient of the 3 steps Runge-Kutta
  * pairs.
  */
 static inline void
-rk_e_3 (long double *tb)        ///< array of Runge-Kutta coefficients.
+rk_e_3 (Real *tb)               ///< array of Runge-Kutta coefficients.
 {
-  e30 (tb) = 1.L - e31 (tb);
+  e30 (tb) = REAL (1.) - e31 (tb);
 }
 
 /**
@@ -206,9 +276,9 @@ rk_e_3 (long double *tb)        ///< array of Runge-Kutta coefficients.
  * pairs.
  */
 static inline void
-rk_e_4 (long double *tb)        ///< array of Runge-Kutta coefficients.
+rk_e_4 (Real *tb)               ///< array of Runge-Kutta coefficients.
 {
-  e40 (tb) = 1.L - e41 (tb) - e42 (tb);
+  e40 (tb) = REAL (1.) - e41 (tb) - e42 (tb);
 }
 
 /**
@@ -216,9 +286,9 @@ rk_e_4 (long double *tb)        ///< array of Runge-Kutta coefficients.
  * pairs.
  */
 static inline void
-rk_e_5 (long double *tb)        ///< array of Runge-Kutta coefficients.
+rk_e_5 (Real *tb)               ///< array of Runge-Kutta coefficients.
 {
-  e50 (tb) = 1.L - e51 (tb) - e52 (tb) - e53 (tb);
+  e50 (tb) = REAL (1.) - e51 (tb) - e52 (tb) - e53 (tb);
 }
 
 /**
@@ -226,9 +296,9 @@ rk_e_5 (long double *tb)        ///< array of Runge-Kutta coefficients.
  * pairs.
  */
 static inline void
-rk_e_6 (long double *tb)        ///< array of Runge-Kutta coefficients.
+rk_e_6 (Real *tb)               ///< array of Runge-Kutta coefficients.
 {
-  e60 (tb) = 1.L - e61 (tb) - e62 (tb) - e63 (tb) - e64 (tb);
+  e60 (tb) = REAL (1.) - e61 (tb) - e62 (tb) - e63 (tb) - e64 (tb);
 }
 
 /**
@@ -236,11 +306,11 @@ rk_e_6 (long double *tb)        ///< array of Runge-Kutta coefficients.
  *
  * \return CFL value.
  */
-static inline long double
-rk_cfl_2 (long double *tb,      ///< array of Runge-Kutta t-b coefficients.
-          long double *ac)      ///< array of Runge-Kutta a-c coefficients.
+static inline Real
+rk_cfl_2 (Real *tb,             ///< array of Runge-Kutta t-b coefficients.
+          Real *ac)             ///< array of Runge-Kutta a-c coefficients.
 {
-  return 1.L / fmaxl (t1 (tb), fmaxl (c20 (ac), c21 (ac)));
+  return REAL (1.) / fmaxr (t1 (tb), fmaxr (c20 (ac), c21 (ac)));
 }
 
 /**
@@ -248,12 +318,12 @@ rk_cfl_2 (long double *tb,      ///< array of Runge-Kutta t-b coefficients.
  *
  * \return CFL value.
  */
-static inline long double
-rk_cfl_3 (long double *tb,      ///< array of Runge-Kutta t-b coefficients.
-          long double *ac)      ///< array of Runge-Kutta a-c coefficients.
+static inline Real
+rk_cfl_3 (Real *tb,             ///< array of Runge-Kutta t-b coefficients.
+          Real *ac)             ///< array of Runge-Kutta a-c coefficients.
 {
-  return fminl (rk_cfl_2 (tb, ac),
-                1.L / fmaxl (c30 (ac), fmaxl (c31 (ac), c32 (ac))));
+  return fminr (rk_cfl_2 (tb, ac),
+                REAL (1.) / fmaxr (c30 (ac), fmaxr (c31 (ac), c32 (ac))));
 }
 
 /**
@@ -261,13 +331,14 @@ rk_cfl_3 (long double *tb,      ///< array of Runge-Kutta t-b coefficients.
  *
  * \return CFL value.
  */
-static inline long double
-rk_cfl_4 (long double *tb,      ///< array of Runge-Kutta t-b coefficients.
-          long double *ac)      ///< array of Runge-Kutta a-c coefficients.
+static inline Real
+rk_cfl_4 (Real *tb,             ///< array of Runge-Kutta t-b coefficients.
+          Real *ac)             ///< array of Runge-Kutta a-c coefficients.
 {
-  return fminl (rk_cfl_3 (tb, ac),
-                1.L / fmaxl (c40 (ac),
-                             fmaxl (c41 (ac), fmaxl (c42 (ac), c43 (ac)))));
+  return fminr (rk_cfl_3 (tb, ac),
+                REAL (1.) / fmaxr (c40 (ac),
+                                   fmaxr (c41 (ac),
+                                          fmaxr (c42 (ac), c43 (ac)))));
 }
 
 /**
@@ -275,15 +346,16 @@ rk_cfl_4 (long double *tb,      ///< array of Runge-Kutta t-b coefficients.
  *
  * \return CFL value.
  */
-static inline long double
-rk_cfl_5 (long double *tb,      ///< array of Runge-Kutta t-b coefficients.
-          long double *ac)      ///< array of Runge-Kutta a-c coefficients.
+static inline Real
+rk_cfl_5 (Real *tb,             ///< array of Runge-Kutta t-b coefficients.
+          Real *ac)             ///< array of Runge-Kutta a-c coefficients.
 {
   return
-    fminl (rk_cfl_4 (tb, ac),
-           1.L / fmaxl (c50 (ac),
-                        fmaxl (c51 (ac),
-                               fmaxl (c52 (ac), fmaxl (c53 (ac), c54 (ac))))));
+    fminr (rk_cfl_4 (tb, ac),
+           REAL (1.) / fmaxr (c50 (ac),
+                              fmaxr (c51 (ac),
+                                     fmaxr (c52 (ac),
+                                            fmaxr (c53 (ac), c54 (ac))))));
 }
 
 /**
@@ -291,17 +363,18 @@ rk_cfl_5 (long double *tb,      ///< array of Runge-Kutta t-b coefficients.
  *
  * \return CFL value.
  */
-static inline long double
-rk_cfl_6 (long double *tb,      ///< array of Runge-Kutta t-b coefficients.
-          long double *ac)      ///< array of Runge-Kutta a-c coefficients.
+static inline Real
+rk_cfl_6 (Real *tb,             ///< array of Runge-Kutta t-b coefficients.
+          Real *ac)             ///< array of Runge-Kutta a-c coefficients.
 {
   return
-    fminl (rk_cfl_5 (tb, ac),
-           1.L / fmaxl (c60 (ac),
-                        fmaxl (c61 (ac),
-                               fmaxl (c62 (ac),
-                                      fmaxl (c63 (ac),
-                                             fmaxl (c64 (ac), c65 (ac)))))));
+    fminr (rk_cfl_5 (tb, ac),
+           REAL (1.) / fmaxr (c60 (ac),
+                              fmaxr (c61 (ac),
+                                     fmaxr (c62 (ac),
+                                            fmaxr (c63 (ac),
+                                                   fmaxr (c64 (ac),
+                                                          c65 (ac)))))));
 }
 
 #endif
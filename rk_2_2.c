@@ -37,7 +37,6 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #include "config.h"
 #include "utils.h"
 #include "optimize.h"
@@ -53,15 +52,15 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 int
 rk_tb_2_2 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_2_2
   fprintf (stderr, "rk_tb_2_2: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t2 (tb) = 1.L;
+  t2 (tb) = REAL (1.);
   t1 (tb) = r[0];
-  b21 (tb) = 0.5L / t1 (tb);
+  b21 (tb) = REAL (0.5) / t1 (tb);
   rk_b_2 (tb);
 #if DEBUG_RK_2_2
   rk_print_tb (optimize, "rk_tb_2_2", stderr);
@@ -77,14 +76,14 @@ rk_tb_2_2 (Optimize * optimize) ///< Optimize struct.
 int
 rk_tb_2_2t (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_2_2
   fprintf (stderr, "rk_tb_2_2t: start\n");
 #endif
   tb = optimize->coefficient;
-  t2 (tb) = 1.L;
-  t1 (tb) = 2.L / 3.L;
-  b21 (tb) = 0.5L / t1 (tb);
+  t2 (tb) = REAL (1.);
+  t1 (tb) = REAL (2.) / REAL (3.);
+  b21 (tb) = REAL (0.5) / t1 (tb);
   rk_b_2 (tb);
 #if DEBUG_RK_2_2
   rk_print_tb (optimize, "rk_tb_2_2t", stderr);
@@ -100,14 +99,14 @@ rk_tb_2_2t (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_2_2p (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_2_2
   fprintf (stderr, "rk_tb_2_2p: start\n");
 #endif
   if (!rk_tb_2_2 (optimize))
     return 0;
   tb = optimize->coefficient;
-  e20 (tb) = 1.L;
+  e20 (tb) = REAL (1.);
 #if DEBUG_RK_2_2
   rk_print_tb (optimize, "rk_tb_2_2p", stderr);
   fprintf (stderr, "rk_tb_2_2p: end\n");
@@ -122,14 +121,14 @@ rk_tb_2_2p (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_2_2tp (Optimize * optimize)       ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_2_2
   fprintf (stderr, "rk_tb_2_2tp: start\n");
 #endif
   if (!rk_tb_2_2t (optimize))
     return 0;
   tb = optimize->coefficient;
-  e20 (tb) = 1.L;
+  e20 (tb) = REAL (1.);
 #if DEBUG_RK_2_2
   rk_print_tb (optimize, "rk_tb_2_2tp", stderr);
   fprintf (stderr, "rk_tb_2_2tp: end\n");
@@ -143,29 +142,29 @@ rk_tb_2_2tp (Optimize * optimize)       ///< Optimize struct.
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_2_2 (RK * rk)   ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_2_2
   fprintf (stderr, "rk_objective_tb_2_2: start\n");
 #endif
   tb = rk->tb->coefficient;
-  if (b20 (tb) < 0.L)
+  if (b20 (tb) < REAL (0.))
     {
-      o = 40.L - b20 (tb);
+      o = REAL (40.) - b20 (tb);
       goto end;
     }
-  o = 30.L + fmaxl (1.L, t1 (tb));
+  o = REAL (30.) + fmaxr (REAL (1.), t1 (tb));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_2_2
-  fprintf (stderr, "rk_objective_tb_2_2: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_2_2: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_2_2: end\n");
 #endif
   return o;
@@ -177,21 +176,21 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_2_2t (RK * rk)  ///< RK struct.
 {
-  long double o;
+  Real o;
 #if DEBUG_RK_2_2
   fprintf (stderr, "rk_objective_tb_2_2t: start\n");
 #endif
-  o = 31.L;
+  o = REAL (31.);
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 #if DEBUG_RK_2_2
-  fprintf (stderr, "rk_objective_tb_2_2t: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_2_2t: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_2_2t: end\n");
 #endif
   return o;
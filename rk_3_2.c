@@ -37,7 +37,6 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #include "config.h"
 #include "utils.h"
 #include "optimize.h"
@@ -53,18 +52,18 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 int
 rk_tb_3_2 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_3_2
   fprintf (stderr, "rk_tb_3_2: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t3 (tb) = 1.L;
+  t3 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
   b32 (tb) = r[3];
-  b31 (tb) = (0.5L - b32 (tb) * t2 (tb)) / t1 (tb);
+  b31 (tb) = (REAL (0.5) - b32 (tb) * t2 (tb)) / t1 (tb);
   if (isnan (b31 (tb)))
     return 0;
   rk_b_3 (tb);
@@ -82,20 +81,21 @@ rk_tb_3_2 (Optimize * optimize) ///< Optimize struct.
 int
 rk_tb_3_2t (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_3_2
   fprintf (stderr, "rk_tb_3_2t: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t3 (tb) = 1.L;
+  t3 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
-  b32 (tb) = (1.L / 3.L - 0.5L * t1 (tb)) / (t2 (tb) * (t2 (tb) - t1 (tb)));
+  b32 (tb) = (REAL (1.) / REAL (3.) - REAL (0.5) * t1 (tb))
+    / (t2 (tb) * (t2 (tb) - t1 (tb)));
   if (isnan (b32 (tb)))
     return 0;
-  b31 (tb) = (0.5L - b32 (tb) * t2 (tb)) / t1 (tb);
+  b31 (tb) = (REAL (0.5) - b32 (tb) * t2 (tb)) / t1 (tb);
   if (isnan (b31 (tb)))
     return 0;
   rk_b_3 (tb);
@@ -113,14 +113,14 @@ rk_tb_3_2t (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_3_2p (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_3_2
   fprintf (stderr, "rk_tb_3_2p: start\n");
 #endif
   if (!rk_tb_3_2 (optimize))
     return 0;
   tb = optimize->coefficient;
-  e31 (tb) = 0.L;
+  e31 (tb) = REAL (0.);
   rk_e_3 (tb);
 #if DEBUG_RK_3_2
   rk_print_e (optimize, "rk_tb_3_2p", stderr);
@@ -136,14 +136,14 @@ rk_tb_3_2p (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_3_2tp (Optimize * optimize)       ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_3_2
   fprintf (stderr, "rk_tb_3_2tp: start\n");
 #endif
   if (!rk_tb_3_2t (optimize))
     return 0;
   tb = optimize->coefficient;
-  e31 (tb) = 0.L;
+  e31 (tb) = REAL (0.);
   rk_e_3 (tb);
 #if DEBUG_RK_3_2
   rk_print_tb (optimize, "rk_tb_3_2tp", stderr);
@@ -158,34 +158,34 @@ rk_tb_3_2tp (Optimize * optimize)       ///< Optimize struct.
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_3_2 (RK * rk)   ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_3_2
   fprintf (stderr, "rk_objective_tb_3_2: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b31 (tb) < 0.L)
+  if (b31 (tb) < REAL (0.))
     o += b31 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L + fmaxl (1.L, fmaxl (t1 (tb), t2 (tb)));
+  o = REAL (30.) + fmaxr (REAL (1.), fmaxr (t1 (tb), t2 (tb)));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_3_2
-  fprintf (stderr, "rk_objective_tb_3_2: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_3_2: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_3_2: end\n");
 #endif
   return o;
@@ -197,36 +197,36 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_3_2t (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_3_2
   fprintf (stderr, "rk_objective_tb_3_2t: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b31 (tb) < 0.L)
+  if (b31 (tb) < REAL (0.))
     o += b31 (tb);
-  if (b32 (tb) < 0.L)
+  if (b32 (tb) < REAL (0.))
     o += b32 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L + fmaxl (1.L, fmaxl (t1 (tb), t2 (tb)));
+  o = REAL (30.) + fmaxr (REAL (1.), fmaxr (t1 (tb), t2 (tb)));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_3_2
-  fprintf (stderr, "rk_objective_tb_3_2t: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_3_2t: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_3_2t: end\n");
 #endif
   return o;
@@ -38,7 +38,7 @@ int rk_tb_3_2 (Optimize * optimize);
 int rk_tb_3_2t (Optimize * optimize);
 int rk_tb_3_2p (Optimize * optimize);
 int rk_tb_3_2tp (Optimize * optimize);
-long double rk_objective_tb_3_2 (RK * rk);
-long double rk_objective_tb_3_2t (RK * rk);
+Real rk_objective_tb_3_2 (RK * rk);
+Real rk_objective_tb_3_2t (RK * rk);
 
 #endif
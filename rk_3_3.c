@@ -37,7 +37,6 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #include "config.h"
 #include "utils.h"
 #include "optimize.h"
@@ -53,22 +52,24 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 int
 rk_tb_3_3 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_3_3
   fprintf (stderr, "rk_tb_3_3: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t3 (tb) = 1.L;
+  t3 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
-  b32 (tb) = (1.L / 3.L - 0.5L * t1 (tb)) / (t2 (tb) * (t2 (tb) - t1 (tb)));
+  b32 (tb) = (REAL (1.) / REAL (3.) - REAL (0.5) * t1 (tb))
+    / (t2 (tb) * (t2 (tb) - t1 (tb)));
   if (isnan (b32 (tb)))
     return 0;
-  b31 (tb) = (1.L / 3.L - 0.5L * t2 (tb)) / (t1 (tb) * (t1 (tb) - t2 (tb)));
+  b31 (tb) = (REAL (1.) / REAL (3.) - REAL (0.5) * t2 (tb))
+    / (t1 (tb) * (t1 (tb) - t2 (tb)));
   if (isnan (b31 (tb)))
     return 0;
-  b21 (tb) = 1 / 6.L / (b32 (tb) * t1 (tb));
+  b21 (tb) = 1 / REAL (6.) / (b32 (tb) * t1 (tb));
   if (isnan (b21 (tb)))
     return 0;
   rk_b_3 (tb);
@@ -86,24 +87,27 @@ rk_tb_3_3 (Optimize * optimize) ///< Optimize struct.
 int
 rk_tb_3_3t (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_3_3
   fprintf (stderr, "rk_tb_3_3t: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t3 (tb) = 1.L;
+  t3 (tb) = REAL (1.);
   t1 (tb) = r[0];
-  t2 (tb) = (4.L * t1 (tb) - 3.L) / (6.L * t1 (tb) - 4.L);
+  t2 (tb)
+    = (REAL (4.) * t1 (tb) - REAL (3.)) / (REAL (6.) * t1 (tb) - REAL (4.));
   if (isnan (t2 (tb)))
     return 0;
-  b32 (tb) = (1.L / 3.L - 0.5L * t1 (tb)) / (t2 (tb) * (t2 (tb) - t1 (tb)));
+  b32 (tb) = (REAL (1.) / REAL (3.) - REAL (0.5) * t1 (tb))
+    / (t2 (tb) * (t2 (tb) - t1 (tb)));
   if ((b32 (tb)))
     return 0;
-  b31 (tb) = (1.L / 3.L - 0.5L * t2 (tb)) / (t1 (tb) * (t1 (tb) - t2 (tb)));
+  b31 (tb) = (REAL (1.) / REAL (3.) - REAL (0.5) * t2 (tb))
+    / (t1 (tb) * (t1 (tb) - t2 (tb)));
   if (isnan (b31 (tb)))
     return 0;
-  b21 (tb) = 1 / 6.L / (b32 (tb) * t1 (tb));
+  b21 (tb) = 1 / REAL (6.) / (b32 (tb) * t1 (tb));
   if (isnan (b21 (tb)))
     return 0;
   rk_b_3 (tb);
@@ -121,14 +125,14 @@ rk_tb_3_3t (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_3_3p (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_3_3
   fprintf (stderr, "rk_tb_3_3p: start\n");
 #endif
   if (!rk_tb_3_3 (optimize))
     return 0;
   tb = optimize->coefficient;
-  e31 (tb) = 0.5L / t1 (tb);
+  e31 (tb) = REAL (0.5) / t1 (tb);
   rk_e_3 (tb);
 #if DEBUG_RK_3_3
   rk_print_e (optimize, "rk_tb_3_3p", stderr);
@@ -144,14 +148,14 @@ rk_tb_3_3p (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_3_3tp (Optimize * optimize)       ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_3_3
   fprintf (stderr, "rk_tb_3_3tp: start\n");
 #endif
   if (!rk_tb_3_3t (optimize))
     return 0;
   tb = optimize->coefficient;
-  e31 (tb) = 0.5L / t1 (tb);
+  e31 (tb) = REAL (0.5) / t1 (tb);
   rk_e_3 (tb);
 #if DEBUG_RK_3_3
   rk_print_e (optimize, "rk_tb_3_3tp", stderr);
@@ -166,38 +170,38 @@ rk_tb_3_3tp (Optimize * optimize)       ///< Optimize struct.
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_3_3 (RK * rk)   ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_3_3
   fprintf (stderr, "rk_objective_tb_3_3: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b21 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b21 (tb) < REAL (0.))
     o += b21 (tb);
-  if (b30 (tb) < 0.L)
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b31 (tb) < 0.L)
+  if (b31 (tb) < REAL (0.))
     o += b31 (tb);
-  if (b32 (tb) < 0.L)
+  if (b32 (tb) < REAL (0.))
     o += b32 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L + fmaxl (1.L, fmaxl (t1 (tb), t2 (tb)));
+  o = REAL (30.) + fmaxr (REAL (1.), fmaxr (t1 (tb), t2 (tb)));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_3_3
-  fprintf (stderr, "rk_objective_tb_3_3: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_3_3: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_3_3: end\n");
 #endif
   return o;
@@ -209,41 +213,41 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_3_3t (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_3_3
   fprintf (stderr, "rk_objective_tb_3_3t: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b21 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b21 (tb) < REAL (0.))
     o += b21 (tb);
-  if (b30 (tb) < 0.L)
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b31 (tb) < 0.L)
+  if (b31 (tb) < REAL (0.))
     o += b31 (tb);
-  if (b32 (tb) < 0.L)
+  if (b32 (tb) < REAL (0.))
     o += b32 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L + fmaxl (1.L, fmaxl (t1 (tb), t2 (tb)));
+  o = REAL (30.) + fmaxr (REAL (1.), fmaxr (t1 (tb), t2 (tb)));
 #if DEBUG_RK_3_3
-  fprintf (stderr, "rk_objective_tb_3_3: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_3_3: optimal=" REAL_G "\n", real_g (o));
 #endif
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_3_3
-  fprintf (stderr, "rk_objective_tb_3_3t: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_3_3t: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_3_3t: end\n");
 #endif
   return o;
@@ -255,40 +259,40 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_3_3p (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_3_3
   fprintf (stderr, "rk_objective_tb_3_3p: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b21 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b21 (tb) < REAL (0.))
     o += b21 (tb);
-  if (b30 (tb) < 0.L)
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b31 (tb) < 0.L)
+  if (b31 (tb) < REAL (0.))
     o += b31 (tb);
-  if (b32 (tb) < 0.L)
+  if (b32 (tb) < REAL (0.))
     o += b32 (tb);
-  if (e30 (tb) < 0.L)
+  if (e30 (tb) < REAL (0.))
     o += e30 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L + fmaxl (1.L, fmaxl (t1 (tb), t2 (tb)));
+  o = REAL (30.) + fmaxr (REAL (1.), fmaxr (t1 (tb), t2 (tb)));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_3_3
-  fprintf (stderr, "rk_objective_tb_3_3p: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_3_3p: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_3_3p: end\n");
 #endif
   return o;
@@ -300,43 +304,43 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_3_3tp (RK * rk) ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_3_3
   fprintf (stderr, "rk_objective_tb_3_3tp: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b21 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b21 (tb) < REAL (0.))
     o += b21 (tb);
-  if (b30 (tb) < 0.L)
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b31 (tb) < 0.L)
+  if (b31 (tb) < REAL (0.))
     o += b31 (tb);
-  if (b32 (tb) < 0.L)
+  if (b32 (tb) < REAL (0.))
     o += b32 (tb);
-  if (e30 (tb) < 0.L)
+  if (e30 (tb) < REAL (0.))
     o += e30 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L + fmaxl (1.L, fmaxl (t1 (tb), t2 (tb)));
+  o = REAL (30.) + fmaxr (REAL (1.), fmaxr (t1 (tb), t2 (tb)));
 #if DEBUG_RK_3_3
-  fprintf (stderr, "rk_objective_tb_3_3p: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_3_3p: optimal=" REAL_G "\n", real_g (o));
 #endif
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_3_3
-  fprintf (stderr, "rk_objective_tb_3_3tp: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_3_3tp: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_3_3tp: end\n");
 #endif
   return o;
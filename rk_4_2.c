@@ -37,7 +37,6 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #include "config.h"
 #include "utils.h"
 #include "optimize.h"
@@ -53,13 +52,13 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 int
 rk_tb_4_2 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_4_2
   fprintf (stderr, "rk_tb_4_2: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t4 (tb) = 1.L;
+  t4 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
@@ -68,7 +67,7 @@ rk_tb_4_2 (Optimize * optimize) ///< Optimize struct.
   b32 (tb) = r[5];
   b41 (tb) = r[6];
   b42 (tb) = r[7];
-  b43 (tb) = (0.5L - b41 (tb) * t1 (tb) - b42 (tb) * t2 (tb)) / t3 (tb);
+  b43 (tb) = (REAL (0.5) - b41 (tb) * t1 (tb) - b42 (tb) * t2 (tb)) / t3 (tb);
   if (isnan (b43 (tb)))
     return 0;
   rk_b_4 (tb);
@@ -85,13 +84,13 @@ rk_tb_4_2 (Optimize * optimize) ///< Optimize struct.
 int
 rk_tb_4_2t (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_4_2
   fprintf (stderr, "rk_tb_4_2t: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t4 (tb) = 1.L;
+  t4 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
@@ -99,12 +98,12 @@ rk_tb_4_2t (Optimize * optimize)        ///< Optimize struct.
   b31 (tb) = r[4];
   b32 (tb) = r[5];
   b41 (tb) = r[6];
-  b42 (tb) = (1.L / 3.L - 0.5L * t3 (tb)
+  b42 (tb) = (REAL (1.) / REAL (3.) - REAL (0.5) * t3 (tb)
               - b41 (tb) * t1 (tb) * (t1 (tb) - t3 (tb)))
     / (t2 (tb) * (t2 (tb) - t3 (tb)));
   if (isnan (b42 (tb)))
     return 0;
-  b43 (tb) = (0.5L - b41 (tb) * t1 (tb) - b42 (tb) * t2 (tb)) / t3 (tb);
+  b43 (tb) = (REAL (0.5) - b41 (tb) * t1 (tb) - b42 (tb) * t2 (tb)) / t3 (tb);
   if (isnan (b43 (tb)))
     return 0;
   rk_b_4 (tb);
@@ -121,14 +120,14 @@ rk_tb_4_2t (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_4_2p (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_4_2
   fprintf (stderr, "rk_tb_4_2p: start\n");
 #endif
   if (!rk_tb_4_2 (optimize))
     return 0;
   tb = optimize->coefficient;
-  e41 (tb) = e42 (tb) = 0.L;
+  e41 (tb) = e42 (tb) = REAL (0.);
   rk_e_4 (tb);
 #if DEBUG_RK_4_2
   rk_print_e (optimize, "rk_tb_4_2p", stderr);
@@ -144,14 +143,14 @@ rk_tb_4_2p (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_4_2tp (Optimize * optimize)       ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_4_2
   fprintf (stderr, "rk_tb_4_2tp: start\n");
 #endif
   if (!rk_tb_4_2t (optimize))
     return 0;
   tb = optimize->coefficient;
-  e41 (tb) = e42 (tb) = 0.L;
+  e41 (tb) = e42 (tb) = REAL (0.);
   rk_e_4 (tb);
 #if DEBUG_RK_4_2
   rk_print_tb (optimize, "rk_tb_4_2tp", stderr);
@@ -166,36 +165,36 @@ rk_tb_4_2tp (Optimize * optimize)       ///< Optimize struct.
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_4_2 (RK * rk)   ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_4_2
   fprintf (stderr, "rk_objective_tb_4_2: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b43 (tb) < 0.L)
+  if (b43 (tb) < REAL (0.))
     o += b43 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L + fmaxl (1.L, fmaxl (t1 (tb), fmaxl (t2 (tb), t3 (tb))));
+  o = REAL (30.) + fmaxr (REAL (1.), fmaxr (t1 (tb), fmaxr (t2 (tb), t3 (tb))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_4_2
-  fprintf (stderr, "rk_objective_tb_4_2: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_4_2: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_4_2: end\n");
 #endif
   return o;
@@ -207,38 +206,38 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_4_2t (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_4_2
   fprintf (stderr, "rk_objective_tb_4_2t: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b42 (tb) < 0.L)
+  if (b42 (tb) < REAL (0.))
     o += b42 (tb);
-  if (b43 (tb) < 0.L)
+  if (b43 (tb) < REAL (0.))
     o += b43 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L + fmaxl (1.L, fmaxl (t1 (tb), fmaxl (t2 (tb), t3 (tb))));
+  o = REAL (30.) + fmaxr (REAL (1.), fmaxr (t1 (tb), fmaxr (t2 (tb), t3 (tb))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_4_2
-  fprintf (stderr, "rk_objective_tb_4_2t: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_4_2t: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_4_2t: end\n");
 #endif
   return o;
@@ -37,7 +37,6 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #include "config.h"
 #include "utils.h"
 #include "optimize.h"
@@ -53,28 +52,28 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 int
 rk_tb_4_3 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_4_3
   fprintf (stderr, "rk_tb_4_3: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t4 (tb) = 1.L;
+  t4 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
   t3 (tb) = r[3];
   b32 (tb) = r[4];
   b43 (tb) = r[5];
-  b42 (tb) = ((1.L / 3.L - b43 (tb) * sqr (t3 (tb)))
-              - t1 (tb) * (0.5L - b43 (tb) * t3 (tb)))
+  b42 (tb) = ((REAL (1.) / REAL (3.) - b43 (tb) * sqr (t3 (tb)))
+              - t1 (tb) * (REAL (0.5) - b43 (tb) * t3 (tb)))
     / (t2 (tb) * (t2 (tb) - t1 (tb)));
   if (isnan (b42 (tb)))
     return 0;
-  b41 (tb) = (0.5L - b42 (tb) * t2 (tb) - b43 (tb) * t3 (tb)) / t1 (tb);
+  b41 (tb) = (REAL (0.5) - b42 (tb) * t2 (tb) - b43 (tb) * t3 (tb)) / t1 (tb);
   if (isnan (b41 (tb)))
     return 0;
-  b31 (tb) = ((1.L / 6.L - b42 (tb) * b21 (tb) * t1 (tb)) / b43 (tb)
+  b31 (tb) = ((REAL (1.) / REAL (6.) - b42 (tb) * b21 (tb) * t1 (tb)) / b43 (tb)
               - b32 (tb) * t2 (tb)) / t1 (tb);
   if (isnan (b31 (tb)))
     return 0;
@@ -92,26 +91,26 @@ rk_tb_4_3 (Optimize * optimize) ///< Optimize struct.
 int
 rk_tb_4_3t (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_4_3
   fprintf (stderr, "rk_tb_4_3t: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t4 (tb) = 1.L;
+  t4 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
   t3 (tb) = r[3];
   b32 (tb) = r[4];
-  b43 (tb) = (0.25L - 1.L / 3.L * t1 (tb)
-              - (1.L / 3.L - 0.5L * t1 (tb)) * t2 (tb))
+  b43 (tb) = (REAL (0.25) - REAL (1.) / REAL (3.) * t1 (tb)
+              - (REAL (1.) / REAL (3.) - REAL (0.5) * t1 (tb)) * t2 (tb))
     / (t3 (tb) * (t3 (tb) - t2 (tb)) * (t3 (tb) - t1 (tb)));
-  b42 (tb) = ((1.L / 3.L - b43 (tb) * sqr (t3 (tb)))
-              - t1 (tb) * (0.5L - b43 (tb) * t3 (tb)))
+  b42 (tb) = ((REAL (1.) / REAL (3.) - b43 (tb) * sqr (t3 (tb)))
+              - t1 (tb) * (REAL (0.5) - b43 (tb) * t3 (tb)))
     / (t2 (tb) * (t2 (tb) - t1 (tb)));
-  b41 (tb) = (0.5L - b42 (tb) * t2 (tb) - b43 (tb) * t3 (tb)) / t1 (tb);
-  b31 (tb) = ((1.L / 6.L - b42 (tb) * b21 (tb) * t1 (tb)) / b43 (tb)
+  b41 (tb) = (REAL (0.5) - b42 (tb) * t2 (tb) - b43 (tb) * t3 (tb)) / t1 (tb);
+  b31 (tb) = ((REAL (1.) / REAL (6.) - b42 (tb) * b21 (tb) * t1 (tb)) / b43 (tb)
               - b32 (tb) * t2 (tb)) / t1 (tb);
   rk_b_4 (tb);
 #if DEBUG_RK_4_3
@@ -130,15 +129,15 @@ rk_tb_4_3t (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_4_3p (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_4_3
   fprintf (stderr, "rk_tb_4_3p: start\n");
 #endif
   if (!rk_tb_4_3 (optimize))
     return 0;
   tb = optimize->coefficient;
-  e41 (tb) = 0.5L / t1 (tb);
-  e42 (tb) = 0.L;
+  e41 (tb) = REAL (0.5) / t1 (tb);
+  e42 (tb) = REAL (0.);
   rk_e_4 (tb);
 #if DEBUG_RK_4_3
   rk_print_e (optimize, "rk_tb_4_3p", stderr);
@@ -154,15 +153,16 @@ rk_tb_4_3p (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_4_3tp (Optimize * optimize)       ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_4_3
   fprintf (stderr, "rk_tb_4_3tp: start\n");
 #endif
   if (!rk_tb_4_3t (optimize))
     return 0;
   tb = optimize->coefficient;
-  e42 (tb) = (1.L / 3.L - 0.5L * t1 (tb)) / (t2 (tb) * (t2 (tb) - t1 (tb)));
-  e41 (tb) = (0.5L - e42 (tb) * t2 (tb)) / t1 (tb);
+  e42 (tb) = (REAL (1.) / REAL (3.) - REAL (0.5) * t1 (tb))
+    / (t2 (tb) * (t2 (tb) - t1 (tb)));
+  e41 (tb) = (REAL (0.5) - e42 (tb) * t2 (tb)) / t1 (tb);
   rk_e_4 (tb);
 #if DEBUG_RK_4_3
   rk_print_e (optimize, "rk_tb_4_3tp", stderr);
@@ -179,40 +179,40 @@ rk_tb_4_3tp (Optimize * optimize)       ///< Optimize struct.
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_4_3 (RK * rk)   ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_4_3
   fprintf (stderr, "rk_objective_tb_4_3: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b31 (tb) < 0.L)
+  if (b31 (tb) < REAL (0.))
     o += b31 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b41 (tb) < 0.L)
+  if (b41 (tb) < REAL (0.))
     o += b41 (tb);
-  if (b42 (tb) < 0.L)
+  if (b42 (tb) < REAL (0.))
     o += b42 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L + fmaxl (1.L, fmaxl (t1 (tb), fmaxl (t2 (tb), t3 (tb))));
+  o = REAL (30.) + fmaxr (REAL (1.), fmaxr (t1 (tb), fmaxr (t2 (tb), t3 (tb))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_4_3
-  fprintf (stderr, "rk_objective_tb_4_3: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_4_3: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_4_3: end\n");
 #endif
   return o;
@@ -224,42 +224,42 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_4_3t (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_4_3
   fprintf (stderr, "rk_objective_tb_4_3t: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b31 (tb) < 0.L)
+  if (b31 (tb) < REAL (0.))
     o += b31 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b41 (tb) < 0.L)
+  if (b41 (tb) < REAL (0.))
     o += b41 (tb);
-  if (b42 (tb) < 0.L)
+  if (b42 (tb) < REAL (0.))
     o += b42 (tb);
-  if (b43 (tb) < 0.L)
+  if (b43 (tb) < REAL (0.))
     o += b43 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L + fmaxl (1.L, fmaxl (t1 (tb), fmaxl (t2 (tb), t3 (tb))));
+  o = REAL (30.) + fmaxr (REAL (1.), fmaxr (t1 (tb), fmaxr (t2 (tb), t3 (tb))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_4_3
-  fprintf (stderr, "rk_objective_tb_4_3t: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_4_3t: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_4_3t: end\n");
 #endif
   return o;
@@ -271,42 +271,42 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_4_3p (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_4_3
   fprintf (stderr, "rk_objective_tb_4_3p: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b31 (tb) < 0.L)
+  if (b31 (tb) < REAL (0.))
     o += b31 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b41 (tb) < 0.L)
+  if (b41 (tb) < REAL (0.))
     o += b41 (tb);
-  if (b42 (tb) < 0.L)
+  if (b42 (tb) < REAL (0.))
     o += b42 (tb);
-  if (e40 (tb) < 0.L)
+  if (e40 (tb) < REAL (0.))
     o += e40 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L + fmaxl (1.L, fmaxl (t1 (tb), fmaxl (t2 (tb), t3 (tb))));
+  o = REAL (30.) + fmaxr (REAL (1.), fmaxr (t1 (tb), fmaxr (t2 (tb), t3 (tb))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_4_3
-  fprintf (stderr, "rk_objective_tb_4_3p: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_4_3p: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_4_3p: end\n");
 #endif
   return o;
@@ -318,48 +318,48 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_4_3tp (RK * rk) ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_4_3
   fprintf (stderr, "rk_objective_tb_4_3tp: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b31 (tb) < 0.L)
+  if (b31 (tb) < REAL (0.))
     o += b31 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b41 (tb) < 0.L)
+  if (b41 (tb) < REAL (0.))
     o += b41 (tb);
-  if (b42 (tb) < 0.L)
+  if (b42 (tb) < REAL (0.))
     o += b42 (tb);
-  if (b43 (tb) < 0.L)
+  if (b43 (tb) < REAL (0.))
     o += b43 (tb);
-  if (e40 (tb) < 0.L)
+  if (e40 (tb) < REAL (0.))
     o += e40 (tb);
-  if (e41 (tb) < 0.L)
+  if (e41 (tb) < REAL (0.))
     o += e41 (tb);
-  if (e42 (tb) < 0.L)
+  if (e42 (tb) < REAL (0.))
     o += e42 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L + fmaxl (1.L, fmaxl (t1 (tb), fmaxl (t2 (tb), t3 (tb))));
+  o = REAL (30.) + fmaxr (REAL (1.), fmaxr (t1 (tb), fmaxr (t2 (tb), t3 (tb))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_4_3
-  fprintf (stderr, "rk_objective_tb_4_3tp: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_4_3tp: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_4_3tp: end\n");
 #endif
   return o;
@@ -37,7 +37,6 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #include "config.h"
 #include "utils.h"
 #include "optimize.h"
@@ -53,38 +52,39 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 int
 rk_tb_4_4 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_4_4
   fprintf (stderr, "rk_tb_4_4: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t4 (tb) = 1.L;
+  t4 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
-  t3 (tb) = 1.L;
-  b43 (tb) = (0.25L - 1.L / 3.L * t1 (tb)
-              - (1.L / 3.L - 0.5L * t1 (tb)) * t2 (tb))
+  t3 (tb) = REAL (1.);
+  b43 (tb) = (REAL (0.25) - REAL (1.) / REAL (3.) * t1 (tb)
+              - (REAL (1.) / REAL (3.) - REAL (0.5) * t1 (tb)) * t2 (tb))
     / (t3 (tb) * (t3 (tb) - t2 (tb)) * (t3 (tb) - t1 (tb)));
   if (isnan (b43 (tb)))
     return 0;
-  b42 (tb) = (1.L / 3.L - 0.5L * t1 (tb)
+  b42 (tb) = (REAL (1.) / REAL (3.) - REAL (0.5) * t1 (tb)
               - b43 (tb) * t3 (tb) * (t3 (tb) - t1 (tb)))
     / (t2 (tb) * (t2 (tb) - t1 (tb)));
   if (isnan (b42 (tb)))
     return 0;
-  b41 (tb) = (0.5L - b42 (tb) * t2 (tb) - b43 (tb) * t3 (tb)) / t1 (tb);
+  b41 (tb) = (REAL (0.5) - b42 (tb) * t2 (tb) - b43 (tb) * t3 (tb)) / t1 (tb);
   if (isnan (b41 (tb)))
     return 0;
-  b32 (tb) = (1.L / 12.L - 1.L / 6.L * t1 (tb))
+  b32 (tb) = (REAL (1.) / REAL (12.) - REAL (1.) / REAL (6.) * t1 (tb))
     / (b43 (tb) * t2 (tb) * (t2 (tb) - t1 (tb)));
   if (isnan (b32 (tb)))
     return 0;
-  b31 (tb) = ((0.125L - 1.L / 6.L * t2 (tb)) / (b43 (tb) * (t3 (tb) - t2 (tb)))
-              - b32 (tb) * t2 (tb)) / t1 (tb);
+  b31 (tb) = ((REAL (0.125) - REAL (1.) / REAL (6.) * t2 (tb))
+              / (b43 (tb) * (t3 (tb) - t2 (tb))) - b32 (tb) * t2 (tb))
+    / t1 (tb);
   if (isnan (b31 (tb)))
     return 0;
-  b21 (tb) = 1.L / 24.L / (t1 (tb) * b43 (tb) * b32 (tb));
+  b21 (tb) = REAL (1.) / REAL (24.) / (t1 (tb) * b43 (tb) * b32 (tb));
   if (isnan (b21 (tb)))
     return 0;
   rk_b_4 (tb);
@@ -101,38 +101,39 @@ rk_tb_4_4 (Optimize * optimize) ///< Optimize struct.
 int
 rk_tb_4_4t (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_4_4
   fprintf (stderr, "rk_tb_4_4t: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t4 (tb) = 1.L;
+  t4 (tb) = REAL (1.);
   t1 (tb) = r[0];
-  t2 (tb) = 0.5L * (t1 (tb) - 0.6L) / (t1 (tb) - 0.5L);
-  t3 (tb) = 1.L;
-  b43 (tb) = (0.25L - 1.L / 3.L * t1 (tb)
-              - (1.L / 3.L - 0.5L * t1 (tb)) * t2 (tb))
+  t2 (tb) = REAL (0.5) * (t1 (tb) - REAL (0.6)) / (t1 (tb) - REAL (0.5));
+  t3 (tb) = REAL (1.);
+  b43 (tb) = (REAL (0.25) - REAL (1.) / REAL (3.) * t1 (tb)
+              - (REAL (1.) / REAL (3.) - REAL (0.5) * t1 (tb)) * t2 (tb))
     / (t3 (tb) * (t3 (tb) - t2 (tb)) * (t3 (tb) - t1 (tb)));
   if (isnan (b43 (tb)))
     return 0;
-  b42 (tb) = (1.L / 3.L - 0.5L * t1 (tb)
+  b42 (tb) = (REAL (1.) / REAL (3.) - REAL (0.5) * t1 (tb)
               - b43 (tb) * t3 (tb) * (t3 (tb) - t1 (tb)))
     / (t2 (tb) * (t2 (tb) - t1 (tb)));
   if (isnan (b42 (tb)))
     return 0;
-  b41 (tb) = (0.5L - b42 (tb) * t2 (tb) - b43 (tb) * t3 (tb)) / t1 (tb);
+  b41 (tb) = (REAL (0.5) - b42 (tb) * t2 (tb) - b43 (tb) * t3 (tb)) / t1 (tb);
   if (isnan (b41 (tb)))
     return 0;
-  b32 (tb) = (1.L / 12.L - 1.L / 6.L * t1 (tb))
+  b32 (tb) = (REAL (1.) / REAL (12.) - REAL (1.) / REAL (6.) * t1 (tb))
     / (b43 (tb) * t2 (tb) * (t2 (tb) - t1 (tb)));
   if (isnan (b32 (tb)))
     return 0;
-  b31 (tb) = ((0.125L - 1.L / 6.L * t2 (tb)) / (b43 (tb) * (t3 (tb) - t2 (tb)))
-              - b32 (tb) * t2 (tb)) / t1 (tb);
+  b31 (tb) = ((REAL (0.125) - REAL (1.) / REAL (6.) * t2 (tb))
+              / (b43 (tb) * (t3 (tb) - t2 (tb))) - b32 (tb) * t2 (tb))
+    / t1 (tb);
   if (isnan (b31 (tb)))
     return 0;
-  b21 (tb) = 1.L / 24.L / (t1 (tb) * b43 (tb) * b32 (tb));
+  b21 (tb) = REAL (1.) / REAL (24.) / (t1 (tb) * b43 (tb) * b32 (tb));
   if (isnan (b21 (tb)))
     return 0;
   rk_b_4 (tb);
@@ -148,46 +149,46 @@ rk_tb_4_4t (Optimize * optimize)        ///< Optimize struct.
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_4_4 (RK * rk)   ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_4_4
   fprintf (stderr, "rk_objective_tb_4_4: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b21 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b21 (tb) < REAL (0.))
     o += b21 (tb);
-  if (b30 (tb) < 0.L)
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b31 (tb) < 0.L)
+  if (b31 (tb) < REAL (0.))
     o += b31 (tb);
-  if (b32 (tb) < 0.L)
+  if (b32 (tb) < REAL (0.))
     o += b32 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b41 (tb) < 0.L)
+  if (b41 (tb) < REAL (0.))
     o += b41 (tb);
-  if (b42 (tb) < 0.L)
+  if (b42 (tb) < REAL (0.))
     o += b42 (tb);
-  if (b43 (tb) < 0.L)
+  if (b43 (tb) < REAL (0.))
     o += b43 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L + fmaxl (1.L, fmaxl (t1 (tb), fmaxl (t2 (tb), t3 (tb))));
+  o = REAL (30.) + fmaxr (REAL (1.), fmaxr (t1 (tb), fmaxr (t2 (tb), t3 (tb))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_4_4
-  fprintf (stderr, "rk_objective_tb_4_4: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_4_4: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_4_4: end\n");
 #endif
   return o;
@@ -199,46 +200,46 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_4_4t (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_4_4
   fprintf (stderr, "rk_objective_tb_4_4: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b21 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b21 (tb) < REAL (0.))
     o += b21 (tb);
-  if (b30 (tb) < 0.L)
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b31 (tb) < 0.L)
+  if (b31 (tb) < REAL (0.))
     o += b31 (tb);
-  if (b32 (tb) < 0.L)
+  if (b32 (tb) < REAL (0.))
     o += b32 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b41 (tb) < 0.L)
+  if (b41 (tb) < REAL (0.))
     o += b41 (tb);
-  if (b42 (tb) < 0.L)
+  if (b42 (tb) < REAL (0.))
     o += b42 (tb);
-  if (b43 (tb) < 0.L)
+  if (b43 (tb) < REAL (0.))
     o += b43 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L + fmaxl (1.L, fmaxl (t1 (tb), fmaxl (t2 (tb), t3 (tb))));
+  o = REAL (30.) + fmaxr (REAL (1.), fmaxr (t1 (tb), fmaxr (t2 (tb), t3 (tb))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_4_4
-  fprintf (stderr, "rk_objective_tb_4_4: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_4_4: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_4_4: end\n");
 #endif
   return o;
@@ -36,7 +36,7 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 int rk_tb_4_4 (Optimize * optimize);
 int rk_tb_4_4t (Optimize * optimize);
-long double rk_objective_tb_4_4 (RK * rk);
-long double rk_objective_tb_4_4t (RK * rk);
+Real rk_objective_tb_4_4 (RK * rk);
+Real rk_objective_tb_4_4t (RK * rk);
 
 #endif
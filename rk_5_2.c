@@ -37,7 +37,6 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #include "config.h"
 #include "utils.h"
 #include "optimize.h"
@@ -53,13 +52,13 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 int
 rk_tb_5_2 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_5_2
   fprintf (stderr, "rk_tb_5_2: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t5 (tb) = 1.L;
+  t5 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
@@ -73,7 +72,7 @@ rk_tb_5_2 (Optimize * optimize) ///< Optimize struct.
   b51 (tb) = r[10];
   b52 (tb) = r[11];
   b53 (tb) = r[12];
-  b54 (tb) = (0.5L - b51 (tb) * t1 (tb) - b52 (tb) * t2 (tb)
+  b54 (tb) = (REAL (0.5) - b51 (tb) * t1 (tb) - b52 (tb) * t2 (tb)
               - b53 (tb) * t3 (tb)) / t4 (tb);
   if (isnan (b54 (tb)))
     return 0;
@@ -91,13 +90,13 @@ rk_tb_5_2 (Optimize * optimize) ///< Optimize struct.
 int
 rk_tb_5_2t (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_5_2
   fprintf (stderr, "rk_tb_5_2t: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t5 (tb) = 1.L;
+  t5 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
@@ -110,13 +109,13 @@ rk_tb_5_2t (Optimize * optimize)        ///< Optimize struct.
   b43 (tb) = r[9];
   b51 (tb) = r[10];
   b52 (tb) = r[11];
-  b53 (tb) = (1.L / 3.L - 0.5L * t4 (tb)
+  b53 (tb) = (REAL (1.) / REAL (3.) - REAL (0.5) * t4 (tb)
               - b51 (tb) * t1 (tb) * (t1 (tb) - t4 (tb))
               - b52 (tb) * t2 (tb) * (t2 (tb) - t4 (tb)))
     / (t3 (tb) * (t3 (tb) - t4 (tb)));
   if (isnan (b53 (tb)))
     return 0;
-  b54 (tb) = (0.5L - b51 (tb) * t1 (tb) - b52 (tb) * t2 (tb)
+  b54 (tb) = (REAL (0.5) - b51 (tb) * t1 (tb) - b52 (tb) * t2 (tb)
               - b53 (tb) * t3 (tb)) / t4 (tb);
   if (isnan (b54 (tb)))
     return 0;
@@ -134,14 +133,14 @@ rk_tb_5_2t (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_5_2p (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_5_2
   fprintf (stderr, "rk_tb_5_2p: start\n");
 #endif
   if (!rk_tb_5_2 (optimize))
     return 0;
   tb = optimize->coefficient;
-  e51 (tb) = e52 (tb) = e53 (tb) = 0.L;
+  e51 (tb) = e52 (tb) = e53 (tb) = REAL (0.);
   rk_e_5 (tb);
 #if DEBUG_RK_5_2
   fprintf (stderr, "rk_tb_5_2p: end\n");
@@ -156,14 +155,14 @@ rk_tb_5_2p (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_5_2tp (Optimize * optimize)       ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_5_2
   fprintf (stderr, "rk_tb_5_2tp: start\n");
 #endif
   if (!rk_tb_5_2t (optimize))
     return 0;
   tb = optimize->coefficient;
-  e51 (tb) = e52 (tb) = e53 (tb) = 0.L;
+  e51 (tb) = e52 (tb) = e53 (tb) = REAL (0.);
   rk_e_5 (tb);
 #if DEBUG_RK_5_2
   fprintf (stderr, "rk_tb_5_2tp: end\n");
@@ -177,39 +176,40 @@ rk_tb_5_2tp (Optimize * optimize)       ///< Optimize struct.
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_5_2 (RK * rk)   ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_5_2
   fprintf (stderr, "rk_objective_tb_5_2: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b54 (tb) < 0.L)
+  if (b54 (tb) < REAL (0.))
     o += b54 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L, fmaxl (t1 (tb), fmaxl (t2 (tb), fmaxl (t3 (tb), t4 (tb)))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb), fmaxr (t2 (tb), fmaxr (t3 (tb), t4 (tb)))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_5_2
-  fprintf (stderr, "rk_objective_tb_5_2: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_5_2: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_5_2: end\n");
 #endif
   return o;
@@ -221,41 +221,42 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_5_2t (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_5_2
   fprintf (stderr, "rk_objective_tb_5_2t: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b53 (tb) < 0.L)
+  if (b53 (tb) < REAL (0.))
     o += b53 (tb);
-  if (b54 (tb) < 0.L)
+  if (b54 (tb) < REAL (0.))
     o += b54 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L, fmaxl (t1 (tb), fmaxl (t2 (tb), fmaxl (t3 (tb), t4 (tb)))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb), fmaxr (t2 (tb), fmaxr (t3 (tb), t4 (tb)))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_5_2
-  fprintf (stderr, "rk_objective_tb_5_2t: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_5_2t: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_5_2t: end\n");
 #endif
   return o;
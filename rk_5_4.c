@@ -37,7 +37,6 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #include "config.h"
 #include "utils.h"
 #include "optimize.h"
@@ -53,14 +52,14 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 int
 rk_tb_5_4 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4];
-  long double *tb, *r;
+  Real A[4], B[4], C[4], D[4], E[4];
+  Real *tb, *r;
 #if DEBUG_RK_5_4
   fprintf (stderr, "rk_tb_5_4: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t5 (tb) = 1.L;
+  t5 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
@@ -72,21 +71,21 @@ rk_tb_5_4 (Optimize * optimize) ///< Optimize struct.
   B[0] = t2 (tb);
   C[0] = t3 (tb);
   D[0] = t4 (tb);
-  E[0] = 0.5L;
+  E[0] = REAL (0.5);
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
   D[1] = D[0] * t4 (tb);
-  E[1] = 1.L / 3.L;
+  E[1] = REAL (1.) / REAL (3.);
   A[2] = A[1] * t1 (tb);
   B[2] = B[1] * t2 (tb);
   C[2] = C[1] * t3 (tb);
   D[2] = D[1] * t4 (tb);
-  E[2] = 0.25L;
-  A[3] = D[3] = 0.L;
+  E[2] = REAL (0.25);
+  A[3] = D[3] = REAL (0.);
   B[3] = b21 (tb) * t1 (tb) * (t2 (tb) - t4 (tb));
   C[3] = (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb)) * (t3 (tb) - t4 (tb));
-  E[3] = 0.125L - 1.L / 6.L * t4 (tb);
+  E[3] = REAL (0.125) - REAL (1.) / REAL (6.) * t4 (tb);
   solve_4 (A, B, C, D, E);
   if (isnan (E[0]) || isnan (E[1]) || isnan (E[2]) || isnan (E[3]))
     return 0;
@@ -97,17 +96,17 @@ rk_tb_5_4 (Optimize * optimize) ///< Optimize struct.
   A[0] = t1 (tb);
   B[0] = t2 (tb);
   C[0] = t3 (tb);
-  D[0] = 1.L / 6.L - b52 (tb) * b21 (tb) * t1 (tb)
+  D[0] = REAL (1.) / REAL (6.) - b52 (tb) * b21 (tb) * t1 (tb)
     - b53 (tb) * (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb));
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
-  D[1] = 1.L / 12.L - b52 (tb) * b21 (tb) * sqr (t1 (tb))
+  D[1] = REAL (1.) / REAL (12.) - b52 (tb) * b21 (tb) * sqr (t1 (tb))
     - b53 (tb) * (b31 (tb) * sqr (t1 (tb)) + b32 (tb) * sqr (t2 (tb)));
-  A[2] = 0.L;
+  A[2] = REAL (0.);
   B[2] = b21 (tb) * t1 (tb);
   C[2] = b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb);
-  D[2] = 1.L / 24.L - b53 (tb) * b32 (tb) * b21 (tb) * t1 (tb);
+  D[2] = REAL (1.) / REAL (24.) - b53 (tb) * b32 (tb) * b21 (tb) * t1 (tb);
   solve_3 (A, B, C, D);
   b43 (tb) = D[2] / b54 (tb);
   if (isnan (b43 (tb)))
@@ -132,14 +131,14 @@ rk_tb_5_4 (Optimize * optimize) ///< Optimize struct.
 int
 rk_tb_5_4t (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4];
-  long double *tb, *r;
+  Real A[4], B[4], C[4], D[4], E[4];
+  Real *tb, *r;
 #if DEBUG_RK_5_4
   fprintf (stderr, "rk_tb_5_4t: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t5 (tb) = 1.L;
+  t5 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   t3 (tb) = r[2];
@@ -150,22 +149,22 @@ rk_tb_5_4t (Optimize * optimize)        ///< Optimize struct.
   B[0] = t2 (tb);
   C[0] = t3 (tb);
   D[0] = t4 (tb);
-  E[0] = 0.5L;
+  E[0] = REAL (0.5);
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
   D[1] = D[0] * t4 (tb);
-  E[1] = 1.L / 3.L;
+  E[1] = REAL (1.) / REAL (3.);
   A[2] = A[1] * t1 (tb);
   B[2] = B[1] * t2 (tb);
   C[2] = C[1] * t3 (tb);
   D[2] = D[1] * t4 (tb);
-  E[2] = 0.25L;
+  E[2] = REAL (0.25);
   A[3] = A[2] * t1 (tb);
   B[3] = B[2] * t2 (tb);
   C[3] = C[2] * t3 (tb);
   D[3] = D[2] * t4 (tb);
-  E[3] = 0.2L;
+  E[3] = REAL (0.2);
   solve_4 (A, B, C, D, E);
   if (isnan (E[0]) || isnan (E[1]) || isnan (E[2]) || isnan (E[3]))
     return 0;
@@ -173,24 +172,24 @@ rk_tb_5_4t (Optimize * optimize)        ///< Optimize struct.
   b53 (tb) = E[2];
   b52 (tb) = E[1];
   b51 (tb) = E[0];
-  b32 (tb) = (1.L / 6.L * t4 (tb) - 0.125L
+  b32 (tb) = (REAL (1.) / REAL (6.) * t4 (tb) - REAL (0.125)
               - t1 (tb) * (b52 (tb) * b21 (tb) * (t4 (tb) - t2 (tb))
                            + b53 (tb) * b31 (tb) * (t4 (tb) - t3 (tb))))
     / (b53 (tb) * t2 (tb) * (t4 (tb) - t3 (tb)));
   A[0] = t1 (tb);
   B[0] = t2 (tb);
   C[0] = t3 (tb);
-  D[0] = 1.L / 6.L - b52 (tb) * b21 (tb) * t1 (tb)
+  D[0] = REAL (1.) / REAL (6.) - b52 (tb) * b21 (tb) * t1 (tb)
     - b53 (tb) * (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb));
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
-  D[1] = 1.L / 12.L - b52 (tb) * b21 (tb) * sqr (t1 (tb))
+  D[1] = REAL (1.) / REAL (12.) - b52 (tb) * b21 (tb) * sqr (t1 (tb))
     - b53 (tb) * (b31 (tb) * sqr (t1 (tb)) + b32 (tb) * sqr (t2 (tb)));
-  A[2] = 0.L;
+  A[2] = REAL (0.);
   B[2] = b21 (tb) * t1 (tb);
   C[2] = b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb);
-  D[2] = 1.L / 24.L - b53 (tb) * b32 (tb) * b21 (tb) * t1 (tb);
+  D[2] = REAL (1.) / REAL (24.) - b53 (tb) * b32 (tb) * b21 (tb) * t1 (tb);
   solve_3 (A, B, C, D);
   b43 (tb) = D[2] / b54 (tb);
   if (isnan (b43 (tb)))
@@ -216,8 +215,8 @@ rk_tb_5_4t (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_5_4p (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[3], B[3], C[3], D[3];
-  long double *tb;
+  Real A[3], B[3], C[3], D[3];
+  Real *tb;
 #if DEBUG_RK_5_4
   fprintf (stderr, "rk_tb_5_4p: start\n");
 #endif
@@ -227,15 +226,15 @@ rk_tb_5_4p (Optimize * optimize)        ///< Optimize struct.
   A[0] = t1 (tb);
   B[0] = t2 (tb);
   C[0] = t3 (tb);
-  D[0] = 0.5L;
+  D[0] = REAL (0.5);
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
-  D[1] = 1.L / 3.L;
-  A[2] = 0.L;
+  D[1] = REAL (1.) / REAL (3.);
+  A[2] = REAL (0.);
   B[2] = b21 (tb) * t1 (tb);
   C[2] = b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb);
-  D[2] = 1.L / 6.L;
+  D[2] = REAL (1.) / REAL (6.);
   solve_3 (A, B, C, D);
   if (isnan (D[0]) || isnan (D[1]) || isnan (D[2]))
     return 0;
@@ -256,14 +255,14 @@ rk_tb_5_4p (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_5_4tp (Optimize * optimize)       ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4];
-  long double *tb, *r;
+  Real A[4], B[4], C[4], D[4], E[4];
+  Real *tb, *r;
 #if DEBUG_RK_5_4
   fprintf (stderr, "rk_tb_5_4tp: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t5 (tb) = 1.L;
+  t5 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   t3 (tb) = r[2];
@@ -273,22 +272,22 @@ rk_tb_5_4tp (Optimize * optimize)       ///< Optimize struct.
   B[0] = t2 (tb);
   C[0] = t3 (tb);
   D[0] = t4 (tb);
-  E[0] = 0.5L;
+  E[0] = REAL (0.5);
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
   D[1] = D[0] * t4 (tb);
-  E[1] = 1.L / 3.L;
+  E[1] = REAL (1.) / REAL (3.);
   A[2] = A[1] * t1 (tb);
   B[2] = B[1] * t2 (tb);
   C[2] = C[1] * t3 (tb);
   D[2] = D[1] * t4 (tb);
-  E[2] = 0.25L;
+  E[2] = REAL (0.25);
   A[3] = A[2] * t1 (tb);
   B[3] = B[2] * t2 (tb);
   C[3] = C[2] * t3 (tb);
   D[3] = D[2] * t4 (tb);
-  E[3] = 0.2L;
+  E[3] = REAL (0.2);
   solve_4 (A, B, C, D, E);
   if (isnan (E[0]) || isnan (E[1]) || isnan (E[2]) || isnan (E[3]))
     return 0;
@@ -296,26 +295,26 @@ rk_tb_5_4tp (Optimize * optimize)       ///< Optimize struct.
   b53 (tb) = E[2];
   b52 (tb) = E[1];
   b51 (tb) = E[0];
-  e53 (tb) = (0.25L - 1.L / 3.L * t1 (tb)
-              - (1.L / 3.L - 0.5L * t1 (tb)) * t2 (tb))
+  e53 (tb) = (REAL (0.25) - REAL (1.) / REAL (3.) * t1 (tb)
+              - (REAL (1.) / REAL (3.) - REAL (0.5) * t1 (tb)) * t2 (tb))
     / (t3 (tb) * (t3 (tb) - t2 (tb)) * (t3 (tb) - t1 (tb)));
   if (isnan (e53 (tb)))
     return 0;
-  e52 (tb) = (1.L / 3.L - 0.5L * t1 (tb)
+  e52 (tb) = (REAL (1.) / REAL (3.) - REAL (0.5) * t1 (tb)
               - t3 (tb) * (t3 (tb) - t1 (tb)) * e53 (tb))
     / (t2 (tb) * (t2 (tb) - t1 (tb)));
   if (isnan (e52 (tb)))
     return 0;
-  e51 (tb) = (0.5L - t2 (tb) * e52 (tb) - t3 (tb) * e53 (tb)) / t1 (tb);
+  e51 (tb) = (REAL (0.5) - t2 (tb) * e52 (tb) - t3 (tb) * e53 (tb)) / t1 (tb);
   if (isnan (e51 (tb)))
     return 0;
-  b21 (tb) = (1.L / 6.L * b53 (tb) * (t4 (tb) - t3 (tb))
-              + e53 (tb) * (0.125L - 1.L / 6.L * t4 (tb)))
+  b21 (tb) = (REAL (1.) / REAL (6.) * b53 (tb) * (t4 (tb) - t3 (tb))
+              + e53 (tb) * (REAL (0.125) - REAL (1.) / REAL (6.) * t4 (tb)))
     / (t1 (tb) * (e52 (tb) * b53 (tb) * (t4 (tb) - t3 (tb))
                   - e53 (tb) * b52 (tb) * (t4 (tb) - t2 (tb))));
   if (isnan (b21 (tb)))
     return 0;
-  b32 (tb) = (1.L / 6.L * t4 (tb) - 0.125L
+  b32 (tb) = (REAL (1.) / REAL (6.) * t4 (tb) - REAL (0.125)
               - t1 (tb) * (b52 (tb) * b21 (tb) * (t4 (tb) - t2 (tb))
                            + b53 (tb) * b31 (tb) * (t4 (tb) - t3 (tb))))
     / (b53 (tb) * t2 (tb) * (t4 (tb) - t3 (tb)));
@@ -324,17 +323,17 @@ rk_tb_5_4tp (Optimize * optimize)       ///< Optimize struct.
   A[0] = t1 (tb);
   B[0] = t2 (tb);
   C[0] = t3 (tb);
-  D[0] = 1.L / 6.L - b52 (tb) * b21 (tb) * t1 (tb)
+  D[0] = REAL (1.) / REAL (6.) - b52 (tb) * b21 (tb) * t1 (tb)
     - b53 (tb) * (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb));
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
-  D[1] = 1.L / 12.L - b52 (tb) * b21 (tb) * sqr (t1 (tb))
+  D[1] = REAL (1.) / REAL (12.) - b52 (tb) * b21 (tb) * sqr (t1 (tb))
     - b53 (tb) * (b31 (tb) * sqr (t1 (tb)) + b32 (tb) * sqr (t2 (tb)));
-  A[2] = 0.L;
+  A[2] = REAL (0.);
   B[2] = b21 (tb) * t1 (tb);
   C[2] = b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb);
-  D[2] = 1.L / 24.L - b53 (tb) * b32 (tb) * b21 (tb) * t1 (tb);
+  D[2] = REAL (1.) / REAL (24.) - b53 (tb) * b32 (tb) * b21 (tb) * t1 (tb);
   solve_3 (A, B, C, D);
   b43 (tb) = D[2] / b54 (tb);
   if (isnan (b43 (tb)))
@@ -360,51 +359,52 @@ rk_tb_5_4tp (Optimize * optimize)       ///< Optimize struct.
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_5_4 (RK * rk)   ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_5_4
   fprintf (stderr, "rk_objective_tb_5_4: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b41 (tb) < 0.L)
+  if (b41 (tb) < REAL (0.))
     o += b41 (tb);
-  if (b42 (tb) < 0.L)
+  if (b42 (tb) < REAL (0.))
     o += b42 (tb);
-  if (b43 (tb) < 0.L)
+  if (b43 (tb) < REAL (0.))
     o += b43 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b51 (tb) < 0.L)
+  if (b51 (tb) < REAL (0.))
     o += b51 (tb);
-  if (b52 (tb) < 0.L)
+  if (b52 (tb) < REAL (0.))
     o += b52 (tb);
-  if (b53 (tb) < 0.L)
+  if (b53 (tb) < REAL (0.))
     o += b53 (tb);
-  if (b54 (tb) < 0.L)
+  if (b54 (tb) < REAL (0.))
     o += b54 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L, fmaxl (t1 (tb), fmaxl (t2 (tb), fmaxl (t3 (tb), t4 (tb)))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb), fmaxr (t2 (tb), fmaxr (t3 (tb), t4 (tb)))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_5_4
-  fprintf (stderr, "rk_objective_tb_5_4: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_5_4: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_5_4: end\n");
 #endif
   return o;
@@ -416,11 +416,11 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_5_4t (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_5_4
   fprintf (stderr, "rk_objective_tb_5_4t: start\n");
 #endif
@@ -428,46 +428,47 @@ rk_objective_tb_5_4t (RK * rk)  ///< RK struct.
 #if DEBUG_RK_5_4
   rk_print_tb (optimize, "rk_objective_tb_5_4t", stderr);
 #endif
-  o = fminl (0.L, b20 (tb));
-  if (b21 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b21 (tb) < REAL (0.))
     o += b21 (tb);
-  if (b30 (tb) < 0.L)
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b32 (tb) < 0.L)
+  if (b32 (tb) < REAL (0.))
     o += b32 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b41 (tb) < 0.L)
+  if (b41 (tb) < REAL (0.))
     o += b41 (tb);
-  if (b42 (tb) < 0.L)
+  if (b42 (tb) < REAL (0.))
     o += b42 (tb);
-  if (b43 (tb) < 0.L)
+  if (b43 (tb) < REAL (0.))
     o += b43 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b51 (tb) < 0.L)
+  if (b51 (tb) < REAL (0.))
     o += b51 (tb);
-  if (b52 (tb) < 0.L)
+  if (b52 (tb) < REAL (0.))
     o += b52 (tb);
-  if (b53 (tb) < 0.L)
+  if (b53 (tb) < REAL (0.))
     o += b53 (tb);
-  if (b54 (tb) < 0.L)
+  if (b54 (tb) < REAL (0.))
     o += b54 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L, fmaxl (t1 (tb), fmaxl (t2 (tb), fmaxl (t3 (tb), t4 (tb)))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb), fmaxr (t2 (tb), fmaxr (t3 (tb), t4 (tb)))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_5_4
-  fprintf (stderr, "rk_objective_tb_5_4t: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_5_4t: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_5_4t: end\n");
 #endif
   return o;
@@ -479,59 +480,60 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_5_4p (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_5_4
   fprintf (stderr, "rk_objective_tb_5_4p: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b41 (tb) < 0.L)
+  if (b41 (tb) < REAL (0.))
     o += b41 (tb);
-  if (b42 (tb) < 0.L)
+  if (b42 (tb) < REAL (0.))
     o += b42 (tb);
-  if (b43 (tb) < 0.L)
+  if (b43 (tb) < REAL (0.))
     o += b43 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b51 (tb) < 0.L)
+  if (b51 (tb) < REAL (0.))
     o += b51 (tb);
-  if (b52 (tb) < 0.L)
+  if (b52 (tb) < REAL (0.))
     o += b52 (tb);
-  if (b53 (tb) < 0.L)
+  if (b53 (tb) < REAL (0.))
     o += b53 (tb);
-  if (b54 (tb) < 0.L)
+  if (b54 (tb) < REAL (0.))
     o += b54 (tb);
-  if (e50 (tb) < 0.L)
+  if (e50 (tb) < REAL (0.))
     o += e50 (tb);
-  if (e51 (tb) < 0.L)
+  if (e51 (tb) < REAL (0.))
     o += e51 (tb);
-  if (e52 (tb) < 0.L)
+  if (e52 (tb) < REAL (0.))
     o += e52 (tb);
-  if (e53 (tb) < 0.L)
+  if (e53 (tb) < REAL (0.))
     o += e53 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L, fmaxl (t1 (tb), fmaxl (t2 (tb), fmaxl (t3 (tb), t4 (tb)))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb), fmaxr (t2 (tb), fmaxr (t3 (tb), t4 (tb)))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_5_4
-  fprintf (stderr, "rk_objective_tb_5_4p: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_5_4p: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_5_4p: end\n");
 #endif
   return o;
@@ -543,11 +545,11 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_5_4tp (RK * rk) ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_5_4
   fprintf (stderr, "rk_objective_tb_5_4t: start\n");
 #endif
@@ -555,55 +557,179 @@ rk_objective_tb_5_4tp (RK * rk) ///< RK struct.
 #if DEBUG_RK_5_4
   rk_print_tb (optimize, "rk_objective_tb_5_4tp", stderr);
 #endif
-  o = fminl (0.L, b20 (tb));
-  if (b21 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b21 (tb) < REAL (0.))
     o += b21 (tb);
-  if (b30 (tb) < 0.L)
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b32 (tb) < 0.L)
+  if (b32 (tb) < REAL (0.))
     o += b32 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b41 (tb) < 0.L)
+  if (b41 (tb) < REAL (0.))
     o += b41 (tb);
-  if (b42 (tb) < 0.L)
+  if (b42 (tb) < REAL (0.))
     o += b42 (tb);
-  if (b43 (tb) < 0.L)
+  if (b43 (tb) < REAL (0.))
     o += b43 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b51 (tb) < 0.L)
+  if (b51 (tb) < REAL (0.))
     o += b51 (tb);
-  if (b52 (tb) < 0.L)
+  if (b52 (tb) < REAL (0.))
     o += b52 (tb);
-  if (b53 (tb) < 0.L)
+  if (b53 (tb) < REAL (0.))
     o += b53 (tb);
-  if (b54 (tb) < 0.L)
+  if (b54 (tb) < REAL (0.))
     o += b54 (tb);
-  if (e50 (tb) < 0.L)
+  if (e50 (tb) < REAL (0.))
     o += e50 (tb);
-  if (e51 (tb) < 0.L)
+  if (e51 (tb) < REAL (0.))
     o += e51 (tb);
-  if (e52 (tb) < 0.L)
+  if (e52 (tb) < REAL (0.))
     o += e52 (tb);
-  if (e53 (tb) < 0.L)
+  if (e53 (tb) < REAL (0.))
     o += e53 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L, fmaxl (t1 (tb), fmaxl (t2 (tb), fmaxl (t3 (tb), t4 (tb)))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb), fmaxr (t2 (tb), fmaxr (t3 (tb), t4 (tb)))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_5_4
-  fprintf (stderr, "rk_objective_tb_5_4tp: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_5_4tp: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_5_4tp: end\n");
 #endif
   return o;
 }
+
+/**
+ * Function to obtain the coefficients and the objective function values of a
+ * batch of 5 steps 4th order Runge-Kutta methods without strong stability.
+ * The lanes without solution get an infinite objective function value.
+ */
+void
+rk_batch_tb_5_4 (Optimize * optimize)   ///< Optimize struct.
+{
+  double M[5 * 4 * OPTIMIZE_BATCH];
+  double *tb, *r, *o, *A, *B, *C, *D, *E;
+  double k;
+  unsigned int l;
+#if DEBUG_RK_5_4
+  fprintf (stderr, "rk_batch_tb_5_4: start\n");
+#endif
+  r = optimize->batch_data;
+  tb = r + OPTIMIZE_BATCH * optimize->nfree;
+  o = tb + OPTIMIZE_BATCH * optimize->size;
+  A = M;
+  B = A + 4 * OPTIMIZE_BATCH;
+  C = B + 4 * OPTIMIZE_BATCH;
+  D = C + 4 * OPTIMIZE_BATCH;
+  E = D + 4 * OPTIMIZE_BATCH;
+  for (l = 0; l < OPTIMIZE_BATCH; ++l)
+    {
+      rk_lane (t5, tb, l) = 1.;
+      rk_lane (t1, tb, l) = r[l];
+      rk_lane (t2, tb, l) = r[OPTIMIZE_BATCH + l];
+      rk_lane (b21, tb, l) = r[2 * OPTIMIZE_BATCH + l];
+      rk_lane (t3, tb, l) = r[3 * OPTIMIZE_BATCH + l];
+      rk_lane (b31, tb, l) = r[4 * OPTIMIZE_BATCH + l];
+      rk_lane (b32, tb, l) = r[5 * OPTIMIZE_BATCH + l];
+      rk_lane (t4, tb, l) = r[6 * OPTIMIZE_BATCH + l];
+      A[l] = rk_lane (t1, tb, l);
+      B[l] = rk_lane (t2, tb, l);
+      C[l] = rk_lane (t3, tb, l);
+      D[l] = rk_lane (t4, tb, l);
+      E[l] = 0.5;
+      A[OPTIMIZE_BATCH + l] = A[l] * rk_lane (t1, tb, l);
+      B[OPTIMIZE_BATCH + l] = B[l] * rk_lane (t2, tb, l);
+      C[OPTIMIZE_BATCH + l] = C[l] * rk_lane (t3, tb, l);
+      D[OPTIMIZE_BATCH + l] = D[l] * rk_lane (t4, tb, l);
+      E[OPTIMIZE_BATCH + l] = 1. / 3.;
+      A[2 * OPTIMIZE_BATCH + l] = A[OPTIMIZE_BATCH + l] * rk_lane (t1, tb, l);
+      B[2 * OPTIMIZE_BATCH + l] = B[OPTIMIZE_BATCH + l] * rk_lane (t2, tb, l);
+      C[2 * OPTIMIZE_BATCH + l] = C[OPTIMIZE_BATCH + l] * rk_lane (t3, tb, l);
+      D[2 * OPTIMIZE_BATCH + l] = D[OPTIMIZE_BATCH + l] * rk_lane (t4, tb, l);
+      E[2 * OPTIMIZE_BATCH + l] = 0.25;
+      A[3 * OPTIMIZE_BATCH + l] = D[3 * OPTIMIZE_BATCH + l] = 0.;
+      B[3 * OPTIMIZE_BATCH + l] = rk_lane (b21, tb, l) * rk_lane (t1, tb, l)
+        * (rk_lane (t2, tb, l) - rk_lane (t4, tb, l));
+      C[3 * OPTIMIZE_BATCH + l] = (rk_lane (b31, tb, l) * rk_lane (t1, tb, l)
+                                   + rk_lane (b32, tb, l) * rk_lane (t2, tb, l))
+        * (rk_lane (t3, tb, l) - rk_lane (t4, tb, l));
+      E[3 * OPTIMIZE_BATCH + l] = 0.125 - 1. / 6. * rk_lane (t4, tb, l);
+    }
+  solve_batch (M, 4);
+
+  // the second system is stored in the first 4 * 3 * OPTIMIZE_BATCH values of
+  // M, keeping the solutions of the first system in the E column
+  E = M + 4 * 4 * OPTIMIZE_BATCH;
+  B = A + 3 * OPTIMIZE_BATCH;
+  C = B + 3 * OPTIMIZE_BATCH;
+  D = C + 3 * OPTIMIZE_BATCH;
+  for (l = 0; l < OPTIMIZE_BATCH; ++l)
+    {
+      rk_lane (b54, tb, l) = E[3 * OPTIMIZE_BATCH + l];
+      rk_lane (b53, tb, l) = E[2 * OPTIMIZE_BATCH + l];
+      rk_lane (b52, tb, l) = E[OPTIMIZE_BATCH + l];
+      rk_lane (b51, tb, l) = E[l];
+      A[l] = rk_lane (t1, tb, l);
+      B[l] = rk_lane (t2, tb, l);
+      C[l] = rk_lane (t3, tb, l);
+      D[l] = 1. / 6.
+        - rk_lane (b52, tb, l) * rk_lane (b21, tb, l) * rk_lane (t1, tb, l)
+        - rk_lane (b53, tb, l) * (rk_lane (b31, tb, l) * rk_lane (t1, tb, l)
+                                  + rk_lane (b32, tb, l) * rk_lane (t2, tb, l));
+      A[OPTIMIZE_BATCH + l] = A[l] * rk_lane (t1, tb, l);
+      B[OPTIMIZE_BATCH + l] = B[l] * rk_lane (t2, tb, l);
+      C[OPTIMIZE_BATCH + l] = C[l] * rk_lane (t3, tb, l);
+      D[OPTIMIZE_BATCH + l] = 1. / 12.
+        - rk_lane (b52, tb, l) * rk_lane (b21, tb, l)
+        * rk_lane (t1, tb, l) * rk_lane (t1, tb, l)
+        - rk_lane (b53, tb, l)
+        * (rk_lane (b31, tb, l) * rk_lane (t1, tb, l) * rk_lane (t1, tb, l)
+           + rk_lane (b32, tb, l) * rk_lane (t2, tb, l) * rk_lane (t2, tb, l));
+      A[2 * OPTIMIZE_BATCH + l] = 0.;
+      B[2 * OPTIMIZE_BATCH + l] = rk_lane (b21, tb, l) * rk_lane (t1, tb, l);
+      C[2 * OPTIMIZE_BATCH + l] = rk_lane (b31, tb, l) * rk_lane (t1, tb, l)
+        + rk_lane (b32, tb, l) * rk_lane (t2, tb, l);
+      D[2 * OPTIMIZE_BATCH + l] = 1. / 24.
+        - rk_lane (b53, tb, l) * rk_lane (b32, tb, l) * rk_lane (b21, tb, l)
+        * rk_lane (t1, tb, l);
+    }
+  solve_batch (M, 3);
+  for (l = 0; l < OPTIMIZE_BATCH; ++l)
+    {
+      rk_lane (b43, tb, l) = D[2 * OPTIMIZE_BATCH + l] / rk_lane (b54, tb, l);
+      rk_lane (b42, tb, l) = D[OPTIMIZE_BATCH + l] / rk_lane (b54, tb, l);
+      rk_lane (b41, tb, l) = D[l] / rk_lane (b54, tb, l);
+      rk_batch_b_5 (tb, l);
+      k = fmin (0., rk_lane (b20, tb, l)) + fmin (0., rk_lane (b30, tb, l))
+        + fmin (0., rk_lane (b40, tb, l)) + fmin (0., rk_lane (b41, tb, l))
+        + fmin (0., rk_lane (b42, tb, l)) + fmin (0., rk_lane (b43, tb, l))
+        + fmin (0., rk_lane (b50, tb, l)) + fmin (0., rk_lane (b51, tb, l))
+        + fmin (0., rk_lane (b52, tb, l)) + fmin (0., rk_lane (b53, tb, l))
+        + fmin (0., rk_lane (b54, tb, l));
+      o[l] = (k < 0.) ? 40. - k
+        : 30. + fmax (1., fmax (rk_lane (t1, tb, l),
+                                fmax (rk_lane (t2, tb, l),
+                                      fmax (rk_lane (t3, tb, l),
+                                            rk_lane (t4, tb, l)))));
+      o[l] = (isnan (E[l]) || isnan (E[OPTIMIZE_BATCH + l])
+              || isnan (E[2 * OPTIMIZE_BATCH + l])
+              || isnan (E[3 * OPTIMIZE_BATCH + l])
+              || isnan (rk_lane (b43, tb, l)) || isnan (rk_lane (b42, tb, l))
+              || isnan (rk_lane (b41, tb, l))) ? INFINITY : o[l];
+    }
+#if DEBUG_RK_5_4
+  fprintf (stderr, "rk_batch_tb_5_4: end\n");
+#endif
+}
@@ -37,7 +37,6 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #include "config.h"
 #include "utils.h"
 #include "optimize.h"
@@ -53,13 +52,13 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 int
 rk_tb_6_2 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_6_2
   fprintf (stderr, "rk_tb_6_2: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t6 (tb) = 1.L;
+  t6 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
@@ -79,7 +78,7 @@ rk_tb_6_2 (Optimize * optimize) ///< Optimize struct.
   b63 (tb) = r[16];
   b64 (tb) = r[17];
   b65 (tb) = r[18];
-  b61 (tb) = (0.5L - b62 (tb) * t2 (tb) - b63 (tb) * t3 (tb)
+  b61 (tb) = (REAL (0.5) - b62 (tb) * t2 (tb) - b63 (tb) * t3 (tb)
               - b64 (tb) * t4 (tb) - b65 (tb) * t5 (tb)) / t1 (tb);
   if (isnan (b61 (tb)))
     return 0;
@@ -98,13 +97,13 @@ rk_tb_6_2 (Optimize * optimize) ///< Optimize struct.
 int
 rk_tb_6_2t (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_6_2
   fprintf (stderr, "rk_tb_6_2t: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t6 (tb) = 1.L;
+  t6 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
@@ -123,14 +122,14 @@ rk_tb_6_2t (Optimize * optimize)        ///< Optimize struct.
   b61 (tb) = r[15];
   b62 (tb) = r[16];
   b63 (tb) = r[17];
-  b64 (tb) = (1.L / 3.L - 0.5L * t5 (tb)
+  b64 (tb) = (REAL (1.) / REAL (3.) - REAL (0.5) * t5 (tb)
               - b61 (tb) * t1 (tb) * (t1 (tb) - t5 (tb))
               - b62 (tb) * t2 (tb) * (t2 (tb) - t5 (tb))
               - b63 (tb) * t3 (tb) * (t3 (tb) - t5 (tb)))
     / (t4 (tb) * (t4 (tb) - t5 (tb)));
   if (isnan (b64 (tb)))
     return 0;
-  b65 (tb) = (0.5L - b61 (tb) * t1 (tb) - b62 (tb) * t2 (tb)
+  b65 (tb) = (REAL (0.5) - b61 (tb) * t1 (tb) - b62 (tb) * t2 (tb)
               - b63 (tb) * t3 (tb) - b64 (tb) * t4 (tb)) / t5 (tb);
   if (isnan (b65 (tb)))
     return 0;
@@ -149,14 +148,14 @@ rk_tb_6_2t (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_6_2p (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_6_2
   fprintf (stderr, "rk_tb_6_2p: start\n");
 #endif
   if (!rk_tb_6_2 (optimize))
     return 0;
   tb = optimize->coefficient;
-  e61 (tb) = e62 (tb) = e63 (tb) = e64 (tb) = 0.L;
+  e61 (tb) = e62 (tb) = e63 (tb) = e64 (tb) = REAL (0.);
   rk_e_6 (tb);
 #if DEBUG_RK_6_2
   fprintf (stderr, "rk_tb_6_2p: end\n");
@@ -171,14 +170,14 @@ rk_tb_6_2p (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_6_2tp (Optimize * optimize)       ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_6_2
   fprintf (stderr, "rk_tb_6_2tp: start\n");
 #endif
   if (!rk_tb_6_2t (optimize))
     return 0;
   tb = optimize->coefficient;
-  e61 (tb) = e62 (tb) = e63 (tb) = e64 (tb) = 0.L;
+  e61 (tb) = e62 (tb) = e63 (tb) = e64 (tb) = REAL (0.);
   rk_e_6 (tb);
 #if DEBUG_RK_6_2
   fprintf (stderr, "rk_tb_6_2tp: end\n");
@@ -192,44 +191,44 @@ rk_tb_6_2tp (Optimize * optimize)       ///< Optimize struct.
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_6_2 (RK * rk)   ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_6_2
   fprintf (stderr, "rk_objective_tb_6_2: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b60 (tb) < 0.L)
+  if (b60 (tb) < REAL (0.))
     o += b60 (tb);
-  if (b61 (tb) < 0.L)
+  if (b61 (tb) < REAL (0.))
     o += b61 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L,
-             fmaxl (t1 (tb),
-                    fmaxl (t2 (tb),
-                           fmaxl (t3 (tb), fmaxl (t4 (tb), t5 (tb))))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb),
+                    fmaxr (t2 (tb),
+                           fmaxr (t3 (tb), fmaxr (t4 (tb), t5 (tb))))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_6_2
-  fprintf (stderr, "rk_objective_tb_6_2: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_6_2: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_6_2: end\n");
 #endif
   return o;
@@ -241,11 +240,11 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_6_2t (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_6_2
   fprintf (stderr, "rk_objective_tb_6_2t: start\n");
 #endif
@@ -253,37 +252,37 @@ rk_objective_tb_6_2t (RK * rk)  ///< RK struct.
 #if DEBUG_RK_6_2
   rk_print_tb (optimize, "rk_objective_tb_6_2t", stderr);
 #endif
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b60 (tb) < 0.L)
+  if (b60 (tb) < REAL (0.))
     o += b60 (tb);
-  if (b64 (tb) < 0.L)
+  if (b64 (tb) < REAL (0.))
     o += b64 (tb);
-  if (b65 (tb) < 0.L)
+  if (b65 (tb) < REAL (0.))
     o += b65 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L,
-             fmaxl (t1 (tb),
-                    fmaxl (t2 (tb),
-                           fmaxl (t3 (tb), fmaxl (t4 (tb), t5 (tb))))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb),
+                    fmaxr (t2 (tb),
+                           fmaxr (t3 (tb), fmaxr (t4 (tb), t5 (tb))))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_6_2
-  fprintf (stderr, "rk_objective_tb_6_2t: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_6_2t: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_6_2t: end\n");
 #endif
   return o;
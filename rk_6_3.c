@@ -37,7 +37,6 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #include "config.h"
 #include "utils.h"
 #include "optimize.h"
@@ -53,14 +52,14 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 int
 rk_tb_6_3 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[3], B[3], C[3], D[3];
-  long double *tb, *r;
+  Real A[3], B[3], C[3], D[3];
+  Real *tb, *r;
 #if DEBUG_RK_6_3
   fprintf (stderr, "rk_tb_6_3: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t6 (tb) = 1.L;
+  t6 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
@@ -81,16 +80,17 @@ rk_tb_6_3 (Optimize * optimize) ///< Optimize struct.
   A[0] = t1 (tb);
   B[0] = t2 (tb);
   C[0] = t3 (tb);
-  D[0] = 0.5L - b64 (tb) * t4 (tb) - b65 (tb) * t5 (tb);
+  D[0] = REAL (0.5) - b64 (tb) * t4 (tb) - b65 (tb) * t5 (tb);
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
-  D[1] = 1.L / 3.L - b64 (tb) * sqr (t4 (tb)) - b65 (tb) * sqr (t5 (tb));
-  A[2] = 0.L;
+  D[1] = REAL (1.) / REAL (3.) - b64 (tb) * sqr (t4 (tb))
+    - b65 (tb) * sqr (t5 (tb));
+  A[2] = REAL (0.);
   B[2] = b21 (tb) * t1 (tb);
   C[2] = b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb);
-  D[2] = 1.L / 6.L - b64 (tb) * (b41 (tb) * t1 (tb) + b42 (tb) * t2 (tb)
-                                 + b43 (tb) * t3 (tb))
+  D[2] = REAL (1.) / REAL (6.)
+    - b64 (tb) * (b41 (tb) * t1 (tb) + b42 (tb) * t2 (tb) + b43 (tb) * t3 (tb))
     - b65 (tb) * (b51 (tb) * t1 (tb) + b52 (tb) * t2 (tb)
                   + b53 (tb) * t3 (tb) + b54 (tb) * t4 (tb));
   solve_3 (A, B, C, D);
@@ -113,14 +113,14 @@ rk_tb_6_3 (Optimize * optimize) ///< Optimize struct.
 int
 rk_tb_6_3t (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4];
-  long double *tb, *r;
+  Real A[4], B[4], C[4], D[4], E[4];
+  Real *tb, *r;
 #if DEBUG_RK_6_3
   fprintf (stderr, "rk_tb_6_3t: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t6 (tb) = 1.L;
+  t6 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
@@ -141,23 +141,24 @@ rk_tb_6_3t (Optimize * optimize)        ///< Optimize struct.
   B[0] = t2 (tb);
   C[0] = t3 (tb);
   D[0] = t4 (tb);
-  E[0] = 0.5L - b65 (tb) * t5 (tb);
+  E[0] = REAL (0.5) - b65 (tb) * t5 (tb);
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
   D[1] = D[0] * t4 (tb);
-  E[1] = 1.L / 3.L - b65 (tb) * sqr (t5 (tb));
+  E[1] = REAL (1.) / REAL (3.) - b65 (tb) * sqr (t5 (tb));
   A[2] = A[1] * t1 (tb);
   B[2] = B[1] * t2 (tb);
   C[2] = C[1] * t3 (tb);
   D[2] = D[1] * t4 (tb);
-  E[2] = 0.25L - b65 (tb) * sqr (t5 (tb)) * t5 (tb);
-  A[3] = 0.L;
+  E[2] = REAL (0.25) - b65 (tb) * sqr (t5 (tb)) * t5 (tb);
+  A[3] = REAL (0.);
   B[3] = b21 (tb) * t1 (tb);
   C[3] = b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb);
   D[3] = b41 (tb) * t1 (tb) + b42 (tb) * t2 (tb) + b43 (tb) * t3 (tb);
-  E[3] = 1.L / 6.L - b65 (tb) * (b51 (tb) * t1 (tb) + b52 (tb) * t2 (tb)
-                                 + b53 (tb) * t3 (tb) + b54 (tb) * t4 (tb));
+  E[3] = REAL (1.) / REAL (6.)
+    - b65 (tb) * (b51 (tb) * t1 (tb) + b52 (tb) * t2 (tb)
+                  + b53 (tb) * t3 (tb) + b54 (tb) * t4 (tb));
   solve_4 (A, B, C, D, E);
   if (isnan (E[0]) || isnan (E[1]) || isnan (E[2]) || isnan (E[3]))
     return 0;
@@ -179,15 +180,15 @@ rk_tb_6_3t (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_6_3p (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_6_3
   fprintf (stderr, "rk_tb_6_3p: start\n");
 #endif
   if (!rk_tb_6_3 (optimize))
     return 0;
   tb = optimize->coefficient;
-  e51 (tb) = 0.5L / t1 (tb);
-  e52 (tb) = e53 (tb) = 0.L;
+  e61 (tb) = REAL (0.5) / t1 (tb);
+  e62 (tb) = e63 (tb) = e64 (tb) = REAL (0.);
   rk_e_6 (tb);
 #if DEBUG_RK_6_3
   fprintf (stderr, "rk_tb_6_3p: end\n");
@@ -202,18 +203,19 @@ rk_tb_6_3p (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_6_3tp (Optimize * optimize)       ///< Optimize struct.
 {
-  long double *tb;
+  Real *tb;
 #if DEBUG_RK_6_3
   fprintf (stderr, "rk_tb_6_3tp: start\n");
 #endif
   if (!rk_tb_6_3t (optimize))
     return 0;
   tb = optimize->coefficient;
-  e63 (tb) = e64 (tb) = 0.L;
-  e62 (tb) = (1.L / 3.L - 0.5L * t1 (tb)) / (t2 (tb) * (t2 (tb) - t1 (tb)));
+  e63 (tb) = e64 (tb) = REAL (0.);
+  e62 (tb) = (REAL (1.) / REAL (3.) - REAL (0.5) * t1 (tb))
+    / (t2 (tb) * (t2 (tb) - t1 (tb)));
   if (isnan (e62 (tb)))
     return 0;
-  e61 (tb) = (0.5L - e52 (tb) * t2 (tb)) / t1 (tb);
+  e61 (tb) = (REAL (0.5) - e62 (tb) * t2 (tb)) / t1 (tb);
   if (isnan (e61 (tb)))
     return 0;
   rk_e_6 (tb);
@@ -229,50 +231,50 @@ rk_tb_6_3tp (Optimize * optimize)       ///< Optimize struct.
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_6_3 (RK * rk)   ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_6_3
   fprintf (stderr, "rk_objective_tb_6_3: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b60 (tb) < 0.L)
+  if (b60 (tb) < REAL (0.))
     o += b60 (tb);
-  if (b61 (tb) < 0.L)
+  if (b61 (tb) < REAL (0.))
     o += b61 (tb);
-  if (b62 (tb) < 0.L)
+  if (b62 (tb) < REAL (0.))
     o += b62 (tb);
-  if (b63 (tb) < 0.L)
+  if (b63 (tb) < REAL (0.))
     o += b63 (tb);
-  if (b64 (tb) < 0.L)
+  if (b64 (tb) < REAL (0.))
     o += b64 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L,
-             fmaxl (t1 (tb),
-                    fmaxl (t2 (tb),
-                           fmaxl (t3 (tb), fmaxl (t4 (tb), t5 (tb))))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb),
+                    fmaxr (t2 (tb),
+                           fmaxr (t3 (tb), fmaxr (t4 (tb), t5 (tb))))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_6_3
-  fprintf (stderr, "rk_objective_tb_6_3: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_6_3: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_6_3: end\n");
 #endif
   return o;
@@ -284,50 +286,50 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_6_3t (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_6_3
   fprintf (stderr, "rk_objective_tb_6_3t: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b60 (tb) < 0.L)
+  if (b60 (tb) < REAL (0.))
     o += b60 (tb);
-  if (b61 (tb) < 0.L)
+  if (b61 (tb) < REAL (0.))
     o += b61 (tb);
-  if (b62 (tb) < 0.L)
+  if (b62 (tb) < REAL (0.))
     o += b62 (tb);
-  if (b63 (tb) < 0.L)
+  if (b63 (tb) < REAL (0.))
     o += b63 (tb);
-  if (b64 (tb) < 0.L)
+  if (b64 (tb) < REAL (0.))
     o += b64 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L,
-             fmaxl (t1 (tb),
-                    fmaxl (t2 (tb),
-                           fmaxl (t3 (tb), fmaxl (t4 (tb), t5 (tb))))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb),
+                    fmaxr (t2 (tb),
+                           fmaxr (t3 (tb), fmaxr (t4 (tb), t5 (tb))))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_6_3
-  fprintf (stderr, "rk_objective_tb_6_3t: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_6_3t: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_6_3t: end\n");
 #endif
   return o;
@@ -339,54 +341,54 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_6_3p (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_6_3
   fprintf (stderr, "rk_objective_tb_6_3p: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b60 (tb) < 0.L)
+  if (b60 (tb) < REAL (0.))
     o += b60 (tb);
-  if (b61 (tb) < 0.L)
+  if (b61 (tb) < REAL (0.))
     o += b61 (tb);
-  if (b62 (tb) < 0.L)
+  if (b62 (tb) < REAL (0.))
     o += b62 (tb);
-  if (b63 (tb) < 0.L)
+  if (b63 (tb) < REAL (0.))
     o += b63 (tb);
-  if (b64 (tb) < 0.L)
+  if (b64 (tb) < REAL (0.))
     o += b64 (tb);
-  if (e60 (tb) < 0.L)
+  if (e60 (tb) < REAL (0.))
     o += e60 (tb);
-  if (e61 (tb) < 0.L)
+  if (e61 (tb) < REAL (0.))
     o += e61 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L,
-             fmaxl (t1 (tb),
-                    fmaxl (t2 (tb),
-                           fmaxl (t3 (tb), fmaxl (t4 (tb), t5 (tb))))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb),
+                    fmaxr (t2 (tb),
+                           fmaxr (t3 (tb), fmaxr (t4 (tb), t5 (tb))))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_6_3
-  fprintf (stderr, "rk_objective_tb_6_3p: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_6_3p: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_6_3p: end\n");
 #endif
   return o;
@@ -398,57 +400,149 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_6_3tp (RK * rk) ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_6_3
   fprintf (stderr, "rk_objective_tb_6_3tp: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b60 (tb) < 0.L)
+  if (b60 (tb) < REAL (0.))
     o += b60 (tb);
-  if (b61 (tb) < 0.L)
+  if (b61 (tb) < REAL (0.))
     o += b61 (tb);
-  if (b62 (tb) < 0.L)
+  if (b62 (tb) < REAL (0.))
     o += b62 (tb);
-  if (b63 (tb) < 0.L)
+  if (b63 (tb) < REAL (0.))
     o += b63 (tb);
-  if (b64 (tb) < 0.L)
+  if (b64 (tb) < REAL (0.))
     o += b64 (tb);
-  if (e60 (tb) < 0.L)
+  if (e60 (tb) < REAL (0.))
     o += e60 (tb);
-  if (e61 (tb) < 0.L)
+  if (e61 (tb) < REAL (0.))
     o += e61 (tb);
-  if (e62 (tb) < 0.L)
+  if (e62 (tb) < REAL (0.))
     o += e62 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L,
-             fmaxl (t1 (tb),
-                    fmaxl (t2 (tb),
-                           fmaxl (t3 (tb), fmaxl (t4 (tb), t5 (tb))))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb),
+                    fmaxr (t2 (tb),
+                           fmaxr (t3 (tb), fmaxr (t4 (tb), t5 (tb))))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_6_3
-  fprintf (stderr, "rk_objective_tb_6_3tp: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_6_3tp: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_6_3tp: end\n");
 #endif
   return o;
 }
+
+/**
+ * Function to obtain the coefficients and the objective function values of a
+ * batch of 6 steps 3rd order Runge-Kutta methods without strong stability.
+ * The lanes without solution get an infinite objective function value.
+ */
+void
+rk_batch_tb_6_3 (Optimize * optimize)   ///< Optimize struct.
+{
+  double M[4 * 3 * OPTIMIZE_BATCH];
+  double *tb, *r, *o, *A, *B, *C, *D;
+  double k;
+  unsigned int l;
+#if DEBUG_RK_6_3
+  fprintf (stderr, "rk_batch_tb_6_3: start\n");
+#endif
+  r = optimize->batch_data;
+  tb = r + OPTIMIZE_BATCH * optimize->nfree;
+  o = tb + OPTIMIZE_BATCH * optimize->size;
+  A = M;
+  B = A + 3 * OPTIMIZE_BATCH;
+  C = B + 3 * OPTIMIZE_BATCH;
+  D = C + 3 * OPTIMIZE_BATCH;
+  for (l = 0; l < OPTIMIZE_BATCH; ++l)
+    {
+      rk_lane (t6, tb, l) = 1.;
+      rk_lane (t1, tb, l) = r[l];
+      rk_lane (t2, tb, l) = r[OPTIMIZE_BATCH + l];
+      rk_lane (b21, tb, l) = r[2 * OPTIMIZE_BATCH + l];
+      rk_lane (t3, tb, l) = r[3 * OPTIMIZE_BATCH + l];
+      rk_lane (b31, tb, l) = r[4 * OPTIMIZE_BATCH + l];
+      rk_lane (b32, tb, l) = r[5 * OPTIMIZE_BATCH + l];
+      rk_lane (t4, tb, l) = r[6 * OPTIMIZE_BATCH + l];
+      rk_lane (b41, tb, l) = r[7 * OPTIMIZE_BATCH + l];
+      rk_lane (b42, tb, l) = r[8 * OPTIMIZE_BATCH + l];
+      rk_lane (b43, tb, l) = r[9 * OPTIMIZE_BATCH + l];
+      rk_lane (t5, tb, l) = r[10 * OPTIMIZE_BATCH + l];
+      rk_lane (b51, tb, l) = r[11 * OPTIMIZE_BATCH + l];
+      rk_lane (b52, tb, l) = r[12 * OPTIMIZE_BATCH + l];
+      rk_lane (b53, tb, l) = r[13 * OPTIMIZE_BATCH + l];
+      rk_lane (b54, tb, l) = r[14 * OPTIMIZE_BATCH + l];
+      rk_lane (b65, tb, l) = r[15 * OPTIMIZE_BATCH + l];
+      rk_lane (b64, tb, l) = r[16 * OPTIMIZE_BATCH + l];
+      A[l] = rk_lane (t1, tb, l);
+      B[l] = rk_lane (t2, tb, l);
+      C[l] = rk_lane (t3, tb, l);
+      D[l] = 0.5 - rk_lane (b64, tb, l) * rk_lane (t4, tb, l)
+        - rk_lane (b65, tb, l) * rk_lane (t5, tb, l);
+      A[OPTIMIZE_BATCH + l] = A[l] * rk_lane (t1, tb, l);
+      B[OPTIMIZE_BATCH + l] = B[l] * rk_lane (t2, tb, l);
+      C[OPTIMIZE_BATCH + l] = C[l] * rk_lane (t3, tb, l);
+      D[OPTIMIZE_BATCH + l] = 1. / 3.
+        - rk_lane (b64, tb, l) * rk_lane (t4, tb, l) * rk_lane (t4, tb, l)
+        - rk_lane (b65, tb, l) * rk_lane (t5, tb, l) * rk_lane (t5, tb, l);
+      A[2 * OPTIMIZE_BATCH + l] = 0.;
+      B[2 * OPTIMIZE_BATCH + l] = rk_lane (b21, tb, l) * rk_lane (t1, tb, l);
+      C[2 * OPTIMIZE_BATCH + l] = rk_lane (b31, tb, l) * rk_lane (t1, tb, l)
+        + rk_lane (b32, tb, l) * rk_lane (t2, tb, l);
+      D[2 * OPTIMIZE_BATCH + l] = 1. / 6.
+        - rk_lane (b64, tb, l) * (rk_lane (b41, tb, l) * rk_lane (t1, tb, l)
+                                  + rk_lane (b42, tb, l) * rk_lane (t2, tb, l)
+                                  + rk_lane (b43, tb, l) * rk_lane (t3, tb, l))
+        - rk_lane (b65, tb, l) * (rk_lane (b51, tb, l) * rk_lane (t1, tb, l)
+                                  + rk_lane (b52, tb, l) * rk_lane (t2, tb, l)
+                                  + rk_lane (b53, tb, l) * rk_lane (t3, tb, l)
+                                  + rk_lane (b54, tb, l) * rk_lane (t4, tb, l));
+    }
+  solve_batch (M, 3);
+  for (l = 0; l < OPTIMIZE_BATCH; ++l)
+    {
+      rk_lane (b63, tb, l) = D[2 * OPTIMIZE_BATCH + l];
+      rk_lane (b62, tb, l) = D[OPTIMIZE_BATCH + l];
+      rk_lane (b61, tb, l) = D[l];
+      rk_batch_b_6 (tb, l);
+      k = fmin (0., rk_lane (b20, tb, l)) + fmin (0., rk_lane (b30, tb, l))
+        + fmin (0., rk_lane (b40, tb, l)) + fmin (0., rk_lane (b50, tb, l))
+        + fmin (0., rk_lane (b60, tb, l)) + fmin (0., rk_lane (b61, tb, l))
+        + fmin (0., rk_lane (b62, tb, l)) + fmin (0., rk_lane (b63, tb, l))
+        + fmin (0., rk_lane (b64, tb, l));
+      o[l] = (k < 0.) ? 40. - k
+        : 30. + fmax (1., fmax (rk_lane (t1, tb, l),
+                                fmax (rk_lane (t2, tb, l),
+                                      fmax (rk_lane (t3, tb, l),
+                                            fmax (rk_lane (t4, tb, l),
+                                                  rk_lane (t5, tb, l))))));
+      o[l] = (isnan (D[l]) || isnan (D[OPTIMIZE_BATCH + l])
+              || isnan (D[2 * OPTIMIZE_BATCH + l])) ? INFINITY : o[l];
+    }
+#if DEBUG_RK_6_3
+  fprintf (stderr, "rk_batch_tb_6_3: end\n");
+#endif
+}
@@ -37,7 +37,6 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #include "config.h"
 #include "utils.h"
 #include "optimize.h"
@@ -53,14 +52,14 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 int
 rk_tb_6_4 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4];
-  long double *tb, *r;
+  Real A[4], B[4], C[4], D[4], E[4];
+  Real *tb, *r;
 #if DEBUG_RK_6_4
   fprintf (stderr, "rk_tb_6_4: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t6 (tb) = 1.L;
+  t6 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
@@ -78,23 +77,23 @@ rk_tb_6_4 (Optimize * optimize) ///< Optimize struct.
   B[0] = t2 (tb);
   C[0] = t3 (tb);
   D[0] = t4 (tb);
-  E[0] = 0.5L - b65 (tb) * t5 (tb);
+  E[0] = REAL (0.5) - b65 (tb) * t5 (tb);
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
   D[1] = D[0] * t4 (tb);
-  E[1] = 1.L / 3.L - b65 (tb) * sqr (t5 (tb));
+  E[1] = REAL (1.) / REAL (3.) - b65 (tb) * sqr (t5 (tb));
   A[2] = A[1] * t1 (tb);
   B[2] = B[1] * t2 (tb);
   C[2] = C[1] * t3 (tb);
   D[2] = D[1] * t4 (tb);
-  E[2] = 0.25L - b65 (tb) * sqr (t5 (tb)) * t5 (tb);
-  A[3] = 0.L;
+  E[2] = REAL (0.25) - b65 (tb) * sqr (t5 (tb)) * t5 (tb);
+  A[3] = REAL (0.);
   B[3] = b21 (tb) * t1 (tb) * (t2 (tb) - t5 (tb));
   C[3] = (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb)) * (t3 (tb) - t5 (tb));
   D[3] = (b41 (tb) * t1 (tb) + b42 (tb) * t2 (tb) + b43 (tb) * t3 (tb))
     * (t4 (tb) - t5 (tb));
-  E[3] = 0.125L - 1.L / 6.L * t5 (tb);
+  E[3] = REAL (0.125) - REAL (1.) / REAL (6.) * t5 (tb);
   solve_4 (A, B, C, D, E);
   if (isnan (E[0]) || isnan (E[1]) || isnan (E[2]) || isnan (E[3]))
     return 0;
@@ -105,22 +104,22 @@ rk_tb_6_4 (Optimize * optimize) ///< Optimize struct.
   A[0] = t1 (tb);
   B[0] = t2 (tb);
   C[0] = t3 (tb);
-  D[0] = (1.L / 6.L - b62 (tb) * b21 (tb) * t1 (tb)
+  D[0] = (REAL (1.) / REAL (6.) - b62 (tb) * b21 (tb) * t1 (tb)
           - b63 (tb) * (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb))
           - b64 (tb) * (b41 (tb) * t1 (tb) + b42 (tb) * t2 (tb)
                         + b43 (tb) * t3 (tb))) / b65 (tb) - b54 (tb) * t4 (tb);
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
-  D[1] = (1.L / 12.L - b62 (tb) * b21 (tb) * sqr (t1 (tb))
+  D[1] = (REAL (1.) / REAL (12.) - b62 (tb) * b21 (tb) * sqr (t1 (tb))
           - b63 (tb) * (b31 (tb) * sqr (t1 (tb)) + b32 (tb) * sqr (t2 (tb)))
           - b64 (tb) * (b41 (tb) * sqr (t1 (tb)) + b42 (tb) * sqr (t2 (tb))
                         + b43 (tb) * sqr (t3 (tb)))) / b65 (tb)
     - b54 (tb) * sqr (t4 (tb));
-  A[2] = 0.L;
+  A[2] = REAL (0.);
   B[2] = b21 (tb) * t1 (tb);
   C[2] = b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb);
-  D[2] = (1.L / 24.L - b63 (tb) * b32 (tb) * b21 (tb) * t1 (tb)
+  D[2] = (REAL (1.) / REAL (24.) - b63 (tb) * b32 (tb) * b21 (tb) * t1 (tb)
           - b64 (tb) * (b42 (tb) * b21 (tb) * t1 (tb)
                         + b43 (tb) * (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb))))
     / b65 (tb) - b54 (tb) * (b41 (tb) * t1 (tb) + b42 (tb) * t2 (tb)
@@ -145,14 +144,14 @@ rk_tb_6_4 (Optimize * optimize) ///< Optimize struct.
 int
 rk_tb_6_4t (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[5], B[5], C[5], D[5], E[5], F[5];
-  long double *tb, *r;
+  Real A[5], B[5], C[5], D[5], E[5], F[5];
+  Real *tb, *r;
 #if DEBUG_RK_6_4
   fprintf (stderr, "rk_tb_6_4t: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t6 (tb) = 1.L;
+  t6 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
@@ -170,31 +169,31 @@ rk_tb_6_4t (Optimize * optimize)        ///< Optimize struct.
   C[0] = t3 (tb);
   D[0] = t4 (tb);
   E[0] = t5 (tb);
-  F[0] = 0.5L;
+  F[0] = REAL (0.5);
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
   D[1] = D[0] * t4 (tb);
   E[1] = E[0] * t5 (tb);
-  F[1] = 1.L / 3.L;
+  F[1] = REAL (1.) / REAL (3.);
   A[2] = A[1] * t1 (tb);
   B[2] = B[1] * t2 (tb);
   C[2] = C[1] * t3 (tb);
   D[2] = D[1] * t4 (tb);
   E[2] = E[1] * t5 (tb);
-  F[2] = 0.25L;
+  F[2] = REAL (0.25);
   A[3] = A[2] * t1 (tb);
   B[3] = B[2] * t2 (tb);
   C[3] = C[2] * t3 (tb);
   D[3] = D[2] * t4 (tb);
   E[3] = E[2] * t5 (tb);
-  F[3] = 0.2L;
+  F[3] = REAL (0.2);
   A[4] = A[3] * t1 (tb);
   B[4] = B[3] * t2 (tb);
   C[4] = C[3] * t3 (tb);
   D[4] = D[3] * t4 (tb);
   E[4] = E[3] * t5 (tb);
-  F[4] = 1.L / 6.L;
+  F[4] = REAL (1.) / REAL (6.);
   solve_5 (A, B, C, D, E, F);
   if (isnan (F[0]) || isnan (F[1]) || isnan (F[2]) || isnan (F[3])
       || isnan (F[4]))
@@ -207,22 +206,22 @@ rk_tb_6_4t (Optimize * optimize)        ///< Optimize struct.
   A[0] = t1 (tb);
   B[0] = t2 (tb);
   C[0] = t3 (tb);
-  D[0] = (1.L / 6.L - b62 (tb) * b21 (tb) * t1 (tb)
+  D[0] = (REAL (1.) / REAL (6.) - b62 (tb) * b21 (tb) * t1 (tb)
           - b63 (tb) * (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb))
           - b64 (tb) * (b41 (tb) * t1 (tb) + b42 (tb) * t2 (tb)
                         + b43 (tb) * t3 (tb))) / b65 (tb) - b54 (tb) * t4 (tb);
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
-  D[1] = (1.L / 12.L - b62 (tb) * b21 (tb) * sqr (t1 (tb))
+  D[1] = (REAL (1.) / REAL (12.) - b62 (tb) * b21 (tb) * sqr (t1 (tb))
           - b63 (tb) * (b31 (tb) * sqr (t1 (tb)) + b32 (tb) * sqr (t2 (tb)))
           - b64 (tb) * (b41 (tb) * sqr (t1 (tb)) + b42 (tb) * sqr (t2 (tb))
                         + b43 (tb) * sqr (t3 (tb)))) / b65 (tb)
     - b54 (tb) * sqr (t4 (tb));
-  A[2] = 0.L;
+  A[2] = REAL (0.);
   B[2] = b21 (tb) * t1 (tb);
   C[2] = b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb);
-  D[2] = (1.L / 24.L - b63 (tb) * b32 (tb) * b21 (tb) * t1 (tb)
+  D[2] = (REAL (1.) / REAL (24.) - b63 (tb) * b32 (tb) * b21 (tb) * t1 (tb)
           - b64 (tb) * (b42 (tb) * b21 (tb) * t1 (tb)
                         + b43 (tb) * (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb))))
     / b65 (tb) - b54 (tb) * (b41 (tb) * t1 (tb) + b42 (tb) * t2 (tb)
@@ -248,14 +247,14 @@ rk_tb_6_4t (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_6_4p (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4], AA[4], BB[4], CC[4], DD[4], EE[4];
-  long double *tb, *r;
+  Real A[4], B[4], C[4], D[4], E[4], AA[4], BB[4], CC[4], DD[4], EE[4];
+  Real *tb, *r;
 #if DEBUG_RK_6_4
   fprintf (stderr, "rk_tb_6_4p: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t6 (tb) = 1.L;
+  t6 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   b21 (tb) = r[2];
@@ -273,29 +272,29 @@ rk_tb_6_4p (Optimize * optimize)        ///< Optimize struct.
   B[0] = BB[0] = t2 (tb);
   C[0] = CC[0] = t3 (tb);
   D[0] = DD[0] = t4 (tb);
-  EE[0] = 0.5L;
-  E[0] = 0.5L - b65 (tb) * t5 (tb);
+  EE[0] = REAL (0.5);
+  E[0] = REAL (0.5) - b65 (tb) * t5 (tb);
   A[1] = AA[1] = A[0] * t1 (tb);
   B[1] = BB[1] = B[0] * t2 (tb);
   C[1] = CC[1] = C[0] * t3 (tb);
   D[1] = DD[1] = D[0] * t4 (tb);
-  EE[1] = 1.L / 3.L;
-  E[1] = 1.L / 3.L - b65 (tb) * sqr (t5 (tb));
+  EE[1] = REAL (1.) / REAL (3.);
+  E[1] = REAL (1.) / REAL (3.) - b65 (tb) * sqr (t5 (tb));
   A[2] = AA[2] = A[1] * t1 (tb);
   B[2] = BB[2] = B[1] * t2 (tb);
   C[2] = CC[2] = C[1] * t3 (tb);
   D[2] = DD[2] = D[1] * t4 (tb);
-  EE[2] = 0.25L;
-  E[2] = 0.25L - b65 (tb) * sqr (t5 (tb)) * t5 (tb);
-  A[3] = AA[3] = 0.L;
+  EE[2] = REAL (0.25);
+  E[2] = REAL (0.25) - b65 (tb) * sqr (t5 (tb)) * t5 (tb);
+  A[3] = AA[3] = REAL (0.);
   BB[3] = b21 (tb) * t1 (tb);
   B[3] = BB[3] * (t2 (tb) - t5 (tb));
   CC[3] = (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb));
   C[3] = CC[3] * (t3 (tb) - t5 (tb));
   DD[3] = (b41 (tb) * t1 (tb) + b42 (tb) * t2 (tb) + b43 (tb) * t3 (tb));
   D[3] = DD[3] * (t4 (tb) - t5 (tb));
-  EE[3] = 1.L / 6.L;
-  E[3] = 0.125L - 1.L / 6.L * t5 (tb);
+  EE[3] = REAL (1.) / REAL (6.);
+  E[3] = REAL (0.125) - REAL (1.) / REAL (6.) * t5 (tb);
   solve_4 (A, B, C, D, E);
   if (isnan (E[0]) || isnan (E[1]) || isnan (E[2]) || isnan (E[3]))
     return 0;
@@ -313,22 +312,22 @@ rk_tb_6_4p (Optimize * optimize)        ///< Optimize struct.
   A[0] = t1 (tb);
   B[0] = t2 (tb);
   C[0] = t3 (tb);
-  D[0] = (1.L / 6.L - b62 (tb) * b21 (tb) * t1 (tb)
+  D[0] = (REAL (1.) / REAL (6.) - b62 (tb) * b21 (tb) * t1 (tb)
           - b63 (tb) * (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb))
           - b64 (tb) * (b41 (tb) * t1 (tb) + b42 (tb) * t2 (tb)
                         + b43 (tb) * t3 (tb))) / b65 (tb) - b54 (tb) * t4 (tb);
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
-  D[1] = (1.L / 12.L - b62 (tb) * b21 (tb) * sqr (t1 (tb))
+  D[1] = (REAL (1.) / REAL (12.) - b62 (tb) * b21 (tb) * sqr (t1 (tb))
           - b63 (tb) * (b31 (tb) * sqr (t1 (tb)) + b32 (tb) * sqr (t2 (tb)))
           - b64 (tb) * (b41 (tb) * sqr (t1 (tb)) + b42 (tb) * sqr (t2 (tb))
                         + b43 (tb) * sqr (t3 (tb)))) / b65 (tb)
     - b54 (tb) * sqr (t4 (tb));
-  A[2] = 0.L;
+  A[2] = REAL (0.);
   B[2] = b21 (tb) * t1 (tb);
   C[2] = b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb);
-  D[2] = (1.L / 24.L - b63 (tb) * b32 (tb) * b21 (tb) * t1 (tb)
+  D[2] = (REAL (1.) / REAL (24.) - b63 (tb) * b32 (tb) * b21 (tb) * t1 (tb)
           - b64 (tb) * (b42 (tb) * b21 (tb) * t1 (tb)
                         + b43 (tb) * (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb))))
     / b65 (tb) - b54 (tb) * (b41 (tb) * t1 (tb) + b42 (tb) * t2 (tb)
@@ -354,15 +353,15 @@ rk_tb_6_4p (Optimize * optimize)        ///< Optimize struct.
 int
 rk_tb_6_4tp (Optimize * optimize)       ///< Optimize struct.
 {
-  long double A[5], B[5], C[5], D[5], E[5], F[5], AA[4], BB[4], CC[4], DD[4],
+  Real A[5], B[5], C[5], D[5], E[5], F[5], AA[4], BB[4], CC[4], DD[4],
     EE[4];
-  long double *tb, *r;
+  Real *tb, *r;
 #if DEBUG_RK_6_4
   fprintf (stderr, "rk_tb_6_4tp: start\n");
 #endif
   tb = optimize->coefficient;
   r = optimize->random_data;
-  t6 (tb) = 1.L;
+  t6 (tb) = REAL (1.);
   t1 (tb) = r[0];
   t2 (tb) = r[1];
   t3 (tb) = r[2];
@@ -380,31 +379,31 @@ rk_tb_6_4tp (Optimize * optimize)       ///< Optimize struct.
   C[0] = CC[0] = t3 (tb);
   D[0] = DD[0] = t4 (tb);
   E[0] = t5 (tb);
-  F[0] = EE[0] = 0.5L;
+  F[0] = EE[0] = REAL (0.5);
   A[1] = AA[1] = A[0] * t1 (tb);
   B[1] = BB[1] = B[0] * t2 (tb);
   C[1] = CC[1] = C[0] * t3 (tb);
   D[1] = DD[1] = D[0] * t4 (tb);
   E[1] = E[0] * t5 (tb);
-  F[1] = EE[1] = 1.L / 3.L;
+  F[1] = EE[1] = REAL (1.) / REAL (3.);
   A[2] = AA[2] = A[1] * t1 (tb);
   B[2] = BB[2] = B[1] * t2 (tb);
   C[2] = CC[2] = C[1] * t3 (tb);
   D[2] = DD[2] = D[1] * t4 (tb);
   E[2] = E[1] * t5 (tb);
-  F[2] = EE[2] = 0.25L;
+  F[2] = EE[2] = REAL (0.25);
   A[3] = AA[3] = A[2] * t1 (tb);
   B[3] = BB[3] = B[2] * t2 (tb);
   C[3] = CC[3] = C[2] * t3 (tb);
   D[3] = DD[3] = D[2] * t4 (tb);
   E[3] = E[2] * t5 (tb);
-  F[3] = EE[3] = 0.2L;
+  F[3] = EE[3] = REAL (0.2);
   A[4] = A[3] * t1 (tb);
   B[4] = B[3] * t2 (tb);
   C[4] = C[3] * t3 (tb);
   D[4] = D[3] * t4 (tb);
   E[4] = E[3] * t5 (tb);
-  F[4] = 1.L / 6.L;
+  F[4] = REAL (1.) / REAL (6.);
   solve_4 (AA, BB, CC, DD, EE);
   if (isnan (EE[0]) || isnan (EE[1]) || isnan (EE[2]) || isnan (EE[3]))
     return 0;
@@ -421,7 +420,8 @@ rk_tb_6_4tp (Optimize * optimize)       ///< Optimize struct.
   b63 (tb) = F[2];
   b62 (tb) = F[1];
   b61 (tb) = F[0];
-  b21 (tb) = (1.L / 6.L - e63 (tb) * (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb))
+  b21 (tb) = (REAL (1.) / REAL (6.)
+              - e63 (tb) * (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb))
               - e64 (tb) * (b41 (tb) * t1 (tb) + b42 (tb) * t2 (tb)
                             + b43 (tb) * t3 (tb))) / (e62 (tb) * t1 (tb));
   if (isnan (b21 (tb)))
@@ -429,22 +429,22 @@ rk_tb_6_4tp (Optimize * optimize)       ///< Optimize struct.
   A[0] = t1 (tb);
   B[0] = t2 (tb);
   C[0] = t3 (tb);
-  D[0] = (1.L / 6.L - b62 (tb) * b21 (tb) * t1 (tb)
+  D[0] = (REAL (1.) / REAL (6.) - b62 (tb) * b21 (tb) * t1 (tb)
           - b63 (tb) * (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb))
           - b64 (tb) * (b41 (tb) * t1 (tb) + b42 (tb) * t2 (tb)
                         + b43 (tb) * t3 (tb))) / b65 (tb) - b54 (tb) * t4 (tb);
   A[1] = A[0] * t1 (tb);
   B[1] = B[0] * t2 (tb);
   C[1] = C[0] * t3 (tb);
-  D[1] = (1.L / 12.L - b62 (tb) * b21 (tb) * sqr (t1 (tb))
+  D[1] = (REAL (1.) / REAL (12.) - b62 (tb) * b21 (tb) * sqr (t1 (tb))
           - b63 (tb) * (b31 (tb) * sqr (t1 (tb)) + b32 (tb) * sqr (t2 (tb)))
           - b64 (tb) * (b41 (tb) * sqr (t1 (tb)) + b42 (tb) * sqr (t2 (tb))
                         + b43 (tb) * sqr (t3 (tb)))) / b65 (tb)
     - b54 (tb) * sqr (t4 (tb));
-  A[2] = 0.L;
+  A[2] = REAL (0.);
   B[2] = b21 (tb) * t1 (tb);
   C[2] = b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb);
-  D[2] = (1.L / 24.L - b63 (tb) * b32 (tb) * b21 (tb) * t1 (tb)
+  D[2] = (REAL (1.) / REAL (24.) - b63 (tb) * b32 (tb) * b21 (tb) * t1 (tb)
           - b64 (tb) * (b42 (tb) * b21 (tb) * t1 (tb)
                         + b43 (tb) * (b31 (tb) * t1 (tb) + b32 (tb) * t2 (tb))))
     / b65 (tb) - b54 (tb) * (b41 (tb) * t1 (tb) + b42 (tb) * t2 (tb)
@@ -469,56 +469,56 @@ rk_tb_6_4tp (Optimize * optimize)       ///< Optimize struct.
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_6_4 (RK * rk)   ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_6_4
   fprintf (stderr, "rk_objective_tb_6_4: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b51 (tb) < 0.L)
+  if (b51 (tb) < REAL (0.))
     o += b51 (tb);
-  if (b52 (tb) < 0.L)
+  if (b52 (tb) < REAL (0.))
     o += b52 (tb);
-  if (b53 (tb) < 0.L)
+  if (b53 (tb) < REAL (0.))
     o += b53 (tb);
-  if (b60 (tb) < 0.L)
+  if (b60 (tb) < REAL (0.))
     o += b60 (tb);
-  if (b61 (tb) < 0.L)
+  if (b61 (tb) < REAL (0.))
     o += b61 (tb);
-  if (b62 (tb) < 0.L)
+  if (b62 (tb) < REAL (0.))
     o += b62 (tb);
-  if (b63 (tb) < 0.L)
+  if (b63 (tb) < REAL (0.))
     o += b63 (tb);
-  if (b64 (tb) < 0.L)
+  if (b64 (tb) < REAL (0.))
     o += b64 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L,
-             fmaxl (t1 (tb),
-                    fmaxl (t2 (tb),
-                           fmaxl (t3 (tb), fmaxl (t4 (tb), t5 (tb))))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb),
+                    fmaxr (t2 (tb),
+                           fmaxr (t3 (tb), fmaxr (t4 (tb), t5 (tb))))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_6_4
-  fprintf (stderr, "rk_objective_tb_6_4: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_6_4: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_6_4: end\n");
 #endif
   return o;
@@ -530,11 +530,11 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_6_4t (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_6_4
   fprintf (stderr, "rk_objective_tb_6_4t: start\n");
 #endif
@@ -542,49 +542,49 @@ rk_objective_tb_6_4t (RK * rk)  ///< RK struct.
 #if DEBUG_RK_6_4
   rk_print_tb (optimize, "rk_objective_tb_6_4t", stderr);
 #endif
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b51 (tb) < 0.L)
+  if (b51 (tb) < REAL (0.))
     o += b51 (tb);
-  if (b52 (tb) < 0.L)
+  if (b52 (tb) < REAL (0.))
     o += b52 (tb);
-  if (b53 (tb) < 0.L)
+  if (b53 (tb) < REAL (0.))
     o += b53 (tb);
-  if (b60 (tb) < 0.L)
+  if (b60 (tb) < REAL (0.))
     o += b60 (tb);
-  if (b61 (tb) < 0.L)
+  if (b61 (tb) < REAL (0.))
     o += b61 (tb);
-  if (b62 (tb) < 0.L)
+  if (b62 (tb) < REAL (0.))
     o += b62 (tb);
-  if (b63 (tb) < 0.L)
+  if (b63 (tb) < REAL (0.))
     o += b63 (tb);
-  if (b64 (tb) < 0.L)
+  if (b64 (tb) < REAL (0.))
     o += b64 (tb);
-  if (b65 (tb) < 0.L)
+  if (b65 (tb) < REAL (0.))
     o += b65 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L,
-             fmaxl (t1 (tb),
-                    fmaxl (t2 (tb),
-                           fmaxl (t3 (tb), fmaxl (t4 (tb), t5 (tb))))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb),
+                    fmaxr (t2 (tb),
+                           fmaxr (t3 (tb), fmaxr (t4 (tb), t5 (tb))))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_6_4
-  fprintf (stderr, "rk_objective_tb_6_4t: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_6_4t: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_6_4t: end\n");
 #endif
   return o;
@@ -596,66 +596,66 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_6_4p (RK * rk)  ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_6_4
   fprintf (stderr, "rk_objective_tb_6_4p: start\n");
 #endif
   tb = rk->tb->coefficient;
-  o = fminl (0.L, b20 (tb));
-  if (b30 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b51 (tb) < 0.L)
+  if (b51 (tb) < REAL (0.))
     o += b51 (tb);
-  if (b52 (tb) < 0.L)
+  if (b52 (tb) < REAL (0.))
     o += b52 (tb);
-  if (b53 (tb) < 0.L)
+  if (b53 (tb) < REAL (0.))
     o += b53 (tb);
-  if (b60 (tb) < 0.L)
+  if (b60 (tb) < REAL (0.))
     o += b60 (tb);
-  if (b61 (tb) < 0.L)
+  if (b61 (tb) < REAL (0.))
     o += b61 (tb);
-  if (b62 (tb) < 0.L)
+  if (b62 (tb) < REAL (0.))
     o += b62 (tb);
-  if (b63 (tb) < 0.L)
+  if (b63 (tb) < REAL (0.))
     o += b63 (tb);
-  if (b64 (tb) < 0.L)
+  if (b64 (tb) < REAL (0.))
     o += b64 (tb);
-  if (e60 (tb) < 0.L)
+  if (e60 (tb) < REAL (0.))
     o += e60 (tb);
-  if (e61 (tb) < 0.L)
+  if (e61 (tb) < REAL (0.))
     o += e61 (tb);
-  if (e62 (tb) < 0.L)
+  if (e62 (tb) < REAL (0.))
     o += e62 (tb);
-  if (e63 (tb) < 0.L)
+  if (e63 (tb) < REAL (0.))
     o += e63 (tb);
-  if (e64 (tb) < 0.L)
+  if (e64 (tb) < REAL (0.))
     o += e64 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L,
-             fmaxl (t1 (tb),
-                    fmaxl (t2 (tb),
-                           fmaxl (t3 (tb), fmaxl (t4 (tb), t5 (tb))))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb),
+                    fmaxr (t2 (tb),
+                           fmaxr (t3 (tb), fmaxr (t4 (tb), t5 (tb))))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_6_4
-  fprintf (stderr, "rk_objective_tb_6_4p: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_6_4p: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_6_4p: end\n");
 #endif
   return o;
@@ -667,11 +667,11 @@ end:
  *
  * \return objective function value.
  */
-long double
+Real
 rk_objective_tb_6_4tp (RK * rk) ///< RK struct.
 {
-  long double *tb;
-  long double o;
+  Real *tb;
+  Real o;
 #if DEBUG_RK_6_4
   fprintf (stderr, "rk_objective_tb_6_4tp: start\n");
 #endif
@@ -679,62 +679,229 @@ rk_objective_tb_6_4tp (RK * rk) ///< RK struct.
 #if DEBUG_RK_6_4
   rk_print_tb (optimize, "rk_objective_tb_6_4tp", stderr);
 #endif
-  o = fminl (0.L, b20 (tb));
-  if (b21 (tb) < 0.L)
+  o = fminr (REAL (0.), b20 (tb));
+  if (b21 (tb) < REAL (0.))
     o += b21 (tb);
-  if (b30 (tb) < 0.L)
+  if (b30 (tb) < REAL (0.))
     o += b30 (tb);
-  if (b40 (tb) < 0.L)
+  if (b40 (tb) < REAL (0.))
     o += b40 (tb);
-  if (b50 (tb) < 0.L)
+  if (b50 (tb) < REAL (0.))
     o += b50 (tb);
-  if (b51 (tb) < 0.L)
+  if (b51 (tb) < REAL (0.))
     o += b51 (tb);
-  if (b52 (tb) < 0.L)
+  if (b52 (tb) < REAL (0.))
     o += b52 (tb);
-  if (b53 (tb) < 0.L)
+  if (b53 (tb) < REAL (0.))
     o += b53 (tb);
-  if (b60 (tb) < 0.L)
+  if (b60 (tb) < REAL (0.))
     o += b60 (tb);
-  if (b61 (tb) < 0.L)
+  if (b61 (tb) < REAL (0.))
     o += b61 (tb);
-  if (b62 (tb) < 0.L)
+  if (b62 (tb) < REAL (0.))
     o += b62 (tb);
-  if (b63 (tb) < 0.L)
+  if (b63 (tb) < REAL (0.))
     o += b63 (tb);
-  if (b64 (tb) < 0.L)
+  if (b64 (tb) < REAL (0.))
     o += b64 (tb);
-  if (b65 (tb) < 0.L)
+  if (b65 (tb) < REAL (0.))
     o += b65 (tb);
-  if (e60 (tb) < 0.L)
+  if (e60 (tb) < REAL (0.))
     o += e60 (tb);
-  if (e61 (tb) < 0.L)
+  if (e61 (tb) < REAL (0.))
     o += e61 (tb);
-  if (e62 (tb) < 0.L)
+  if (e62 (tb) < REAL (0.))
     o += e62 (tb);
-  if (e63 (tb) < 0.L)
+  if (e63 (tb) < REAL (0.))
     o += e63 (tb);
-  if (e64 (tb) < 0.L)
+  if (e64 (tb) < REAL (0.))
     o += e64 (tb);
-  if (o < 0.L)
+  if (o < REAL (0.))
     {
-      o = 40.L - o;
+      o = REAL (40.) - o;
       goto end;
     }
-  o = 30.L
-    + fmaxl (1.L,
-             fmaxl (t1 (tb),
-                    fmaxl (t2 (tb),
-                           fmaxl (t3 (tb), fmaxl (t4 (tb), t5 (tb))))));
+  o = REAL (30.)
+    + fmaxr (REAL (1.),
+             fmaxr (t1 (tb),
+                    fmaxr (t2 (tb),
+                           fmaxr (t3 (tb), fmaxr (t4 (tb), t5 (tb))))));
   if (rk->strong)
     {
       rk_bucle_ac (rk);
-      o = fminl (o, *rk->ac0->optimal);
+      o = fminr (o, rk->ac_optimal);
     }
 end:
 #if DEBUG_RK_6_4
-  fprintf (stderr, "rk_objective_tb_6_4tp: optimal=%Lg\n", o);
+  fprintf (stderr, "rk_objective_tb_6_4tp: optimal=" REAL_G "\n", real_g (o));
   fprintf (stderr, "rk_objective_tb_6_4tp: end\n");
 #endif
   return o;
 }
+
+/**
+ * Function to obtain the coefficients and the objective function values of a
+ * batch of 6 steps 4th order Runge-Kutta methods without strong stability.
+ * The lanes without solution get an infinite objective function value.
+ */
+void
+rk_batch_tb_6_4 (Optimize * optimize)   ///< Optimize struct.
+{
+  double M[5 * 4 * OPTIMIZE_BATCH];
+  double *tb, *r, *o, *A, *B, *C, *D, *E;
+  double k;
+  unsigned int l;
+#if DEBUG_RK_6_4
+  fprintf (stderr, "rk_batch_tb_6_4: start\n");
+#endif
+  r = optimize->batch_data;
+  tb = r + OPTIMIZE_BATCH * optimize->nfree;
+  o = tb + OPTIMIZE_BATCH * optimize->size;
+  A = M;
+  B = A + 4 * OPTIMIZE_BATCH;
+  C = B + 4 * OPTIMIZE_BATCH;
+  D = C + 4 * OPTIMIZE_BATCH;
+  E = D + 4 * OPTIMIZE_BATCH;
+  for (l = 0; l < OPTIMIZE_BATCH; ++l)
+    {
+      rk_lane (t6, tb, l) = 1.;
+      rk_lane (t1, tb, l) = r[l];
+      rk_lane (t2, tb, l) = r[OPTIMIZE_BATCH + l];
+      rk_lane (b21, tb, l) = r[2 * OPTIMIZE_BATCH + l];
+      rk_lane (t3, tb, l) = r[3 * OPTIMIZE_BATCH + l];
+      rk_lane (b31, tb, l) = r[4 * OPTIMIZE_BATCH + l];
+      rk_lane (b32, tb, l) = r[5 * OPTIMIZE_BATCH + l];
+      rk_lane (t4, tb, l) = r[6 * OPTIMIZE_BATCH + l];
+      rk_lane (b41, tb, l) = r[7 * OPTIMIZE_BATCH + l];
+      rk_lane (b42, tb, l) = r[8 * OPTIMIZE_BATCH + l];
+      rk_lane (b43, tb, l) = r[9 * OPTIMIZE_BATCH + l];
+      rk_lane (t5, tb, l) = r[10 * OPTIMIZE_BATCH + l];
+      rk_lane (b54, tb, l) = r[11 * OPTIMIZE_BATCH + l];
+      rk_lane (b65, tb, l) = r[12 * OPTIMIZE_BATCH + l];
+      A[l] = rk_lane (t1, tb, l);
+      B[l] = rk_lane (t2, tb, l);
+      C[l] = rk_lane (t3, tb, l);
+      D[l] = rk_lane (t4, tb, l);
+      E[l] = 0.5 - rk_lane (b65, tb, l) * rk_lane (t5, tb, l);
+      A[OPTIMIZE_BATCH + l] = A[l] * rk_lane (t1, tb, l);
+      B[OPTIMIZE_BATCH + l] = B[l] * rk_lane (t2, tb, l);
+      C[OPTIMIZE_BATCH + l] = C[l] * rk_lane (t3, tb, l);
+      D[OPTIMIZE_BATCH + l] = D[l] * rk_lane (t4, tb, l);
+      E[OPTIMIZE_BATCH + l] = 1. / 3.
+        - rk_lane (b65, tb, l) * rk_lane (t5, tb, l) * rk_lane (t5, tb, l);
+      A[2 * OPTIMIZE_BATCH + l] = A[OPTIMIZE_BATCH + l] * rk_lane (t1, tb, l);
+      B[2 * OPTIMIZE_BATCH + l] = B[OPTIMIZE_BATCH + l] * rk_lane (t2, tb, l);
+      C[2 * OPTIMIZE_BATCH + l] = C[OPTIMIZE_BATCH + l] * rk_lane (t3, tb, l);
+      D[2 * OPTIMIZE_BATCH + l] = D[OPTIMIZE_BATCH + l] * rk_lane (t4, tb, l);
+      E[2 * OPTIMIZE_BATCH + l] = 0.25 - rk_lane (b65, tb, l)
+        * rk_lane (t5, tb, l) * rk_lane (t5, tb, l) * rk_lane (t5, tb, l);
+      A[3 * OPTIMIZE_BATCH + l] = 0.;
+      B[3 * OPTIMIZE_BATCH + l] = rk_lane (b21, tb, l) * rk_lane (t1, tb, l)
+        * (rk_lane (t2, tb, l) - rk_lane (t5, tb, l));
+      C[3 * OPTIMIZE_BATCH + l] = (rk_lane (b31, tb, l) * rk_lane (t1, tb, l)
+                                   + rk_lane (b32, tb, l) * rk_lane (t2, tb, l))
+        * (rk_lane (t3, tb, l) - rk_lane (t5, tb, l));
+      D[3 * OPTIMIZE_BATCH + l] = (rk_lane (b41, tb, l) * rk_lane (t1, tb, l)
+                                   + rk_lane (b42, tb, l) * rk_lane (t2, tb, l)
+                                   + rk_lane (b43, tb, l) * rk_lane (t3, tb, l))
+        * (rk_lane (t4, tb, l) - rk_lane (t5, tb, l));
+      E[3 * OPTIMIZE_BATCH + l] = 0.125 - 1. / 6. * rk_lane (t5, tb, l);
+    }
+  solve_batch (M, 4);
+
+  // the second system is stored in the first 4 * 3 * OPTIMIZE_BATCH values of
+  // M, keeping the solutions of the first system in the E column
+  E = M + 4 * 4 * OPTIMIZE_BATCH;
+  B = A + 3 * OPTIMIZE_BATCH;
+  C = B + 3 * OPTIMIZE_BATCH;
+  D = C + 3 * OPTIMIZE_BATCH;
+  for (l = 0; l < OPTIMIZE_BATCH; ++l)
+    {
+      rk_lane (b64, tb, l) = E[3 * OPTIMIZE_BATCH + l];
+      rk_lane (b63, tb, l) = E[2 * OPTIMIZE_BATCH + l];
+      rk_lane (b62, tb, l) = E[OPTIMIZE_BATCH + l];
+      rk_lane (b61, tb, l) = E[l];
+      A[l] = rk_lane (t1, tb, l);
+      B[l] = rk_lane (t2, tb, l);
+      C[l] = rk_lane (t3, tb, l);
+      D[l] = (1. / 6.
+              - rk_lane (b62, tb, l) * rk_lane (b21, tb, l)
+              * rk_lane (t1, tb, l)
+              - rk_lane (b63, tb, l)
+              * (rk_lane (b31, tb, l) * rk_lane (t1, tb, l)
+                 + rk_lane (b32, tb, l) * rk_lane (t2, tb, l))
+              - rk_lane (b64, tb, l)
+              * (rk_lane (b41, tb, l) * rk_lane (t1, tb, l)
+                 + rk_lane (b42, tb, l) * rk_lane (t2, tb, l)
+                 + rk_lane (b43, tb, l) * rk_lane (t3, tb, l)))
+        / rk_lane (b65, tb, l) - rk_lane (b54, tb, l) * rk_lane (t4, tb, l);
+      A[OPTIMIZE_BATCH + l] = A[l] * rk_lane (t1, tb, l);
+      B[OPTIMIZE_BATCH + l] = B[l] * rk_lane (t2, tb, l);
+      C[OPTIMIZE_BATCH + l] = C[l] * rk_lane (t3, tb, l);
+      D[OPTIMIZE_BATCH + l] = (1. / 12.
+                               - rk_lane (b62, tb, l) * rk_lane (b21, tb, l)
+                               * rk_lane (t1, tb, l) * rk_lane (t1, tb, l)
+                               - rk_lane (b63, tb, l)
+                               * (rk_lane (b31, tb, l) * rk_lane (t1, tb, l)
+                                  * rk_lane (t1, tb, l)
+                                  + rk_lane (b32, tb, l) * rk_lane (t2, tb, l)
+                                  * rk_lane (t2, tb, l))
+                               - rk_lane (b64, tb, l)
+                               * (rk_lane (b41, tb, l) * rk_lane (t1, tb, l)
+                                  * rk_lane (t1, tb, l)
+                                  + rk_lane (b42, tb, l) * rk_lane (t2, tb, l)
+                                  * rk_lane (t2, tb, l)
+                                  + rk_lane (b43, tb, l) * rk_lane (t3, tb, l)
+                                  * rk_lane (t3, tb, l)))
+        / rk_lane (b65, tb, l)
+        - rk_lane (b54, tb, l) * rk_lane (t4, tb, l) * rk_lane (t4, tb, l);
+      A[2 * OPTIMIZE_BATCH + l] = 0.;
+      B[2 * OPTIMIZE_BATCH + l] = rk_lane (b21, tb, l) * rk_lane (t1, tb, l);
+      C[2 * OPTIMIZE_BATCH + l] = rk_lane (b31, tb, l) * rk_lane (t1, tb, l)
+        + rk_lane (b32, tb, l) * rk_lane (t2, tb, l);
+      D[2 * OPTIMIZE_BATCH + l] = (1. / 24.
+                                   - rk_lane (b63, tb, l) * rk_lane (b32, tb, l)
+                                   * rk_lane (b21, tb, l) * rk_lane (t1, tb, l)
+                                   - rk_lane (b64, tb, l)
+                                   * (rk_lane (b42, tb, l)
+                                      * rk_lane (b21, tb, l)
+                                      * rk_lane (t1, tb, l)
+                                      + rk_lane (b43, tb, l)
+                                      * (rk_lane (b31, tb, l)
+                                         * rk_lane (t1, tb, l)
+                                         + rk_lane (b32, tb, l)
+                                         * rk_lane (t2, tb, l))))
+        / rk_lane (b65, tb, l)
+        - rk_lane (b54, tb, l) * (rk_lane (b41, tb, l) * rk_lane (t1, tb, l)
+                                  + rk_lane (b42, tb, l) * rk_lane (t2, tb, l)
+                                  + rk_lane (b43, tb, l) * rk_lane (t3, tb, l));
+    }
+  solve_batch (M, 3);
+  for (l = 0; l < OPTIMIZE_BATCH; ++l)
+    {
+      rk_lane (b53, tb, l) = D[2 * OPTIMIZE_BATCH + l];
+      rk_lane (b52, tb, l) = D[OPTIMIZE_BATCH + l];
+      rk_lane (b51, tb, l) = D[l];
+      rk_batch_b_6 (tb, l);
+      k = fmin (0., rk_lane (b20, tb, l)) + fmin (0., rk_lane (b30, tb, l))
+        + fmin (0., rk_lane (b40, tb, l)) + fmin (0., rk_lane (b50, tb, l))
+        + fmin (0., rk_lane (b51, tb, l)) + fmin (0., rk_lane (b52, tb, l))
+        + fmin (0., rk_lane (b53, tb, l)) + fmin (0., rk_lane (b60, tb, l))
+        + fmin (0., rk_lane (b61, tb, l)) + fmin (0., rk_lane (b62, tb, l))
+        + fmin (0., rk_lane (b63, tb, l)) + fmin (0., rk_lane (b64, tb, l));
+      o[l] = (k < 0.) ? 40. - k
+        : 30. + fmax (1., fmax (rk_lane (t1, tb, l),
+                                fmax (rk_lane (t2, tb, l),
+                                      fmax (rk_lane (t3, tb, l),
+                                            fmax (rk_lane (t4, tb, l),
+                                                  rk_lane (t5, tb, l))))));
+      o[l] = (isnan (E[l]) || isnan (E[OPTIMIZE_BATCH + l])
+              || isnan (E[2 * OPTIMIZE_BATCH + l])
+              || isnan (E[3 * OPTIMIZE_BATCH + l]) || isnan (D[l])
+              || isnan (D[OPTIMIZE_BATCH + l])
+              || isnan (D[2 * OPTIMIZE_BATCH + l])) ? INFINITY : o[l];
+    }
+#if DEBUG_RK_6_4
+  fprintf (stderr, "rk_batch_tb_6_4: end\n");
+#endif
+}
@@ -38,9 +38,10 @@ int rk_tb_6_4 (Optimize * optimize);
 int rk_tb_6_4t (Optimize * optimize);
 int rk_tb_6_4p (Optimize * optimize);
 int rk_tb_6_4tp (Optimize * optimize);
-long double rk_objective_tb_6_4 (RK * rk);
-long double rk_objective_tb_6_4t (RK * rk);
-long double rk_objective_tb_6_4p (RK * rk);
-long double rk_objective_tb_6_4tp (RK * rk);
+Real rk_objective_tb_6_4 (RK * rk);
+Real rk_objective_tb_6_4t (RK * rk);
+Real rk_objective_tb_6_4p (RK * rk);
+Real rk_objective_tb_6_4tp (RK * rk);
+void rk_batch_tb_6_4 (Optimize * optimize);
 
 #endif
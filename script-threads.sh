@@ -0,0 +1,19 @@
+# compare the results of two runs of the multi-steps tests with 4 threads, the
+# optional arguments are added to the command line (e.g. -b for the batched
+# mode). The Runge-Kutta threads share the optimal values while climbing, so
+# their results depend on the timing of the threads and they are not compared
+code=0
+for i in tests/test-steps-*.xml; do
+	j=`basename $i .xml`
+	j=${j#test-}.mc
+	echo "./ode $@ -t 4 $i"
+	./ode $@ -t 4 $i > /dev/null
+	mv $j $j.1
+	./ode $@ -t 4 $i > /dev/null
+	if ! cmp -s $j $j.1; then
+		echo "Different results on two runs with 4 threads: $i"
+		code=1
+	fi
+	rm -f $j $j.1
+done
+exit $code
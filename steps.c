@@ -36,13 +36,14 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include <math.h>
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #include "config.h"
 #include "utils.h"
+#include "pool.h"
 #include "optimize.h"
 #include "steps.h"
 
@@ -100,32 +101,46 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ///< b12 multi-steps coefficient.
 #define c(a, b) (b / a)
 ///< macro to calculate the c multi-steps coefficients.
-#define c0(x) (c(a0(x), b0(x)))
-///< c0 multi-steps coefficient.
-#define c1(x) (c(a1(x), b1(x)))
-///< c1 multi-steps coefficient.
-#define c2(x) (c(a2(x), b2(x)))
-///< c2 multi-steps coefficient.
-#define c3(x) (c(a3(x), b3(x)))
-///< c3 multi-steps coefficient.
-#define c4(x) (c(a4(x), b4(x)))
-///< c4 multi-steps coefficient.
-#define c5(x) (c(a5(x), b5(x)))
-///< c5 multi-steps coefficient.
-#define c6(x) (c(a6(x), b6(x)))
-///< c6 multi-steps coefficient.
-#define c7(x) (c(a7(x), b7(x)))
-///< c7 multi-steps coefficient.
-#define c8(x) (c(a8(x), b8(x)))
-///< c8 multi-steps coefficient.
-#define c9(x) (c(a9(x), b9(x)))
-///< c9 multi-steps coefficient.
-#define c10(x) (c(a10(x), b10(x)))
-///< c10 multi-steps coefficient.
-#define c11(x) (c(a11(x), b11(x)))
-///< c11 multi-steps coefficient.
-#define c12(x) (c(a11(x), b11(x)))
-///< c12 multi-steps coefficient.
+
+/**
+ * Function to get the size of the affine map of the freedom degrees to the
+ * coefficients of a multi-steps method built by the steps_affine function.
+ *
+ * \return size in bytes.
+ */
+static inline size_t
+steps_data_size (unsigned int size,     ///< number of coefficients.
+                 unsigned int nfree)    ///< number of freedom degrees.
+{
+  return size * (nfree + 1) * (sizeof (Real) + sizeof (double))
+    + nfree * (size + 1) * sizeof (unsigned int);
+}
+
+/**
+ * Function to check the penalty of the negative a coefficients, obtained
+ * directly from the freedom degrees, before solving the order conditions.
+ *
+ * \return 1 if the simulation is rejected by the cut-off, 0 otherwise.
+ */
+static inline int
+steps_reject (Optimize * optimize)      ///< Optimize struct.
+{
+  Real *r;
+  Real v, k;
+  unsigned int i, n;
+  r = optimize->random_data;
+  n = optimize->nsteps - 1;
+  for (i = 0, v = REAL (1.); i < n; ++i)
+    v -= r[i];
+  k = REAL (0.);
+  if (v < -REAL_EPSILON)
+    k += v;
+  for (i = 0; i < n; ++i)
+    if (r[i] < -REAL_EPSILON)
+      k += r[i];
+  return k < -REAL_EPSILON
+    && optimize_reject (optimize, REAL (30.) - k, OPTIMIZE_REJECT_SIGN);
+}
 
 /**
  * Function to get the coefficients on a 3 steps 2nd order multi-steps method.
@@ -133,15 +148,17 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 static int
 steps_3_2 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *x, *r;
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   b2 (x) = r[2];
-  b1 (x) = 0.5L * (a1 (x) + 4.L * (a2 (x) - b2 (x)) - 1.L);
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) - b1 (x) - b2 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x);
+  b1 (x) = REAL (0.5) * (a1 (x) + REAL (4.) * (a2 (x) - b2 (x)) - REAL (1.));
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) - b1 (x) - b2 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x);
   return 1;
 }
 
@@ -151,18 +168,20 @@ steps_3_2 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_3_3 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[2], B[2], C[2];
-  long double *x, *r;
+  Real A[2], B[2], C[2];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = -1.L + a1 (x) + 4.L * a2 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 1.L + a1 (x) + 8.L * a2 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x);
   solve_2 (A, B, C);
   b2 (x) = C[1];
   if (isnan (b2 (x)))
@@ -170,8 +189,8 @@ steps_3_3 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = C[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) - b1 (x) - b2 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) - b1 (x) - b2 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x);
   return 1;
 }
 
@@ -181,20 +200,22 @@ steps_3_3 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_4_2 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *x, *r;
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
   b3 (x) = r[3];
   b2 (x) = r[4];
-  b1 (x) =
-    0.5L * (a1 (x) + 4.L * (a2 (x) - b2 (x)) + 9.L * a3 (x) - 6.L * b3 (x) -
-            1.L);
-  b0 (x) =
-    1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) - b1 (x) - b2 (x) - b3 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x);
+  b1 (x) = REAL (0.5) * (a1 (x) + REAL (4.) * (a2 (x) - b2 (x))
+                         + REAL (9.) * a3 (x) - REAL (6.) * b3 (x)
+                         - REAL (1.));
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    - b1 (x) - b2 (x) - b3 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x);
   return 1;
 }
 
@@ -204,20 +225,24 @@ steps_4_2 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_4_3 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[2], B[2], C[2];
-  long double *x, *r;
+  Real A[2], B[2], C[2];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
   b3 (x) = r[3];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) - 6.L * b3 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * (a3 (x) - b3 (x));
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    - REAL (6.) * b3 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x)
+    + REAL (27.) * (a3 (x) - b3 (x));
   solve_2 (A, B, C);
   b2 (x) = C[1];
   if (isnan (b2 (x)))
@@ -225,9 +250,9 @@ steps_4_3 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = C[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) - b1 (x) - b2 (x)
-    - b3 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    - b1 (x) - b2 (x) - b3 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x);
   return 1;
 }
 
@@ -237,25 +262,27 @@ steps_4_3 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_4_4 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[3], B[3], C[3], D[3];
-  long double *x, *r;
+  Real A[3], B[3], C[3], D[3];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x);
   solve_3 (A, B, C, D);
   b3 (x) = D[2];
   if (isnan (b3 (x)))
@@ -266,9 +293,9 @@ steps_4_4 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = D[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) - b1 (x) - b2 (x)
-    - b3 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    - b1 (x) - b2 (x) - b3 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x);
   return 1;
 }
 
@@ -278,9 +305,11 @@ steps_4_4 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_5_2 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *x, *r;
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -288,11 +317,13 @@ steps_5_2 (Optimize * optimize) ///< Optimize struct.
   b4 (x) = r[4];
   b3 (x) = r[5];
   b2 (x) = r[6];
-  b1 (x) = 0.5L * (a1 (x) + 4.L * (a2 (x) - b2 (x)) + 9.L * a3 (x)
-                   + 16.L * a4 (x) - 6.L * b3 (x) - 8.L * b4 (x) - 1.L);
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x) - b1 (x)
-    - b2 (x) - b3 (x) - b4 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x);
+  b1 (x) = REAL (0.5) * (a1 (x) + REAL (4.) * (a2 (x) - b2 (x))
+                         + REAL (9.) * a3 (x) + REAL (16.) * a4 (x)
+                         - REAL (6.) * b3 (x) - REAL (8.) * b4 (x)
+                         - REAL (1.));
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x);
   return 1;
 }
 
@@ -302,24 +333,27 @@ steps_5_2 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_5_3 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[2], B[2], C[2];
-  long double *x, *r;
+  Real A[2], B[2], C[2];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
   a4 (x) = r[3];
   b4 (x) = r[4];
   b3 (x) = r[5];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    - 6.L * b3 (x) - 8.L * b4 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * (a3 (x) - b3 (x)) + 64.L * a4 (x)
-    - 48.L * b4 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) - REAL (6.) * b3 (x) - REAL (8.) * b4 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x)
+    + REAL (27.) * (a3 (x) - b3 (x)) + REAL (64.) * a4 (x)
+    - REAL (48.) * b4 (x);
   solve_2 (A, B, C);
   b2 (x) = C[1];
   if (isnan (b2 (x)))
@@ -327,9 +361,9 @@ steps_5_3 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = C[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x) - b1 (x)
-    - b2 (x) - b3 (x) - b4 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x);
   return 1;
 }
 
@@ -339,30 +373,32 @@ steps_5_3 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_5_4 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[3], B[3], C[3], D[3];
-  long double *x, *r;
+  Real A[3], B[3], C[3], D[3];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
   a4 (x) = r[3];
   b4 (x) = r[4];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    - 8.L * b4 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    - 48.L * b4 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x)
-    + 256.L * (a4 (x) - b4 (x));
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) - REAL (8.) * b4 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) - REAL (48.) * b4 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * (a4 (x) - b4 (x));
   solve_3 (A, B, C, D);
   b3 (x) = D[2];
   if (isnan (b3 (x)))
@@ -373,9 +409,9 @@ steps_5_4 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = D[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x) - b1 (x)
-    - b2 (x) - b3 (x) - b4 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x);
   return 1;
 }
 
@@ -385,34 +421,40 @@ steps_5_4 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_5_5 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4];
-  long double *x, *r;
+  Real A[4], B[4], C[4], D[4], E[4];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
   a4 (x) = r[3];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x);
   solve_4 (A, B, C, D, E);
   b4 (x) = E[3];
   if (isnan (b4 (x)))
@@ -426,9 +468,9 @@ steps_5_5 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = E[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x) - b1 (x)
-    - b2 (x) - b3 (x) - b4 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x);
   return 1;
 }
 
@@ -438,9 +480,11 @@ steps_5_5 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_6_2 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *x, *r;
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -450,12 +494,15 @@ steps_6_2 (Optimize * optimize) ///< Optimize struct.
   b4 (x) = r[6];
   b3 (x) = r[7];
   b2 (x) = r[8];
-  b1 (x) = 0.5L * (a1 (x) + 4.L * (a2 (x) - b2 (x)) + 9.L * a3 (x)
-                   + 16.L * a4 (x) + 25.L * a5 (x) - 6.L * b3 (x) - 8.L * b4 (x)
-                   - 10.L * b5 (x) - 1.L);
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x);
+  b1 (x) = REAL (0.5) * (a1 (x) + REAL (4.) * (a2 (x) - b2 (x))
+                         + REAL (9.) * a3 (x) + REAL (16.) * a4 (x)
+                         + REAL (25.) * a5 (x) - REAL (6.) * b3 (x)
+                         - REAL (8.) * b4 (x) - REAL (10.) * b5 (x)
+                         - REAL (1.));
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x);
   return 1;
 }
 
@@ -465,10 +512,12 @@ steps_6_2 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_6_3 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[2], B[2], C[2];
-  long double *x, *r;
+  Real A[2], B[2], C[2];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -477,14 +526,16 @@ steps_6_3 (Optimize * optimize) ///< Optimize struct.
   b5 (x) = r[5];
   b4 (x) = r[6];
   b3 (x) = r[7];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x) - 6.L * b3 (x) - 8.L * b4 (x) - 10.L * b5 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * (a3 (x) - b3 (x)) + 64.L * a4 (x)
-    + 125.L * a5 (x) - 48.L * b4 (x) - 75.L * b5 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x) - REAL (6.) * b3 (x)
+    - REAL (8.) * b4 (x) - REAL (10.) * b5 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x)
+    + REAL (27.) * (a3 (x) - b3 (x)) + REAL (64.) * a4 (x)
+    + REAL (125.) * a5 (x) - REAL (48.) * b4 (x) - REAL (75.) * b5 (x);
   solve_2 (A, B, C);
   b2 (x) = C[1];
   if (isnan (b2 (x)))
@@ -492,9 +543,10 @@ steps_6_3 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = C[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x);
   return 1;
 }
 
@@ -504,10 +556,12 @@ steps_6_3 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_6_4 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[3], B[3], C[3], D[3];
-  long double *x, *r;
+  Real A[3], B[3], C[3], D[3];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -515,21 +569,24 @@ steps_6_4 (Optimize * optimize) ///< Optimize struct.
   a5 (x) = r[4];
   b5 (x) = r[5];
   b4 (x) = r[6];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x) - 8.L * b4 (x) - 10.L * b5 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) - 48.L * b4 (x) - 75.L * b5 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x)
-    + 256.L * (a4 (x) - b4 (x)) + 625.L * a5 (x) - 500.L * b5 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x) - REAL (8.) * b4 (x)
+    - REAL (10.) * b5 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) - REAL (48.) * b4 (x)
+    - REAL (75.) * b5 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * (a4 (x) - b4 (x)) + REAL (625.) * a5 (x)
+    - REAL (500.) * b5 (x);
   solve_3 (A, B, C, D);
   b3 (x) = D[2];
   if (isnan (b3 (x)))
@@ -540,9 +597,10 @@ steps_6_4 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = D[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x);
   return 1;
 }
 
@@ -552,40 +610,42 @@ steps_6_4 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_6_5 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4];
-  long double *x, *r;
+  Real A[4], B[4], C[4], D[4], E[4];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
   a4 (x) = r[3];
   a5 (x) = r[4];
   b5 (x) = r[5];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x) - 10.L * b5 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) - 75.L * b5 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) - 500.L * b5 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * (a5 (x) - b5 (x));
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x) - REAL (10.) * b5 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) - REAL (75.) * b5 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) - REAL (500.) * b5 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * (a5 (x) - b5 (x));
   solve_4 (A, B, C, D, E);
   b4 (x) = E[3];
   if (isnan (b4 (x)))
@@ -599,9 +659,10 @@ steps_6_5 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = E[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x);
   return 1;
 }
 
@@ -611,50 +672,52 @@ steps_6_5 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_6_6 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[5], B[5], C[5], D[5], E[5], F[5];
-  long double *x, *r;
+  Real A[5], B[5], C[5], D[5], E[5], F[5];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
   a4 (x) = r[3];
   a5 (x) = r[4];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x);
   solve_5 (A, B, C, D, E, F);
   b5 (x) = F[4];
   if (isnan (b5 (x)))
@@ -671,9 +734,10 @@ steps_6_6 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = F[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x);
   return 1;
 }
 
@@ -683,9 +747,11 @@ steps_6_6 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_7_2 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *x, *r;
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -698,13 +764,15 @@ steps_7_2 (Optimize * optimize) ///< Optimize struct.
   b3 (x) = r[9];
   b2 (x) = r[10];
   b1 (x)
-    = 0.5L * (a1 (x) + 4.L * (a2 (x) - b2 (x)) + 9.L * a3 (x) + 16.L * a4 (x)
-              + 25.L * a5 (x) + 36.L * a6 (x) - 6.L * b3 (x) - 8.L * b4 (x)
-              - 10.L * b5 (x) - 12.L * b6 (x) - 1.L);
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x)
-    - b6 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x);
+    = REAL (0.5) * (a1 (x) + REAL (4.) * (a2 (x) - b2 (x)) + REAL (9.) * a3 (x)
+                    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x)
+                    + REAL (36.) * a6 (x) - REAL (6.) * b3 (x)
+                    - REAL (8.) * b4 (x) - REAL (10.) * b5 (x)
+                    - REAL (12.) * b6 (x) - REAL (1.));
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x) - b1 (x)
+    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x);
   return 1;
 }
 
@@ -714,10 +782,12 @@ steps_7_2 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_7_3 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[2], B[2], C[2];
-  long double *x, *r;
+  Real A[2], B[2], C[2];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -728,16 +798,18 @@ steps_7_3 (Optimize * optimize) ///< Optimize struct.
   b5 (x) = r[7];
   b4 (x) = r[8];
   b3 (x) = r[9];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x) + 36.L * a6 (x) - 6.L * b3 (x) - 8.L * b4 (x)
-    - 10.L * b5 (x) - 12.L * b6 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * (a3 (x) - b3 (x)) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) - 48.L * b4 (x) - 75.L * b5 (x)
-    - 108.L * b6 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x) + REAL (36.) * a6 (x)
+    - REAL (6.) * b3 (x) - REAL (8.) * b4 (x) - REAL (10.) * b5 (x)
+    - REAL (12.) * b6 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x)
+    + REAL (27.) * (a3 (x) - b3 (x)) + REAL (64.) * a4 (x)
+    + REAL (125.) * a5 (x) + REAL (216.) * a6 (x) - REAL (48.) * b4 (x)
+    - REAL (75.) * b5 (x) - REAL (108.) * b6 (x);
   solve_2 (A, B, C);
   b2 (x) = C[1];
   if (isnan (b2 (x)))
@@ -745,10 +817,10 @@ steps_7_3 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = C[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x)
-    - b6 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x) - b1 (x)
+    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x);
   return 1;
 }
 
@@ -758,10 +830,12 @@ steps_7_3 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_7_4 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[3], B[3], C[3], D[3];
-  long double *x, *r;
+  Real A[3], B[3], C[3], D[3];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -771,24 +845,24 @@ steps_7_4 (Optimize * optimize) ///< Optimize struct.
   b6 (x) = r[6];
   b5 (x) = r[7];
   b4 (x) = r[8];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x) + 36.L * a6 (x) - 8.L * b4 (x) - 10.L * b5 (x)
-    - 12.L * b6 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) - 48.L * b4 (x) - 75.L * b5 (x)
-    - 108.L * b6 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x)
-    + 256.L * (a4 (x) - b4 (x)) + 625.L * a5 (x) + 1296.L * a6 (x)
-    - 500.L * b5 (x) - 864.L * b6 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x) + REAL (36.) * a6 (x)
+    - REAL (8.) * b4 (x) - REAL (10.) * b5 (x) - REAL (12.) * b6 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    - REAL (48.) * b4 (x) - REAL (75.) * b5 (x) - REAL (108.) * b6 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * (a4 (x) - b4 (x)) + REAL (625.) * a5 (x)
+    + REAL (1296.) * a6 (x) - REAL (500.) * b5 (x) - REAL (864.) * b6 (x);
   solve_3 (A, B, C, D);
   b3 (x) = D[2];
   if (isnan (b3 (x)))
@@ -799,10 +873,10 @@ steps_7_4 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = D[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x)
-    - b6 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x) - b1 (x)
+    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x);
   return 1;
 }
 
@@ -812,10 +886,12 @@ steps_7_4 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_7_5 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4];
-  long double *x, *r;
+  Real A[4], B[4], C[4], D[4], E[4];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -824,30 +900,34 @@ steps_7_5 (Optimize * optimize) ///< Optimize struct.
   a6 (x) = r[5];
   b6 (x) = r[6];
   b5 (x) = r[7];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x) + 36.L * a6 (x) - 10.L * b5 (x) - 12.L * b6 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) - 75.L * b5 (x) - 108.L * b6 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) - 500.L * b5 (x) - 864.L * b6 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * (a5 (x) - b5 (x)) + 7776.L * a6 (x) - 6480.L * b6 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x) + REAL (36.) * a6 (x)
+    - REAL (10.) * b5 (x) - REAL (12.) * b6 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    - REAL (75.) * b5 (x) - REAL (108.) * b6 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    - REAL (500.) * b5 (x) - REAL (864.) * b6 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * (a5 (x) - b5 (x))
+    + REAL (7776.) * a6 (x) - REAL (6480.) * b6 (x);
   solve_4 (A, B, C, D, E);
   b4 (x) = E[3];
   if (isnan (b4 (x)))
@@ -861,10 +941,10 @@ steps_7_5 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = E[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x)
-    - b6 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x) - b1 (x)
+    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x);
   return 1;
 }
 
@@ -874,10 +954,12 @@ steps_7_5 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_7_6 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[5], B[5], C[5], D[5], E[5], F[5];
-  long double *x, *r;
+  Real A[5], B[5], C[5], D[5], E[5], F[5];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -885,41 +967,46 @@ steps_7_6 (Optimize * optimize) ///< Optimize struct.
   a5 (x) = r[4];
   a6 (x) = r[5];
   b6 (x) = r[6];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x) + 36.L * a6 (x) - 12.L * b6 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) - 108.L * b6 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) - 864.L * b6 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) - 6480.L * b6 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * (a6 (x) - b6 (x));
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x) + REAL (36.) * a6 (x)
+    - REAL (12.) * b6 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    - REAL (108.) * b6 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    - REAL (864.) * b6 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    - REAL (6480.) * b6 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x)
+    + REAL (46656.) * (a6 (x) - b6 (x));
   solve_5 (A, B, C, D, E, F);
   b5 (x) = F[4];
   if (isnan (b5 (x)))
@@ -936,10 +1023,10 @@ steps_7_6 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = F[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x)
-    - b6 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x) - b1 (x)
+    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x);
   return 1;
 }
 
@@ -949,64 +1036,67 @@ steps_7_6 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_7_7 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[6], B[6], C[6], D[6], E[6], F[6], G[6];
-  long double *x, *r;
+  Real A[6], B[6], C[6], D[6], E[6], F[6], G[6];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
   a4 (x) = r[3];
   a5 (x) = r[4];
   a6 (x) = r[5];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = 12.L;
-  G[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x) + 36.L * a6 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 108.L;
-  G[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = 864.L;
-  G[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 6480.L;
-  G[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = 46656.L;
-  G[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * a6 (x);
-  A[5] = 7.L;
-  B[5] = 448.L;
-  C[5] = 5103.L;
-  D[5] = 28672.L;
-  E[5] = 109375.L;
-  F[5] = 326592.L;
-  G[5] = 1.L + a1 (x) + 128.L * a2 (x) + 2187.L * a3 (x) + 16384.L * a4 (x)
-    + 78125.L * a5 (x) + 279936.L * a6 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = REAL (12.);
+  G[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x) + REAL (36.) * a6 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (108.);
+  G[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = REAL (864.);
+  G[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (6480.);
+  G[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = REAL (46656.);
+  G[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x) + REAL (46656.) * a6 (x);
+  A[5] = REAL (7.);
+  B[5] = REAL (448.);
+  C[5] = REAL (5103.);
+  D[5] = REAL (28672.);
+  E[5] = REAL (109375.);
+  F[5] = REAL (326592.);
+  G[5] = REAL (1.) + a1 (x) + REAL (128.) * a2 (x) + REAL (2187.) * a3 (x)
+    + REAL (16384.) * a4 (x) + REAL (78125.) * a5 (x)
+    + REAL (279936.) * a6 (x);
   solve_6 (A, B, C, D, E, F, G);
   b6 (x) = G[5];
   if (isnan (b6 (x)))
@@ -1026,10 +1116,10 @@ steps_7_7 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = G[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x)
-    - b6 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x) - b1 (x)
+    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x);
   return 1;
 }
 
@@ -1039,9 +1129,11 @@ steps_7_7 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_8_2 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *x, *r;
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -1056,14 +1148,18 @@ steps_8_2 (Optimize * optimize) ///< Optimize struct.
   b3 (x) = r[11];
   b2 (x) = r[12];
   b1 (x)
-    = 0.5L * (a1 (x) + 4.L * (a2 (x) - b2 (x)) + 9.L * a3 (x) + 16.L * a4 (x)
-              + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) - 6.L * b3 (x)
-              - 8.L * b4 (x) - 10.L * b5 (x) - 12.L * b6 (x) - 14.L * b7 (x)
-              - 1.L);
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) - b1 (x) - b2 (x) - b3 (x)
-    - b4 (x) - b5 (x) - b6 (x) - b7 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x);
+    = REAL (0.5) * (a1 (x) + REAL (4.) * (a2 (x) - b2 (x)) + REAL (9.) * a3 (x)
+                    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x)
+                    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x)
+                    - REAL (6.) * b3 (x) - REAL (8.) * b4 (x)
+                    - REAL (10.) * b5 (x) - REAL (12.) * b6 (x)
+                    - REAL (14.) * b7 (x) - REAL (1.));
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x)
+    - b7 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x);
   return 1;
 }
 
@@ -1073,10 +1169,12 @@ steps_8_2 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_8_3 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[2], B[2], C[2];
-  long double *x, *r;
+  Real A[2], B[2], C[2];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -1089,16 +1187,19 @@ steps_8_3 (Optimize * optimize) ///< Optimize struct.
   b5 (x) = r[9];
   b4 (x) = r[10];
   b3 (x) = r[11];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) - 6.L * b3 (x)
-    - 8.L * b4 (x) - 10.L * b5 (x) - 12.L * b6 (x) - 14.L * b7 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * (a3 (x) - b3 (x)) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) - 48.L * b4 (x)
-    - 75.L * b5 (x) - 108.L * b6 (x) - 147.L * b7 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x) + REAL (36.) * a6 (x)
+    + REAL (49.) * a7 (x) - REAL (6.) * b3 (x) - REAL (8.) * b4 (x)
+    - REAL (10.) * b5 (x) - REAL (12.) * b6 (x) - REAL (14.) * b7 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x)
+    + REAL (27.) * (a3 (x) - b3 (x)) + REAL (64.) * a4 (x)
+    + REAL (125.) * a5 (x) + REAL (216.) * a6 (x) + REAL (343.) * a7 (x)
+    - REAL (48.) * b4 (x) - REAL (75.) * b5 (x) - REAL (108.) * b6 (x)
+    - REAL (147.) * b7 (x);
   solve_2 (A, B, C);
   b2 (x) = C[1];
   if (isnan (b2 (x)))
@@ -1106,10 +1207,12 @@ steps_8_3 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = C[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) - b1 (x) - b2 (x) - b3 (x)
-    - b4 (x) - b5 (x) - b6 (x) - b7 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x)
+    - b7 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x);
   return 1;
 }
 
@@ -1119,10 +1222,12 @@ steps_8_3 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_8_4 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[3], B[3], C[3], D[3];
-  long double *x, *r;
+  Real A[3], B[3], C[3], D[3];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -1134,24 +1239,27 @@ steps_8_4 (Optimize * optimize) ///< Optimize struct.
   b6 (x) = r[8];
   b5 (x) = r[9];
   b4 (x) = r[10];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) - 8.L * b4 (x)
-    - 10.L * b5 (x) - 12.L * b6 (x) - 14.L * b7 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) - 48.L * b4 (x)
-    - 75.L * b5 (x) - 108.L * b6 (x) - 147.L * b7 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x)
-    + 256.L * (a4 (x) - b4 (x)) + 625.L * a5 (x) + 1296.L * a6 (x)
-    + 2401.L * a7 (x) - 500.L * b5 (x) - 864.L * b6 (x) - 1372.L * b7 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x) + REAL (36.) * a6 (x)
+    + REAL (49.) * a7 (x) - REAL (8.) * b4 (x) - REAL (10.) * b5 (x)
+    - REAL (12.) * b6 (x) - REAL (14.) * b7 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) - REAL (48.) * b4 (x) - REAL (75.) * b5 (x)
+    - REAL (108.) * b6 (x) - REAL (147.) * b7 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * (a4 (x) - b4 (x)) + REAL (625.) * a5 (x)
+    + REAL (1296.) * a6 (x) + REAL (2401.) * a7 (x) - REAL (500.) * b5 (x)
+    - REAL (864.) * b6 (x) - REAL (1372.) * b7 (x);
   solve_3 (A, B, C, D);
   b3 (x) = D[2];
   if (isnan (b3 (x)))
@@ -1162,10 +1270,12 @@ steps_8_4 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = D[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) - b1 (x) - b2 (x) - b3 (x)
-    - b4 (x) - b5 (x) - b6 (x) - b7 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x)
+    - b7 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x);
   return 1;
 }
 
@@ -1175,10 +1285,12 @@ steps_8_4 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_8_5 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4];
-  long double *x, *r;
+  Real A[4], B[4], C[4], D[4], E[4];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -1189,34 +1301,38 @@ steps_8_5 (Optimize * optimize) ///< Optimize struct.
   b7 (x) = r[7];
   b6 (x) = r[8];
   b5 (x) = r[9];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) - 10.L * b5 (x)
-    - 12.L * b6 (x) - 14.L * b7 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) - 75.L * b5 (x)
-    - 108.L * b6 (x) - 147.L * b7 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) - 500.L * b5 (x)
-    - 864.L * b6 (x) - 1372.L * b7 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * (a5 (x) - b5 (x)) + 7776.L * a6 (x) + 16807.L * a7 (x)
-    - 6480.L * b6 (x) - 12005.L * b7 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x) + REAL (36.) * a6 (x)
+    + REAL (49.) * a7 (x) - REAL (10.) * b5 (x) - REAL (12.) * b6 (x)
+    - REAL (14.) * b7 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) - REAL (75.) * b5 (x) - REAL (108.) * b6 (x)
+    - REAL (147.) * b7 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) - REAL (500.) * b5 (x) - REAL (864.) * b6 (x)
+    - REAL (1372.) * b7 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * (a5 (x) - b5 (x))
+    + REAL (7776.) * a6 (x) + REAL (16807.) * a7 (x) - REAL (6480.) * b6 (x)
+    - REAL (12005.) * b7 (x);
   solve_4 (A, B, C, D, E);
   b4 (x) = E[3];
   if (isnan (b4 (x)))
@@ -1230,10 +1346,12 @@ steps_8_5 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = E[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) - b1 (x) - b2 (x) - b3 (x)
-    - b4 (x) - b5 (x) - b6 (x) - b7 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x)
+    - b7 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x);
   return 1;
 }
 
@@ -1243,10 +1361,12 @@ steps_8_5 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_8_6 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[5], B[5], C[5], D[5], E[5], F[5];
-  long double *x, *r;
+  Real A[5], B[5], C[5], D[5], E[5], F[5];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -1256,46 +1376,47 @@ steps_8_6 (Optimize * optimize) ///< Optimize struct.
   a7 (x) = r[6];
   b7 (x) = r[7];
   b6 (x) = r[8];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) - 12.L * b6 (x)
-    - 14.L * b7 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) - 108.L * b6 (x)
-    - 147.L * b7 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) - 864.L * b6 (x)
-    - 1372.L * b7 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) - 6480.L * b6 (x)
-    - 12005.L * b7 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * (a6 (x) - b6 (x)) + 117649.L * a7 (x)
-    - 100842.L * b7 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x) + REAL (36.) * a6 (x)
+    + REAL (49.) * a7 (x) - REAL (12.) * b6 (x) - REAL (14.) * b7 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) - REAL (108.) * b6 (x) - REAL (147.) * b7 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) - REAL (864.) * b6 (x) - REAL (1372.) * b7 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) - REAL (6480.) * b6 (x) - REAL (12005.) * b7 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x)
+    + REAL (46656.) * (a6 (x) - b6 (x)) + REAL (117649.) * a7 (x)
+    - REAL (100842.) * b7 (x);
   solve_5 (A, B, C, D, E, F);
   b5 (x) = F[4];
   if (isnan (b5 (x)))
@@ -1312,10 +1433,12 @@ steps_8_6 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = F[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) - b1 (x) - b2 (x) - b3 (x)
-    - b4 (x) - b5 (x) - b6 (x) - b7 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x)
+    - b7 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x);
   return 1;
 }
 
@@ -1325,10 +1448,12 @@ steps_8_6 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_8_7 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[6], B[6], C[6], D[6], E[6], F[6], G[6];
-  long double *x, *r;
+  Real A[6], B[6], C[6], D[6], E[6], F[6], G[6];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -1337,55 +1462,60 @@ steps_8_7 (Optimize * optimize) ///< Optimize struct.
   a6 (x) = r[5];
   a7 (x) = r[6];
   b7 (x) = r[7];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = 12.L;
-  G[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) - 14.L * b7 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 108.L;
-  G[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) - 147.L * b7 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = 864.L;
-  G[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) - 1372.L * b7 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 6480.L;
-  G[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) - 12005.L * b7 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = 46656.L;
-  G[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * a6 (x) + 117649.L * a7 (x)
-    - 100842.L * b7 (x);
-  A[5] = 7.L;
-  B[5] = 448.L;
-  C[5] = 5103.L;
-  D[5] = 28672.L;
-  E[5] = 109375.L;
-  F[5] = 326592.L;
-  G[5] = 1.L + a1 (x) + 128.L * a2 (x) + 2187.L * a3 (x) + 16384.L * a4 (x)
-    + 78125.L * a5 (x) + 279936.L * a6 (x) + 823543.L * (a7 (x) - b7 (x));
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = REAL (12.);
+  G[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x) + REAL (36.) * a6 (x)
+    + REAL (49.) * a7 (x) - REAL (14.) * b7 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (108.);
+  G[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) - REAL (147.) * b7 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = REAL (864.);
+  G[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) - REAL (1372.) * b7 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (6480.);
+  G[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) - REAL (12005.) * b7 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = REAL (46656.);
+  G[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x) + REAL (46656.) * a6 (x)
+    + REAL (117649.) * a7 (x) - REAL (100842.) * b7 (x);
+  A[5] = REAL (7.);
+  B[5] = REAL (448.);
+  C[5] = REAL (5103.);
+  D[5] = REAL (28672.);
+  E[5] = REAL (109375.);
+  F[5] = REAL (326592.);
+  G[5] = REAL (1.) + a1 (x) + REAL (128.) * a2 (x) + REAL (2187.) * a3 (x)
+    + REAL (16384.) * a4 (x) + REAL (78125.) * a5 (x) + REAL (279936.) * a6 (x)
+    + REAL (823543.) * (a7 (x) - b7 (x));
   solve_6 (A, B, C, D, E, F, G);
   b6 (x) = G[5];
   if (isnan (b6 (x)))
@@ -1405,10 +1535,12 @@ steps_8_7 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = G[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) - b1 (x) - b2 (x) - b3 (x)
-    - b4 (x) - b5 (x) - b6 (x) - b7 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x)
+    - b7 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x);
   return 1;
 }
 
@@ -1418,10 +1550,12 @@ steps_8_7 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_8_8 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[7], B[7], C[7], D[7], E[7], F[7], G[7], H[7];
-  long double *x, *r;
+  Real A[7], B[7], C[7], D[7], E[7], F[7], G[7], H[7];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -1429,69 +1563,76 @@ steps_8_8 (Optimize * optimize) ///< Optimize struct.
   a5 (x) = r[4];
   a6 (x) = r[5];
   a7 (x) = r[6];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = 12.L;
-  G[0] = 14.L;
-  H[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * a4 (x)
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 108.L;
-  G[1] = 147.L;
-  H[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = 864.L;
-  G[2] = 1372.L;
-  H[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 6480.L;
-  G[3] = 12005.L;
-  H[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = 46656.L;
-  G[4] = 100842.L;
-  H[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * a6 (x) + 117649.L * a7 (x);
-  A[5] = 7.L;
-  B[5] = 448.L;
-  C[5] = 5103.L;
-  D[5] = 28672.L;
-  E[5] = 109375.L;
-  F[5] = 326592.L;
-  G[5] = 823543.L;
-  H[5] = 1.L + a1 (x) + 128.L * a2 (x) + 2187.L * a3 (x) + 16384.L * a4 (x)
-    + 78125.L * a5 (x) + 279936.L * a6 (x) + 823543.L * a7 (x);
-  A[6] = 8.L;
-  B[6] = 1024.L;
-  C[6] = 17496.L;
-  D[6] = 131072.L;
-  E[6] = 625000.L;
-  F[6] = 2239488.L;
-  G[6] = 6588344.L;
-  H[6] = -1.L + a1 (x) + 256.L * a2 (x) + 6561.L * a3 (x) + 65536.L * a4 (x)
-    + 390625.L * a5 (x) + 1679616.L * a6 (x) + 5764801.L * a7 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = REAL (12.);
+  G[0] = REAL (14.);
+  H[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * a4 (x) + REAL (25.) * a5 (x) + REAL (36.) * a6 (x)
+    + REAL (49.) * a7 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (108.);
+  G[1] = REAL (147.);
+  H[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = REAL (864.);
+  G[2] = REAL (1372.);
+  H[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (6480.);
+  G[3] = REAL (12005.);
+  H[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = REAL (46656.);
+  G[4] = REAL (100842.);
+  H[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x) + REAL (46656.) * a6 (x)
+    + REAL (117649.) * a7 (x);
+  A[5] = REAL (7.);
+  B[5] = REAL (448.);
+  C[5] = REAL (5103.);
+  D[5] = REAL (28672.);
+  E[5] = REAL (109375.);
+  F[5] = REAL (326592.);
+  G[5] = REAL (823543.);
+  H[5] = REAL (1.) + a1 (x) + REAL (128.) * a2 (x) + REAL (2187.) * a3 (x)
+    + REAL (16384.) * a4 (x) + REAL (78125.) * a5 (x) + REAL (279936.) * a6 (x)
+    + REAL (823543.) * a7 (x);
+  A[6] = REAL (8.);
+  B[6] = REAL (1024.);
+  C[6] = REAL (17496.);
+  D[6] = REAL (131072.);
+  E[6] = REAL (625000.);
+  F[6] = REAL (2239488.);
+  G[6] = REAL (6588344.);
+  H[6] = -REAL (1.) + a1 (x) + REAL (256.) * a2 (x) + REAL (6561.) * a3 (x)
+    + REAL (65536.) * a4 (x) + REAL (390625.) * a5 (x)
+    + REAL (1679616.) * a6 (x) + REAL (5764801.) * a7 (x);
   solve_7 (A, B, C, D, E, F, G, H);
   b7 (x) = H[6];
   if (isnan (b7 (x)))
@@ -1514,10 +1655,12 @@ steps_8_8 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = H[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) - b1 (x) - b2 (x) - b3 (x)
-    - b4 (x) - b5 (x) - b6 (x) - b7 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x)
+    - b7 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x);
   return 1;
 }
 
@@ -1527,9 +1670,11 @@ steps_8_8 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_9_2 (Optimize * optimize) ///< Optimize struct.
 {
-  long double *x, *r;
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -1546,15 +1691,18 @@ steps_9_2 (Optimize * optimize) ///< Optimize struct.
   b3 (x) = r[13];
   b2 (x) = r[14];
   b1 (x)
-    = 0.5L * (a1 (x) + 4.L * (a2 (x) - b2 (x)) + 9.L * a3 (x)
-              + 16.L * (a4 (x) - b8 (x)) + 25.L * a5 (x) + 36.L * a6 (x)
-              + 49.L * a7 (x) + 64.L * a8 (x) - 6.L * b3 (x) - 8.L * b4 (x)
-              - 10.L * b5 (x) - 12.L * b6 (x) - 14.L * b7 (x) - 1.L);
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) - b1 (x)
-    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x);
+    = REAL (0.5) * (a1 (x) + REAL (4.) * (a2 (x) - b2 (x)) + REAL (9.) * a3 (x)
+                    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+                    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x)
+                    + REAL (64.) * a8 (x) - REAL (6.) * b3 (x)
+                    - REAL (8.) * b4 (x) - REAL (10.) * b5 (x)
+                    - REAL (12.) * b6 (x) - REAL (14.) * b7 (x) - REAL (1.));
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x);
   return 1;
 }
 
@@ -1564,10 +1712,12 @@ steps_9_2 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_9_3 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[2], B[2], C[2];
-  long double *x, *r;
+  Real A[2], B[2], C[2];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -1582,18 +1732,20 @@ steps_9_3 (Optimize * optimize) ///< Optimize struct.
   b5 (x) = r[11];
   b4 (x) = r[12];
   b3 (x) = r[13];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    - 6.L * b3 (x) - 8.L * b4 (x) - 10.L * b5 (x) - 12.L * b6 (x)
-    - 14.L * b7 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * (a3 (x) - b3 (x)) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    - 48.L * b4 (x) - 75.L * b5 (x) - 108.L * b6 (x) - 147.L * b7 (x)
-    - 192.L * b8 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    - REAL (6.) * b3 (x) - REAL (8.) * b4 (x) - REAL (10.) * b5 (x)
+    - REAL (12.) * b6 (x) - REAL (14.) * b7 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x)
+    + REAL (27.) * (a3 (x) - b3 (x)) + REAL (64.) * a4 (x)
+    + REAL (125.) * a5 (x) + REAL (216.) * a6 (x) + REAL (343.) * a7 (x)
+    + REAL (512.) * a8 (x) - REAL (48.) * b4 (x) - REAL (75.) * b5 (x)
+    - REAL (108.) * b6 (x) - REAL (147.) * b7 (x) - REAL (192.) * b8 (x);
   solve_2 (A, B, C);
   b2 (x) = C[1];
   if (isnan (b2 (x)))
@@ -1601,11 +1753,12 @@ steps_9_3 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = C[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) - b1 (x)
-    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x);
   return 1;
 }
 
@@ -1615,10 +1768,12 @@ steps_9_3 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_9_4 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[3], B[3], C[3], D[3];
-  long double *x, *r;
+  Real A[3], B[3], C[3], D[3];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -1632,26 +1787,30 @@ steps_9_4 (Optimize * optimize) ///< Optimize struct.
   b6 (x) = r[10];
   b5 (x) = r[11];
   b4 (x) = r[12];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    - 8.L * b4 (x) - 10.L * b5 (x) - 12.L * b6 (x) - 14.L * b7 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    - 48.L * b4 (x) - 75.L * b5 (x) - 108.L * b6 (x) - 147.L * b7 (x)
-    - 192.L * b8 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x)
-    + 256.L * (a4 (x) - b4 (x)) + 625.L * a5 (x) + 1296.L * a6 (x)
-    + 2401.L * a7 (x) + 4096.L * a8 (x) - 500.L * b5 (x) - 864.L * b6 (x)
-    - 1372.L * b7 (x) - 2048.L * b8 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    - REAL (8.) * b4 (x) - REAL (10.) * b5 (x) - REAL (12.) * b6 (x)
+    - REAL (14.) * b7 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) - REAL (48.) * b4 (x)
+    - REAL (75.) * b5 (x) - REAL (108.) * b6 (x) - REAL (147.) * b7 (x)
+    - REAL (192.) * b8 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * (a4 (x) - b4 (x)) + REAL (625.) * a5 (x)
+    + REAL (1296.) * a6 (x) + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x)
+    - REAL (500.) * b5 (x) - REAL (864.) * b6 (x) - REAL (1372.) * b7 (x)
+    - REAL (2048.) * b8 (x);
   solve_3 (A, B, C, D);
   b3 (x) = D[2];
   if (isnan (b3 (x)))
@@ -1662,11 +1821,12 @@ steps_9_4 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = D[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) - b1 (x)
-    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x);
   return 1;
 }
 
@@ -1676,10 +1836,12 @@ steps_9_4 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_9_5 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4];
-  long double *x, *r;
+  Real A[4], B[4], C[4], D[4], E[4];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -1692,34 +1854,38 @@ steps_9_5 (Optimize * optimize) ///< Optimize struct.
   b7 (x) = r[9];
   b6 (x) = r[10];
   b5 (x) = r[11];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    - 10.L * b5 (x) - 12.L * b6 (x) - 14.L * b7 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    - 75.L * b5 (x) - 108.L * b6 (x) - 147.L * b7 (x) - 192.L * b8 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    - 500.L * b5 (x) - 864.L * b6 (x) - 1372.L * b7 (x) - 2048.L * b8 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * (a5 (x) - b5 (x)) + 7776.L * a6 (x) + 16807.L * a7 (x)
-    + 32768.L * a8 (x) - 6480.L * b6 (x) - 12005.L * b7 (x) - 20480.L * b8 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    - REAL (10.) * b5 (x) - REAL (12.) * b6 (x) - REAL (14.) * b7 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) - REAL (75.) * b5 (x)
+    - REAL (108.) * b6 (x) - REAL (147.) * b7 (x) - REAL (192.) * b8 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) - REAL (500.) * b5 (x)
+    - REAL (864.) * b6 (x) - REAL (1372.) * b7 (x) - REAL (2048.) * b8 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * (a5 (x) - b5 (x))
+    + REAL (7776.) * a6 (x) + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x)
+    - REAL (6480.) * b6 (x) - REAL (12005.) * b7 (x) - REAL (20480.) * b8 (x);
   solve_4 (A, B, C, D, E);
   b4 (x) = E[3];
   if (isnan (b4 (x)))
@@ -1733,11 +1899,12 @@ steps_9_5 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = E[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) - b1 (x)
-    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x);
   return 1;
 }
 
@@ -1747,10 +1914,12 @@ steps_9_5 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_9_6 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[5], B[5], C[5], D[5], E[5], F[5];
-  long double *x, *r;
+  Real A[5], B[5], C[5], D[5], E[5], F[5];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -1762,46 +1931,52 @@ steps_9_6 (Optimize * optimize) ///< Optimize struct.
   b8 (x) = r[8];
   b7 (x) = r[9];
   b6 (x) = r[10];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    - 12.L * b6 (x) - 14.L * b7 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    - 108.L * b6 (x) - 147.L * b7 (x) - 192.L * b8 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    - 864.L * b6 (x) - 1372.L * b7 (x) - 2048.L * b8 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    - 6480.L * b6 (x) - 12005.L * b7 (x) - 20480.L * b8 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * (a6 (x) - b6 (x)) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) - 100842.L * b7 (x) - 196608.L * b8 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    - REAL (12.) * b6 (x) - REAL (14.) * b7 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) - REAL (108.) * b6 (x)
+    - REAL (147.) * b7 (x) - REAL (192.) * b8 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) - REAL (864.) * b6 (x)
+    - REAL (1372.) * b7 (x) - REAL (2048.) * b8 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) - REAL (6480.) * b6 (x)
+    - REAL (12005.) * b7 (x) - REAL (20480.) * b8 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x)
+    + REAL (46656.) * (a6 (x) - b6 (x)) + REAL (117649.) * a7 (x)
+    + REAL (262144.) * a8 (x) - REAL (100842.) * b7 (x)
+    - REAL (196608.) * b8 (x);
   solve_5 (A, B, C, D, E, F);
   b5 (x) = F[4];
   if (isnan (b5 (x)))
@@ -1818,11 +1993,12 @@ steps_9_6 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = F[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) - b1 (x)
-    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x);
   return 1;
 }
 
@@ -1832,10 +2008,12 @@ steps_9_6 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_9_7 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[6], B[6], C[6], D[6], E[6], F[6], G[6];
-  long double *x, *r;
+  Real A[6], B[6], C[6], D[6], E[6], F[6], G[6];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -1846,60 +2024,66 @@ steps_9_7 (Optimize * optimize) ///< Optimize struct.
   a8 (x) = r[7];
   b8 (x) = r[8];
   b7 (x) = r[9];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = 12.L;
-  G[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    - 14.L * b7 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 108.L;
-  G[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    - 147.L * b7 (x) - 192.L * b8 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = 864.L;
-  G[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    - 1372.L * b7 (x) - 2048.L * b8 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 6480.L;
-  G[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    - 12005.L * b7 (x) - 20480.L * b8 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = 46656.L;
-  G[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * a6 (x) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) - 100842.L * b7 (x) - 196608.L * b8 (x);
-  A[5] = 7.L;
-  B[5] = 448.L;
-  C[5] = 5103.L;
-  D[5] = 28672.L;
-  E[5] = 109375.L;
-  F[5] = 326592.L;
-  G[5] = 1.L + a1 (x) + 128.L * a2 (x) + 2187.L * a3 (x) + 16384.L * a4 (x)
-    + 78125.L * a5 (x) + 279936.L * a6 (x) + 823543.L * (a7 (x) - b7 (x))
-    + 2097152.L * a8 (x) - 1835008.L * b8 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = REAL (12.);
+  G[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    - REAL (14.) * b7 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (108.);
+  G[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) - REAL (147.) * b7 (x)
+    - REAL (192.) * b8 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = REAL (864.);
+  G[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) - REAL (1372.) * b7 (x)
+    - REAL (2048.) * b8 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (6480.);
+  G[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) - REAL (12005.) * b7 (x)
+    - REAL (20480.) * b8 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = REAL (46656.);
+  G[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x) + REAL (46656.) * a6 (x)
+    + REAL (117649.) * a7 (x) + REAL (262144.) * a8 (x)
+    - REAL (100842.) * b7 (x) - REAL (196608.) * b8 (x);
+  A[5] = REAL (7.);
+  B[5] = REAL (448.);
+  C[5] = REAL (5103.);
+  D[5] = REAL (28672.);
+  E[5] = REAL (109375.);
+  F[5] = REAL (326592.);
+  G[5] = REAL (1.) + a1 (x) + REAL (128.) * a2 (x) + REAL (2187.) * a3 (x)
+    + REAL (16384.) * a4 (x) + REAL (78125.) * a5 (x) + REAL (279936.) * a6 (x)
+    + REAL (823543.) * (a7 (x) - b7 (x)) + REAL (2097152.) * a8 (x)
+    - REAL (1835008.) * b8 (x);
   solve_6 (A, B, C, D, E, F, G);
   b6 (x) = G[5];
   if (isnan (b6 (x)))
@@ -1919,11 +2103,12 @@ steps_9_7 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = G[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) - b1 (x)
-    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x);
   return 1;
 }
 
@@ -1933,10 +2118,12 @@ steps_9_7 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_9_8 (Optimize * optimize) ///< Optimize struct.
 {
-  long double A[7], B[7], C[7], D[7], E[7], F[7], G[7], H[7];
-  long double *x, *r;
+  Real A[7], B[7], C[7], D[7], E[7], F[7], G[7], H[7];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -1946,75 +2133,79 @@ steps_9_8 (Optimize * optimize) ///< Optimize struct.
   a7 (x) = r[6];
   a8 (x) = r[7];
   b8 (x) = r[8];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = 12.L;
-  G[0] = 14.L;
-  H[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 108.L;
-  G[1] = 147.L;
-  H[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    - 192.L * b8 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = 864.L;
-  G[2] = 1372.L;
-  H[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    - 2048.L * b8 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 6480.L;
-  G[3] = 12005.L;
-  H[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    - 20480.L * b8 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = 46656.L;
-  G[4] = 100842.L;
-  H[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * a6 (x) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) - 196608.L * b8 (x);
-  A[5] = 7.L;
-  B[5] = 448.L;
-  C[5] = 5103.L;
-  D[5] = 28672.L;
-  E[5] = 109375.L;
-  F[5] = 326592.L;
-  G[5] = 823543.L;
-  H[5] = 1.L + a1 (x) + 128.L * a2 (x) + 2187.L * a3 (x) + 16384.L * a4 (x)
-    + 78125.L * a5 (x) + 279936.L * a6 (x) + 823543.L * a7 (x)
-    + 2097152.L * a8 (x) - 1835008.L * b8 (x);
-  A[6] = 8.L;
-  B[6] = 1024.L;
-  C[6] = 17496.L;
-  D[6] = 131072.L;
-  E[6] = 625000.L;
-  F[6] = 2239488.L;
-  G[6] = 6588344.L;
-  H[6] = -1.L + a1 (x) + 256.L * a2 (x) + 6561.L * a3 (x) + 65536.L * a4 (x)
-    + 390625.L * a5 (x) + 1679616.L * a6 (x) + 5764801.L * a7 (x)
-    + 16777216.L * (a8 (x) - b8 (x));
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = REAL (12.);
+  G[0] = REAL (14.);
+  H[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (108.);
+  G[1] = REAL (147.);
+  H[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) - REAL (192.) * b8 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = REAL (864.);
+  G[2] = REAL (1372.);
+  H[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) - REAL (2048.) * b8 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (6480.);
+  G[3] = REAL (12005.);
+  H[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) - REAL (20480.) * b8 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = REAL (46656.);
+  G[4] = REAL (100842.);
+  H[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x) + REAL (46656.) * a6 (x)
+    + REAL (117649.) * a7 (x) + REAL (262144.) * a8 (x)
+    - REAL (196608.) * b8 (x);
+  A[5] = REAL (7.);
+  B[5] = REAL (448.);
+  C[5] = REAL (5103.);
+  D[5] = REAL (28672.);
+  E[5] = REAL (109375.);
+  F[5] = REAL (326592.);
+  G[5] = REAL (823543.);
+  H[5] = REAL (1.) + a1 (x) + REAL (128.) * a2 (x) + REAL (2187.) * a3 (x)
+    + REAL (16384.) * a4 (x) + REAL (78125.) * a5 (x) + REAL (279936.) * a6 (x)
+    + REAL (823543.) * a7 (x) + REAL (2097152.) * a8 (x)
+    - REAL (1835008.) * b8 (x);
+  A[6] = REAL (8.);
+  B[6] = REAL (1024.);
+  C[6] = REAL (17496.);
+  D[6] = REAL (131072.);
+  E[6] = REAL (625000.);
+  F[6] = REAL (2239488.);
+  G[6] = REAL (6588344.);
+  H[6] = -REAL (1.) + a1 (x) + REAL (256.) * a2 (x) + REAL (6561.) * a3 (x)
+    + REAL (65536.) * a4 (x) + REAL (390625.) * a5 (x)
+    + REAL (1679616.) * a6 (x) + REAL (5764801.) * a7 (x)
+    + REAL (16777216.) * (a8 (x) - b8 (x));
   solve_7 (A, B, C, D, E, F, G, H);
   b7 (x) = H[6];
   if (isnan (b7 (x)))
@@ -2037,11 +2228,12 @@ steps_9_8 (Optimize * optimize) ///< Optimize struct.
   b1 (x) = H[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) - b1 (x)
-    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x);
   return 1;
 }
 
@@ -2051,9 +2243,11 @@ steps_9_8 (Optimize * optimize) ///< Optimize struct.
 static int
 steps_10_2 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *x, *r;
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -2072,17 +2266,19 @@ steps_10_2 (Optimize * optimize)        ///< Optimize struct.
   b3 (x) = r[15];
   b2 (x) = r[16];
   b1 (x)
-    = 0.5L * (a1 (x) + 4.L * (a2 (x) - b2 (x)) + 9.L * a3 (x)
-              + 16.L * (a4 (x) - b8 (x)) + 25.L * a5 (x) + 36.L * a6 (x)
-              + 49.L * a7 (x) + 64.L * a8 (x) + 81.L * a9 (x) - 6.L * b3 (x)
-              - 8.L * b4 (x) - 10.L * b5 (x) - 12.L * b6 (x) - 14.L * b7 (x)
-              - 18.L * b9 (x) - 1.L);
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x)
-    - b9 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x);
+    = REAL (0.5) * (a1 (x) + REAL (4.) * (a2 (x) - b2 (x)) + REAL (9.) * a3 (x)
+                    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+                    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x)
+                    + REAL (64.) * a8 (x) + REAL (81.) * a9 (x)
+                    - REAL (6.) * b3 (x) - REAL (8.) * b4 (x)
+                    - REAL (10.) * b5 (x) - REAL (12.) * b6 (x)
+                    - REAL (14.) * b7 (x) - REAL (18.) * b9 (x) - REAL (1.));
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x) - b1 (x)
+    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x);
   return 1;
 }
 
@@ -2092,10 +2288,12 @@ steps_10_2 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_10_3 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[2], B[2], C[2];
-  long double *x, *r;
+  Real A[2], B[2], C[2];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -2112,18 +2310,22 @@ steps_10_3 (Optimize * optimize)        ///< Optimize struct.
   b5 (x) = r[13];
   b4 (x) = r[14];
   b3 (x) = r[15];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) - 6.L * b3 (x) - 8.L * b4 (x) - 10.L * b5 (x)
-    - 12.L * b6 (x) - 14.L * b7 (x) - 18.L * b9 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * (a3 (x) - b3 (x)) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) - 48.L * b4 (x) - 75.L * b5 (x) - 108.L * b6 (x)
-    - 147.L * b7 (x) - 192.L * b8 (x) - 243.L * b9 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) - REAL (6.) * b3 (x) - REAL (8.) * b4 (x)
+    - REAL (10.) * b5 (x) - REAL (12.) * b6 (x) - REAL (14.) * b7 (x)
+    - REAL (18.) * b9 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x)
+    + REAL (27.) * (a3 (x) - b3 (x)) + REAL (64.) * a4 (x)
+    + REAL (125.) * a5 (x) + REAL (216.) * a6 (x) + REAL (343.) * a7 (x)
+    + REAL (512.) * a8 (x) + REAL (729.) * a9 (x) - REAL (48.) * b4 (x)
+    - REAL (75.) * b5 (x) - REAL (108.) * b6 (x) - REAL (147.) * b7 (x)
+    - REAL (192.) * b8 (x) - REAL (243.) * b9 (x);
   solve_2 (A, B, C);
   b2 (x) = C[1];
   if (isnan (b2 (x)))
@@ -2131,12 +2333,12 @@ steps_10_3 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = C[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x)
-    - b9 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x) - b1 (x)
+    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x);
   return 1;
 }
 
@@ -2146,10 +2348,12 @@ steps_10_3 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_10_4 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[3], B[3], C[3], D[3];
-  long double *x, *r;
+  Real A[3], B[3], C[3], D[3];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -2165,27 +2369,30 @@ steps_10_4 (Optimize * optimize)        ///< Optimize struct.
   b6 (x) = r[12];
   b5 (x) = r[13];
   b4 (x) = r[14];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) - 8.L * b4 (x) - 10.L * b5 (x) - 12.L * b6 (x)
-    - 14.L * b7 (x) - 18.L * b9 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) - 48.L * b4 (x) - 75.L * b5 (x) - 108.L * b6 (x)
-    - 147.L * b7 (x) - 192.L * b8 (x) - 243.L * b9 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x)
-    + 256.L * (a4 (x) - b4 (x)) + 625.L * a5 (x) + 1296.L * a6 (x)
-    + 2401.L * a7 (x) + 4096.L * a8 (x) + 6561.L * a9 (x) - 500.L * b5 (x)
-    - 864.L * b6 (x) - 1372.L * b7 (x) - 2048.L * b8 (x) - 2916.L * b9 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) - REAL (8.) * b4 (x) - REAL (10.) * b5 (x)
+    - REAL (12.) * b6 (x) - REAL (14.) * b7 (x) - REAL (18.) * b9 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    - REAL (48.) * b4 (x) - REAL (75.) * b5 (x) - REAL (108.) * b6 (x)
+    - REAL (147.) * b7 (x) - REAL (192.) * b8 (x) - REAL (243.) * b9 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * (a4 (x) - b4 (x)) + REAL (625.) * a5 (x)
+    + REAL (1296.) * a6 (x) + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x)
+    + REAL (6561.) * a9 (x) - REAL (500.) * b5 (x) - REAL (864.) * b6 (x)
+    - REAL (1372.) * b7 (x) - REAL (2048.) * b8 (x) - REAL (2916.) * b9 (x);
   solve_3 (A, B, C, D);
   b3 (x) = D[2];
   if (isnan (b3 (x)))
@@ -2196,12 +2403,12 @@ steps_10_4 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = D[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x)
-    - b9 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x) - b1 (x)
+    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x);
   return 1;
 }
 
@@ -2211,10 +2418,12 @@ steps_10_4 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_10_5 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4];
-  long double *x, *r;
+  Real A[4], B[4], C[4], D[4], E[4];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -2229,38 +2438,42 @@ steps_10_5 (Optimize * optimize)        ///< Optimize struct.
   b7 (x) = r[11];
   b6 (x) = r[12];
   b5 (x) = r[13];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) - 10.L * b5 (x) - 12.L * b6 (x) - 14.L * b7 (x)
-    - 18.L * b9 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) - 75.L * b5 (x) - 108.L * b6 (x) - 147.L * b7 (x)
-    - 192.L * b8 (x) - 243.L * b9 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) - 500.L * b5 (x) - 864.L * b6 (x) - 1372.L * b7 (x)
-    - 2048.L * b8 (x) - 2916.L * b9 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * (a5 (x) - b5 (x)) + 7776.L * a6 (x) + 16807.L * a7 (x)
-    + 32768.L * a8 (x) + 59049.L * a9 (x) - 6480.L * b6 (x) - 12005.L * b7 (x)
-    - 20480.L * b8 (x) - 32805.L * b9 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) - REAL (10.) * b5 (x) - REAL (12.) * b6 (x)
+    - REAL (14.) * b7 (x) - REAL (18.) * b9 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    - REAL (75.) * b5 (x) - REAL (108.) * b6 (x) - REAL (147.) * b7 (x)
+    - REAL (192.) * b8 (x) - REAL (243.) * b9 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    - REAL (500.) * b5 (x) - REAL (864.) * b6 (x) - REAL (1372.) * b7 (x)
+    - REAL (2048.) * b8 (x) - REAL (2916.) * b9 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * (a5 (x) - b5 (x))
+    + REAL (7776.) * a6 (x) + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x)
+    + REAL (59049.) * a9 (x) - REAL (6480.) * b6 (x) - REAL (12005.) * b7 (x)
+    - REAL (20480.) * b8 (x) - REAL (32805.) * b9 (x);
   solve_4 (A, B, C, D, E);
   b4 (x) = E[3];
   if (isnan (b4 (x)))
@@ -2274,12 +2487,12 @@ steps_10_5 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = E[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x)
-    - b9 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x) - b1 (x)
+    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x);
   return 1;
 }
 
@@ -2289,10 +2502,12 @@ steps_10_5 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_10_6 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[5], B[5], C[5], D[5], E[5], F[5];
-  long double *x, *r;
+  Real A[5], B[5], C[5], D[5], E[5], F[5];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -2306,50 +2521,57 @@ steps_10_6 (Optimize * optimize)        ///< Optimize struct.
   b8 (x) = r[10];
   b7 (x) = r[11];
   b6 (x) = r[12];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) - 12.L * b6 (x) - 14.L * b7 (x) - 18.L * b9 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) - 108.L * b6 (x) - 147.L * b7 (x) - 192.L * b8 (x)
-    - 243.L * b9 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) - 864.L * b6 (x) - 1372.L * b7 (x) - 2048.L * b8 (x)
-    - 2916.L * b9 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    + 59049.L * a9 (x) - 6480.L * b6 (x) - 12005.L * b7 (x) - 20480.L * b8 (x)
-    - 32805.L * b9 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * (a6 (x) - b6 (x)) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) + 531441.L * a9 (x) - 100842.L * b7 (x)
-    - 196608.L * b8 (x) - 354294.L * b9 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) - REAL (12.) * b6 (x) - REAL (14.) * b7 (x)
+    - REAL (18.) * b9 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    - REAL (108.) * b6 (x) - REAL (147.) * b7 (x) - REAL (192.) * b8 (x)
+    - REAL (243.) * b9 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    - REAL (864.) * b6 (x) - REAL (1372.) * b7 (x) - REAL (2048.) * b8 (x)
+    - REAL (2916.) * b9 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) + REAL (59049.) * a9 (x)
+    - REAL (6480.) * b6 (x) - REAL (12005.) * b7 (x) - REAL (20480.) * b8 (x)
+    - REAL (32805.) * b9 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x)
+    + REAL (46656.) * (a6 (x) - b6 (x)) + REAL (117649.) * a7 (x)
+    + REAL (262144.) * a8 (x) + REAL (531441.) * a9 (x)
+    - REAL (100842.) * b7 (x) - REAL (196608.) * b8 (x)
+    - REAL (354294.) * b9 (x);
   solve_5 (A, B, C, D, E, F);
   b5 (x) = F[4];
   if (isnan (b5 (x)))
@@ -2366,12 +2588,12 @@ steps_10_6 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = F[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x)
-    - b9 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x) - b1 (x)
+    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x);
   return 1;
 }
 
@@ -2381,10 +2603,12 @@ steps_10_6 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_10_7 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[6], B[6], C[6], D[6], E[6], F[6], G[6];
-  long double *x, *r;
+  Real A[6], B[6], C[6], D[6], E[6], F[6], G[6];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -2397,62 +2621,68 @@ steps_10_7 (Optimize * optimize)        ///< Optimize struct.
   b9 (x) = r[9];
   b8 (x) = r[10];
   b7 (x) = r[11];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = 12.L;
-  G[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) - 14.L * b7 (x) - 18.L * b9 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 108.L;
-  G[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) - 147.L * b7 (x) - 192.L * b8 (x) - 243.L * b9 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = 864.L;
-  G[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) - 1372.L * b7 (x) - 2048.L * b8 (x) - 2916.L * b9 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 6480.L;
-  G[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    + 59049.L * a9 (x) - 12005.L * b7 (x) - 20480.L * b8 (x) - 32805.L * b9 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = 46656.L;
-  G[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * a6 (x) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) + 531441.L * a9 (x) - 100842.L * b7 (x)
-    - 196608.L * b8 (x) - 354294.L * b9 (x);
-  A[5] = 7.L;
-  B[5] = 448.L;
-  C[5] = 5103.L;
-  D[5] = 28672.L;
-  E[5] = 109375.L;
-  F[5] = 326592.L;
-  G[5] = 1.L + a1 (x) + 128.L * a2 (x) + 2187.L * a3 (x) + 16384.L * a4 (x)
-    + 78125.L * a5 (x) + 279936.L * a6 (x) + 823543.L * (a7 (x) - b7 (x))
-    + 2097152.L * a8 (x) + 4782969.L * a9 (x) - 1835008.L * b8 (x)
-    - 3720087.L * b9 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = REAL (12.);
+  G[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) - REAL (14.) * b7 (x) - REAL (18.) * b9 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (108.);
+  G[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    - REAL (147.) * b7 (x) - REAL (192.) * b8 (x) - REAL (243.) * b9 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = REAL (864.);
+  G[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    - REAL (1372.) * b7 (x) - REAL (2048.) * b8 (x) - REAL (2916.) * b9 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (6480.);
+  G[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) + REAL (59049.) * a9 (x)
+    - REAL (12005.) * b7 (x) - REAL (20480.) * b8 (x) - REAL (32805.) * b9 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = REAL (46656.);
+  G[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x) + REAL (46656.) * a6 (x)
+    + REAL (117649.) * a7 (x) + REAL (262144.) * a8 (x)
+    + REAL (531441.) * a9 (x) - REAL (100842.) * b7 (x)
+    - REAL (196608.) * b8 (x) - REAL (354294.) * b9 (x);
+  A[5] = REAL (7.);
+  B[5] = REAL (448.);
+  C[5] = REAL (5103.);
+  D[5] = REAL (28672.);
+  E[5] = REAL (109375.);
+  F[5] = REAL (326592.);
+  G[5] = REAL (1.) + a1 (x) + REAL (128.) * a2 (x) + REAL (2187.) * a3 (x)
+    + REAL (16384.) * a4 (x) + REAL (78125.) * a5 (x) + REAL (279936.) * a6 (x)
+    + REAL (823543.) * (a7 (x) - b7 (x)) + REAL (2097152.) * a8 (x)
+    + REAL (4782969.) * a9 (x) - REAL (1835008.) * b8 (x)
+    - REAL (3720087.) * b9 (x);
   solve_6 (A, B, C, D, E, F, G);
   b6 (x) = G[5];
   if (isnan (b6 (x)))
@@ -2472,12 +2702,12 @@ steps_10_7 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = G[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x)
-    - b9 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x) - b1 (x)
+    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x);
   return 1;
 }
 
@@ -2487,10 +2717,12 @@ steps_10_7 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_10_8 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[7], B[7], C[7], D[7], E[7], F[7], G[7], H[7];
-  long double *x, *r;
+  Real A[7], B[7], C[7], D[7], E[7], F[7], G[7], H[7];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -2502,79 +2734,86 @@ steps_10_8 (Optimize * optimize)        ///< Optimize struct.
   a9 (x) = r[8];
   b9 (x) = r[9];
   b8 (x) = r[10];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = 12.L;
-  G[0] = 14.L;
-  H[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) - 18.L * b9 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 108.L;
-  G[1] = 147.L;
-  H[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) - 192.L * b8 (x) - 243.L * b9 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = 864.L;
-  G[2] = 1372.L;
-  H[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) - 2048.L * b8 (x) - 2916.L * b9 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 6480.L;
-  G[3] = 12005.L;
-  H[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    + 59049.L * a9 (x) - 20480.L * b8 (x) - 32805.L * b9 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = 46656.L;
-  G[4] = 100842.L;
-  H[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * a6 (x) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) + 531441.L * a9 (x) - 196608.L * b8 (x)
-    - 354294.L * b9 (x);
-  A[5] = 7.L;
-  B[5] = 448.L;
-  C[5] = 5103.L;
-  D[5] = 28672.L;
-  E[5] = 109375.L;
-  F[5] = 326592.L;
-  G[5] = 823543.L;
-  H[5] = 1.L + a1 (x) + 128.L * a2 (x) + 2187.L * a3 (x) + 16384.L * a4 (x)
-    + 78125.L * a5 (x) + 279936.L * a6 (x) + 823543.L * a7 (x)
-    + 2097152.L * a8 (x) + 4782969.L * a9 (x) - 1835008.L * b8 (x)
-    - 3720087.L * b9 (x);
-  A[6] = 8.L;
-  B[6] = 1024.L;
-  C[6] = 17496.L;
-  D[6] = 131072.L;
-  E[6] = 625000.L;
-  F[6] = 2239488.L;
-  G[6] = 6588344.L;
-  H[6] = -1.L + a1 (x) + 256.L * a2 (x) + 6561.L * a3 (x) + 65536.L * a4 (x)
-    + 390625.L * a5 (x) + 1679616.L * a6 (x) + 5764801.L * a7 (x)
-    + 16777216.L * (a8 (x) - b8 (x)) + 43046721.L * a9 (x)
-    - 38263752.L * b9 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = REAL (12.);
+  G[0] = REAL (14.);
+  H[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) - REAL (18.) * b9 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (108.);
+  G[1] = REAL (147.);
+  H[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    - REAL (192.) * b8 (x) - REAL (243.) * b9 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = REAL (864.);
+  G[2] = REAL (1372.);
+  H[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    - REAL (2048.) * b8 (x) - REAL (2916.) * b9 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (6480.);
+  G[3] = REAL (12005.);
+  H[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) + REAL (59049.) * a9 (x)
+    - REAL (20480.) * b8 (x) - REAL (32805.) * b9 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = REAL (46656.);
+  G[4] = REAL (100842.);
+  H[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x) + REAL (46656.) * a6 (x)
+    + REAL (117649.) * a7 (x) + REAL (262144.) * a8 (x)
+    + REAL (531441.) * a9 (x) - REAL (196608.) * b8 (x)
+    - REAL (354294.) * b9 (x);
+  A[5] = REAL (7.);
+  B[5] = REAL (448.);
+  C[5] = REAL (5103.);
+  D[5] = REAL (28672.);
+  E[5] = REAL (109375.);
+  F[5] = REAL (326592.);
+  G[5] = REAL (823543.);
+  H[5] = REAL (1.) + a1 (x) + REAL (128.) * a2 (x) + REAL (2187.) * a3 (x)
+    + REAL (16384.) * a4 (x) + REAL (78125.) * a5 (x) + REAL (279936.) * a6 (x)
+    + REAL (823543.) * a7 (x) + REAL (2097152.) * a8 (x)
+    + REAL (4782969.) * a9 (x) - REAL (1835008.) * b8 (x)
+    - REAL (3720087.) * b9 (x);
+  A[6] = REAL (8.);
+  B[6] = REAL (1024.);
+  C[6] = REAL (17496.);
+  D[6] = REAL (131072.);
+  E[6] = REAL (625000.);
+  F[6] = REAL (2239488.);
+  G[6] = REAL (6588344.);
+  H[6] = -REAL (1.) + a1 (x) + REAL (256.) * a2 (x) + REAL (6561.) * a3 (x)
+    + REAL (65536.) * a4 (x) + REAL (390625.) * a5 (x)
+    + REAL (1679616.) * a6 (x) + REAL (5764801.) * a7 (x)
+    + REAL (16777216.) * (a8 (x) - b8 (x)) + REAL (43046721.) * a9 (x)
+    - REAL (38263752.) * b9 (x);
   solve_7 (A, B, C, D, E, F, G, H);
   b7 (x) = H[6];
   if (isnan (b7 (x)))
@@ -2597,12 +2836,12 @@ steps_10_8 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = H[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x)
-    - b9 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x) - b1 (x)
+    - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x);
   return 1;
 }
 
@@ -2612,9 +2851,11 @@ steps_10_8 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_11_2 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *x, *r;
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -2635,17 +2876,21 @@ steps_11_2 (Optimize * optimize)        ///< Optimize struct.
   b3 (x) = r[17];
   b2 (x) = r[18];
   b1 (x)
-    = 0.5L * (a1 (x) + 4.L * (a2 (x) - b2 (x)) + 9.L * a3 (x)
-              + 16.L * (a4 (x) - b8 (x)) + 25.L * a5 (x) + 36.L * a6 (x)
-              + 49.L * a7 (x) + 64.L * a8 (x) + 81.L * a9 (x) + 100.L * a10 (x)
-              - 6.L * b3 (x) - 8.L * b4 (x) - 10.L * b5 (x) - 12.L * b6 (x)
-              - 14.L * b7 (x) - 18.L * b9 (x) - 20.L * b10 (x) - 1.L);
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x)
-    - b7 (x) - b8 (x) - b9 (x) - b10 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x);
+    = REAL (0.5) * (a1 (x) + REAL (4.) * (a2 (x) - b2 (x)) + REAL (9.) * a3 (x)
+                    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+                    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x)
+                    + REAL (64.) * a8 (x) + REAL (81.) * a9 (x)
+                    + REAL (100.) * a10 (x) - REAL (6.) * b3 (x)
+                    - REAL (8.) * b4 (x) - REAL (10.) * b5 (x)
+                    - REAL (12.) * b6 (x) - REAL (14.) * b7 (x)
+                    - REAL (18.) * b9 (x) - REAL (20.) * b10 (x) - REAL (1.));
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x)
+    - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x);
   return 1;
 }
 
@@ -2655,10 +2900,12 @@ steps_11_2 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_11_3 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[2], B[2], C[2];
-  long double *x, *r;
+  Real A[2], B[2], C[2];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -2677,20 +2924,23 @@ steps_11_3 (Optimize * optimize)        ///< Optimize struct.
   b5 (x) = r[15];
   b4 (x) = r[16];
   b3 (x) = r[17];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) - 6.L * b3 (x) - 8.L * b4 (x)
-    - 10.L * b5 (x) - 12.L * b6 (x) - 14.L * b7 (x) - 18.L * b9 (x)
-    - 20.L * b10 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * (a3 (x) - b3 (x)) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) - 48.L * b4 (x) - 75.L * b5 (x)
-    - 108.L * b6 (x) - 147.L * b7 (x) - 192.L * b8 (x) - 243.L * b9 (x)
-    - 300.L * b10 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) - REAL (6.) * b3 (x)
+    - REAL (8.) * b4 (x) - REAL (10.) * b5 (x) - REAL (12.) * b6 (x)
+    - REAL (14.) * b7 (x) - REAL (18.) * b9 (x) - REAL (20.) * b10 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x)
+    + REAL (27.) * (a3 (x) - b3 (x)) + REAL (64.) * a4 (x)
+    + REAL (125.) * a5 (x) + REAL (216.) * a6 (x) + REAL (343.) * a7 (x)
+    + REAL (512.) * a8 (x) + REAL (729.) * a9 (x) + REAL (1000.) * a10 (x)
+    - REAL (48.) * b4 (x) - REAL (75.) * b5 (x) - REAL (108.) * b6 (x)
+    - REAL (147.) * b7 (x) - REAL (192.) * b8 (x) - REAL (243.) * b9 (x)
+    - REAL (300.) * b10 (x);
   solve_2 (A, B, C);
   b2 (x) = C[1];
   if (isnan (b2 (x)))
@@ -2698,12 +2948,13 @@ steps_11_3 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = C[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x)
-    - b7 (x) - b8 (x) - b9 (x) - b10 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x)
+    - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x);
   return 1;
 }
 
@@ -2713,10 +2964,12 @@ steps_11_3 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_11_4 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[3], B[3], C[3], D[3];
-  long double *x, *r;
+  Real A[3], B[3], C[3], D[3];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -2734,29 +2987,33 @@ steps_11_4 (Optimize * optimize)        ///< Optimize struct.
   b6 (x) = r[14];
   b5 (x) = r[15];
   b4 (x) = r[16];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) - 8.L * b4 (x) - 10.L * b5 (x)
-    - 12.L * b6 (x) - 14.L * b7 (x) - 18.L * b9 (x) - 20.L * b10 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) - 48.L * b4 (x) - 75.L * b5 (x)
-    - 108.L * b6 (x) - 147.L * b7 (x) - 192.L * b8 (x) - 243.L * b9 (x)
-    - 300.L * b10 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x)
-    + 256.L * (a4 (x) - b4 (x)) + 625.L * a5 (x) + 1296.L * a6 (x)
-    + 2401.L * a7 (x) + 4096.L * a8 (x) + 6561.L * a9 (x) + 10000.L * a10 (x)
-    - 500.L * b5 (x) - 864.L * b6 (x) - 1372.L * b7 (x) - 2048.L * b8 (x)
-    - 2916.L * b9 (x) - 4000.L * b10 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) - REAL (8.) * b4 (x)
+    - REAL (10.) * b5 (x) - REAL (12.) * b6 (x) - REAL (14.) * b7 (x)
+    - REAL (18.) * b9 (x) - REAL (20.) * b10 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) - REAL (48.) * b4 (x) - REAL (75.) * b5 (x)
+    - REAL (108.) * b6 (x) - REAL (147.) * b7 (x) - REAL (192.) * b8 (x)
+    - REAL (243.) * b9 (x) - REAL (300.) * b10 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * (a4 (x) - b4 (x)) + REAL (625.) * a5 (x)
+    + REAL (1296.) * a6 (x) + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x)
+    + REAL (6561.) * a9 (x) + REAL (10000.) * a10 (x) - REAL (500.) * b5 (x)
+    - REAL (864.) * b6 (x) - REAL (1372.) * b7 (x) - REAL (2048.) * b8 (x)
+    - REAL (2916.) * b9 (x) - REAL (4000.) * b10 (x);
   solve_3 (A, B, C, D);
   b3 (x) = D[2];
   if (isnan (b3 (x)))
@@ -2767,12 +3024,13 @@ steps_11_4 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = D[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x)
-    - b7 (x) - b8 (x) - b9 (x) - b10 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x)
+    - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x);
   return 1;
 }
 
@@ -2782,10 +3040,12 @@ steps_11_4 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_11_5 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4];
-  long double *x, *r;
+  Real A[4], B[4], C[4], D[4], E[4];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -2802,39 +3062,46 @@ steps_11_5 (Optimize * optimize)        ///< Optimize struct.
   b7 (x) = r[13];
   b6 (x) = r[14];
   b5 (x) = r[15];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) - 10.L * b5 (x) - 12.L * b6 (x)
-    - 14.L * b7 (x) - 18.L * b9 (x) - 20.L * b10 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) - 75.L * b5 (x) - 108.L * b6 (x)
-    - 147.L * b7 (x) - 192.L * b8 (x) - 243.L * b9 (x) - 300.L * b10 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) + 10000.L * a10 (x) - 500.L * b5 (x) - 864.L * b6 (x)
-    - 1372.L * b7 (x) - 2048.L * b8 (x) - 2916.L * b9 (x) - 4000.L * b10 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * (a5 (x) - b5 (x)) + 7776.L * a6 (x) + 16807.L * a7 (x)
-    + 32768.L * a8 (x) + 59049.L * a9 (x) + 100000.L * a10 (x) - 6480.L * b6 (x)
-    - 12005.L * b7 (x) - 20480.L * b8 (x) - 32805.L * b9 (x)
-    - 50000.L * b10 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) - REAL (10.) * b5 (x)
+    - REAL (12.) * b6 (x) - REAL (14.) * b7 (x) - REAL (18.) * b9 (x)
+    - REAL (20.) * b10 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) - REAL (75.) * b5 (x) - REAL (108.) * b6 (x)
+    - REAL (147.) * b7 (x) - REAL (192.) * b8 (x) - REAL (243.) * b9 (x)
+    - REAL (300.) * b10 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    + REAL (10000.) * a10 (x) - REAL (500.) * b5 (x) - REAL (864.) * b6 (x)
+    - REAL (1372.) * b7 (x) - REAL (2048.) * b8 (x) - REAL (2916.) * b9 (x)
+    - REAL (4000.) * b10 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * (a5 (x) - b5 (x))
+    + REAL (7776.) * a6 (x) + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x)
+    + REAL (59049.) * a9 (x) + REAL (100000.) * a10 (x) - REAL (6480.) * b6 (x)
+    - REAL (12005.) * b7 (x) - REAL (20480.) * b8 (x) - REAL (32805.) * b9 (x)
+    - REAL (50000.) * b10 (x);
   solve_4 (A, B, C, D, E);
   b4 (x) = E[3];
   if (isnan (b4 (x)))
@@ -2848,12 +3115,13 @@ steps_11_5 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = E[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x)
-    - b7 (x) - b8 (x) - b9 (x) - b10 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x)
+    - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x);
   return 1;
 }
 
@@ -2863,10 +3131,12 @@ steps_11_5 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_11_6 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[5], B[5], C[5], D[5], E[5], F[5];
-  long double *x, *r;
+  Real A[5], B[5], C[5], D[5], E[5], F[5];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -2882,52 +3152,59 @@ steps_11_6 (Optimize * optimize)        ///< Optimize struct.
   b8 (x) = r[12];
   b7 (x) = r[13];
   b6 (x) = r[14];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) - 12.L * b6 (x) - 14.L * b7 (x)
-    - 18.L * b9 (x) - 20.L * b10 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) - 108.L * b6 (x) - 147.L * b7 (x)
-    - 192.L * b8 (x) - 243.L * b9 (x) - 300.L * b10 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) + 10000.L * a10 (x) - 864.L * b6 (x) - 1372.L * b7 (x)
-    - 2048.L * b8 (x) - 2916.L * b9 (x) - 4000.L * b10 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    + 59049.L * a9 (x) + 100000.L * a10 (x) - 6480.L * b6 (x) - 12005.L * b7 (x)
-    - 20480.L * b8 (x) - 32805.L * b9 (x) - 50000.L * b10 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * (a6 (x) - b6 (x)) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) + 531441.L * a9 (x) + 1000000.L * a10 (x)
-    - 100842.L * b7 (x) - 196608.L * b8 (x) - 354294.L * b9 (x)
-    - 600000.L * b10 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) - REAL (12.) * b6 (x)
+    - REAL (14.) * b7 (x) - REAL (18.) * b9 (x) - REAL (20.) * b10 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) - REAL (108.) * b6 (x) - REAL (147.) * b7 (x)
+    - REAL (192.) * b8 (x) - REAL (243.) * b9 (x) - REAL (300.) * b10 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    + REAL (10000.) * a10 (x) - REAL (864.) * b6 (x) - REAL (1372.) * b7 (x)
+    - REAL (2048.) * b8 (x) - REAL (2916.) * b9 (x) - REAL (4000.) * b10 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) + REAL (59049.) * a9 (x)
+    + REAL (100000.) * a10 (x) - REAL (6480.) * b6 (x) - REAL (12005.) * b7 (x)
+    - REAL (20480.) * b8 (x) - REAL (32805.) * b9 (x)
+    - REAL (50000.) * b10 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x)
+    + REAL (46656.) * (a6 (x) - b6 (x)) + REAL (117649.) * a7 (x)
+    + REAL (262144.) * a8 (x) + REAL (531441.) * a9 (x)
+    + REAL (1000000.) * a10 (x) - REAL (100842.) * b7 (x)
+    - REAL (196608.) * b8 (x) - REAL (354294.) * b9 (x)
+    - REAL (600000.) * b10 (x);
   solve_5 (A, B, C, D, E, F);
   b5 (x) = F[4];
   if (isnan (b5 (x)))
@@ -2944,12 +3221,13 @@ steps_11_6 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = F[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x)
-    - b7 (x) - b8 (x) - b9 (x) - b10 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x)
+    - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x);
   return 1;
 }
 
@@ -2959,10 +3237,12 @@ steps_11_6 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_11_7 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[6], B[6], C[6], D[6], E[6], F[6], G[6];
-  long double *x, *r;
+  Real A[6], B[6], C[6], D[6], E[6], F[6], G[6];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -2977,67 +3257,75 @@ steps_11_7 (Optimize * optimize)        ///< Optimize struct.
   b9 (x) = r[11];
   b8 (x) = r[12];
   b7 (x) = r[13];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = 12.L;
-  G[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) - 14.L * b7 (x) - 18.L * b9 (x)
-    - 20.L * b10 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 108.L;
-  G[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) - 147.L * b7 (x) - 192.L * b8 (x)
-    - 243.L * b9 (x) - 300.L * b10 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = 864.L;
-  G[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) + 10000.L * a10 (x) - 1372.L * b7 (x) - 2048.L * b8 (x)
-    - 2916.L * b9 (x) - 4000.L * b10 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 6480.L;
-  G[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    + 59049.L * a9 (x) + 100000.L * a10 (x) - 12005.L * b7 (x)
-    - 20480.L * b8 (x) - 32805.L * b9 (x) - 50000.L * b10 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = 46656.L;
-  G[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * a6 (x) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) + 531441.L * a9 (x) + 1000000.L * a10 (x)
-    - 100842.L * b7 (x) - 196608.L * b8 (x) - 354294.L * b9 (x)
-    - 600000.L * b10 (x);
-  A[5] = 7.L;
-  B[5] = 448.L;
-  C[5] = 5103.L;
-  D[5] = 28672.L;
-  E[5] = 109375.L;
-  F[5] = 326592.L;
-  G[5] = 1.L + a1 (x) + 128.L * a2 (x) + 2187.L * a3 (x) + 16384.L * a4 (x)
-    + 78125.L * a5 (x) + 279936.L * a6 (x) + 823543.L * (a7 (x) - b7 (x))
-    + 2097152.L * a8 (x) + 4782969.L * a9 (x) + 10000000.L * a10 (x)
-    - 1835008.L * b8 (x) - 3720087.L * b9 (x) - 7000000.L * b10 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = REAL (12.);
+  G[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) - REAL (14.) * b7 (x)
+    - REAL (18.) * b9 (x) - REAL (20.) * b10 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (108.);
+  G[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) - REAL (147.) * b7 (x) - REAL (192.) * b8 (x)
+    - REAL (243.) * b9 (x) - REAL (300.) * b10 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = REAL (864.);
+  G[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    + REAL (10000.) * a10 (x) - REAL (1372.) * b7 (x) - REAL (2048.) * b8 (x)
+    - REAL (2916.) * b9 (x) - REAL (4000.) * b10 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (6480.);
+  G[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) + REAL (59049.) * a9 (x)
+    + REAL (100000.) * a10 (x) - REAL (12005.) * b7 (x)
+    - REAL (20480.) * b8 (x) - REAL (32805.) * b9 (x)
+    - REAL (50000.) * b10 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = REAL (46656.);
+  G[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x) + REAL (46656.) * a6 (x)
+    + REAL (117649.) * a7 (x) + REAL (262144.) * a8 (x)
+    + REAL (531441.) * a9 (x) + REAL (1000000.) * a10 (x)
+    - REAL (100842.) * b7 (x) - REAL (196608.) * b8 (x)
+    - REAL (354294.) * b9 (x) - REAL (600000.) * b10 (x);
+  A[5] = REAL (7.);
+  B[5] = REAL (448.);
+  C[5] = REAL (5103.);
+  D[5] = REAL (28672.);
+  E[5] = REAL (109375.);
+  F[5] = REAL (326592.);
+  G[5] = REAL (1.) + a1 (x) + REAL (128.) * a2 (x) + REAL (2187.) * a3 (x)
+    + REAL (16384.) * a4 (x) + REAL (78125.) * a5 (x) + REAL (279936.) * a6 (x)
+    + REAL (823543.) * (a7 (x) - b7 (x)) + REAL (2097152.) * a8 (x)
+    + REAL (4782969.) * a9 (x) + REAL (10000000.) * a10 (x)
+    - REAL (1835008.) * b8 (x) - REAL (3720087.) * b9 (x)
+    - REAL (7000000.) * b10 (x);
   solve_6 (A, B, C, D, E, F, G);
   b6 (x) = G[5];
   if (isnan (b6 (x)))
@@ -3057,12 +3345,13 @@ steps_11_7 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = G[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x)
-    - b7 (x) - b8 (x) - b9 (x) - b10 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x)
+    - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x);
   return 1;
 }
 
@@ -3072,10 +3361,12 @@ steps_11_7 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_11_8 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[7], B[7], C[7], D[7], E[7], F[7], G[7], H[7];
-  long double *x, *r;
+  Real A[7], B[7], C[7], D[7], E[7], F[7], G[7], H[7];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -3089,82 +3380,93 @@ steps_11_8 (Optimize * optimize)        ///< Optimize struct.
   b10 (x) = r[10];
   b9 (x) = r[11];
   b8 (x) = r[12];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = 12.L;
-  G[0] = 14.L;
-  H[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) - 18.L * b9 (x) - 20.L * b10 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 108.L;
-  G[1] = 147.L;
-  H[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) - 192.L * b8 (x) - 243.L * b9 (x)
-    - 300.L * b10 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = 864.L;
-  G[2] = 1372.L;
-  H[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) + 10000.L * a10 (x) - 2048.L * b8 (x) - 2916.L * b9 (x)
-    - 4000.L * b10 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 6480.L;
-  G[3] = 12005.L;
-  H[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    + 59049.L * a9 (x) + 100000.L * a10 (x) - 20480.L * b8 (x)
-    - 32805.L * b9 (x) - 50000.L * b10 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = 46656.L;
-  G[4] = 100842.L;
-  H[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * a6 (x) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) + 531441.L * a9 (x) + 1000000.L * a10 (x)
-    - 196608.L * b8 (x) - 354294.L * b9 (x) - 600000.L * b10 (x);
-  A[5] = 7.L;
-  B[5] = 448.L;
-  C[5] = 5103.L;
-  D[5] = 28672.L;
-  E[5] = 109375.L;
-  F[5] = 326592.L;
-  G[5] = 823543.L;
-  H[5] = 1.L + a1 (x) + 128.L * a2 (x) + 2187.L * a3 (x) + 16384.L * a4 (x)
-    + 78125.L * a5 (x) + 279936.L * a6 (x) + 823543.L * a7 (x)
-    + 2097152.L * a8 (x) + 4782969.L * a9 (x) + 10000000.L * a10 (x)
-    - 1835008.L * b8 (x) - 3720087.L * b9 (x) - 7000000.L * b10 (x);
-  A[6] = 8.L;
-  B[6] = 1024.L;
-  C[6] = 17496.L;
-  D[6] = 131072.L;
-  E[6] = 625000.L;
-  F[6] = 2239488.L;
-  G[6] = 6588344.L;
-  H[6] = -1.L + a1 (x) + 256.L * a2 (x) + 6561.L * a3 (x) + 65536.L * a4 (x)
-    + 390625.L * a5 (x) + 1679616.L * a6 (x) + 5764801.L * a7 (x)
-    + 16777216.L * (a8 (x) - b8 (x)) + 43046721.L * a9 (x)
-    + 100000000.L * a10 (x) - 38263752.L * b9 (x) - 80000000.L * b10 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = REAL (12.);
+  G[0] = REAL (14.);
+  H[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) - REAL (18.) * b9 (x)
+    - REAL (20.) * b10 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (108.);
+  G[1] = REAL (147.);
+  H[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) - REAL (192.) * b8 (x) - REAL (243.) * b9 (x)
+    - REAL (300.) * b10 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = REAL (864.);
+  G[2] = REAL (1372.);
+  H[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    + REAL (10000.) * a10 (x) - REAL (2048.) * b8 (x) - REAL (2916.) * b9 (x)
+    - REAL (4000.) * b10 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (6480.);
+  G[3] = REAL (12005.);
+  H[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) + REAL (59049.) * a9 (x)
+    + REAL (100000.) * a10 (x) - REAL (20480.) * b8 (x)
+    - REAL (32805.) * b9 (x) - REAL (50000.) * b10 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = REAL (46656.);
+  G[4] = REAL (100842.);
+  H[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x) + REAL (46656.) * a6 (x)
+    + REAL (117649.) * a7 (x) + REAL (262144.) * a8 (x)
+    + REAL (531441.) * a9 (x) + REAL (1000000.) * a10 (x)
+    - REAL (196608.) * b8 (x) - REAL (354294.) * b9 (x)
+    - REAL (600000.) * b10 (x);
+  A[5] = REAL (7.);
+  B[5] = REAL (448.);
+  C[5] = REAL (5103.);
+  D[5] = REAL (28672.);
+  E[5] = REAL (109375.);
+  F[5] = REAL (326592.);
+  G[5] = REAL (823543.);
+  H[5] = REAL (1.) + a1 (x) + REAL (128.) * a2 (x) + REAL (2187.) * a3 (x)
+    + REAL (16384.) * a4 (x) + REAL (78125.) * a5 (x) + REAL (279936.) * a6 (x)
+    + REAL (823543.) * a7 (x) + REAL (2097152.) * a8 (x)
+    + REAL (4782969.) * a9 (x) + REAL (10000000.) * a10 (x)
+    - REAL (1835008.) * b8 (x) - REAL (3720087.) * b9 (x)
+    - REAL (7000000.) * b10 (x);
+  A[6] = REAL (8.);
+  B[6] = REAL (1024.);
+  C[6] = REAL (17496.);
+  D[6] = REAL (131072.);
+  E[6] = REAL (625000.);
+  F[6] = REAL (2239488.);
+  G[6] = REAL (6588344.);
+  H[6] = -REAL (1.) + a1 (x) + REAL (256.) * a2 (x) + REAL (6561.) * a3 (x)
+    + REAL (65536.) * a4 (x) + REAL (390625.) * a5 (x)
+    + REAL (1679616.) * a6 (x) + REAL (5764801.) * a7 (x)
+    + REAL (16777216.) * (a8 (x) - b8 (x)) + REAL (43046721.) * a9 (x)
+    + REAL (100000000.) * a10 (x) - REAL (38263752.) * b9 (x)
+    - REAL (80000000.) * b10 (x);
   solve_7 (A, B, C, D, E, F, G, H);
   b7 (x) = H[6];
   if (isnan (b7 (x)))
@@ -3187,12 +3489,13 @@ steps_11_8 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = H[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x)
-    - b7 (x) - b8 (x) - b9 (x) - b10 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x)
+    - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x);
   return 1;
 }
 
@@ -3202,9 +3505,11 @@ steps_11_8 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_12_2 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *x, *r;
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -3227,18 +3532,22 @@ steps_12_2 (Optimize * optimize)        ///< Optimize struct.
   b3 (x) = r[19];
   b2 (x) = r[20];
   b1 (x)
-    = 0.5L * (a1 (x) + 4.L * (a2 (x) - b2 (x)) + 9.L * a3 (x)
-              + 16.L * (a4 (x) - b8 (x)) + 25.L * a5 (x) + 36.L * a6 (x)
-              + 49.L * a7 (x) + 64.L * a8 (x) + 81.L * a9 (x) + 100.L * a10 (x)
-              + 121.L * a11 (x) - 6.L * b3 (x) - 8.L * b4 (x) - 10.L * b5 (x)
-              - 12.L * b6 (x) - 14.L * b7 (x) - 18.L * b9 (x) - 20.L * b10 (x)
-              - 22.L * b11 (x) - 1.L);
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) + 11.L * a11 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x)
-    - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x) - b11 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x) - a11 (x);
+    = REAL (0.5) * (a1 (x) + REAL (4.) * (a2 (x) - b2 (x)) + REAL (9.) * a3 (x)
+                    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+                    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x)
+                    + REAL (64.) * a8 (x) + REAL (81.) * a9 (x)
+                    + REAL (100.) * a10 (x) + REAL (121.) * a11 (x)
+                    - REAL (6.) * b3 (x) - REAL (8.) * b4 (x)
+                    - REAL (10.) * b5 (x) - REAL (12.) * b6 (x)
+                    - REAL (14.) * b7 (x) - REAL (18.) * b9 (x)
+                    - REAL (20.) * b10 (x) - REAL (22.) * b11 (x) - REAL (1.));
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) + REAL (11.) * a11 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x) - b11 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x) - a11 (x);
   return 1;
 }
 
@@ -3248,10 +3557,12 @@ steps_12_2 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_12_3 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[2], B[2], C[2];
-  long double *x, *r;
+  Real A[2], B[2], C[2];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -3272,20 +3583,24 @@ steps_12_3 (Optimize * optimize)        ///< Optimize struct.
   b5 (x) = r[17];
   b4 (x) = r[18];
   b3 (x) = r[19];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) + 121.L * a11 (x) - 6.L * b3 (x)
-    - 8.L * b4 (x) - 10.L * b5 (x) - 12.L * b6 (x) - 14.L * b7 (x)
-    - 18.L * b9 (x) - 20.L * b10 (x) - 22.L * b11 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * (a3 (x) - b3 (x)) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) + 1331.L * a11 (x) - 48.L * b4 (x)
-    - 75.L * b5 (x) - 108.L * b6 (x) - 147.L * b7 (x) - 192.L * b8 (x)
-    - 243.L * b9 (x) - 300.L * b10 (x) - 363.L * b11 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) + REAL (121.) * a11 (x)
+    - REAL (6.) * b3 (x) - REAL (8.) * b4 (x) - REAL (10.) * b5 (x)
+    - REAL (12.) * b6 (x) - REAL (14.) * b7 (x) - REAL (18.) * b9 (x)
+    - REAL (20.) * b10 (x) - REAL (22.) * b11 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x)
+    + REAL (27.) * (a3 (x) - b3 (x)) + REAL (64.) * a4 (x)
+    + REAL (125.) * a5 (x) + REAL (216.) * a6 (x) + REAL (343.) * a7 (x)
+    + REAL (512.) * a8 (x) + REAL (729.) * a9 (x) + REAL (1000.) * a10 (x)
+    + REAL (1331.) * a11 (x) - REAL (48.) * b4 (x) - REAL (75.) * b5 (x)
+    - REAL (108.) * b6 (x) - REAL (147.) * b7 (x) - REAL (192.) * b8 (x)
+    - REAL (243.) * b9 (x) - REAL (300.) * b10 (x) - REAL (363.) * b11 (x);
   solve_2 (A, B, C);
   b2 (x) = C[1];
   if (isnan (b2 (x)))
@@ -3293,12 +3608,13 @@ steps_12_3 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = C[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) + 11.L * a11 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x)
-    - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x) - b11 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x) - a11 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) + REAL (11.) * a11 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x) - b11 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x) - a11 (x);
   return 1;
 }
 
@@ -3308,10 +3624,12 @@ steps_12_3 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_12_4 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[3], B[3], C[3], D[3];
-  long double *x, *r;
+  Real A[3], B[3], C[3], D[3];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -3331,30 +3649,36 @@ steps_12_4 (Optimize * optimize)        ///< Optimize struct.
   b6 (x) = r[16];
   b5 (x) = r[17];
   b4 (x) = r[18];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) + 121.L * a11 (x) - 8.L * b4 (x)
-    - 10.L * b5 (x) - 12.L * b6 (x) - 14.L * b7 (x) - 18.L * b9 (x)
-    - 20.L * b10 (x) - 22.L * b11 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) + 1331.L * a11 (x) - 48.L * b4 (x)
-    - 75.L * b5 (x) - 108.L * b6 (x) - 147.L * b7 (x) - 192.L * b8 (x)
-    - 243.L * b9 (x) - 300.L * b10 (x) - 363.L * b11 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x)
-    + 256.L * (a4 (x) - b4 (x)) + 625.L * a5 (x) + 1296.L * a6 (x)
-    + 2401.L * a7 (x) + 4096.L * a8 (x) + 6561.L * a9 (x) + 10000.L * a10 (x)
-    + 14641.L * a11 (x) - 500.L * b5 (x) - 864.L * b6 (x) - 1372.L * b7 (x)
-    - 2048.L * b8 (x) - 2916.L * b9 (x) - 4000.L * b10 (x) - 5324.L * b11 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) + REAL (121.) * a11 (x)
+    - REAL (8.) * b4 (x) - REAL (10.) * b5 (x) - REAL (12.) * b6 (x)
+    - REAL (14.) * b7 (x) - REAL (18.) * b9 (x) - REAL (20.) * b10 (x)
+    - REAL (22.) * b11 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) + REAL (1331.) * a11 (x) - REAL (48.) * b4 (x)
+    - REAL (75.) * b5 (x) - REAL (108.) * b6 (x) - REAL (147.) * b7 (x)
+    - REAL (192.) * b8 (x) - REAL (243.) * b9 (x) - REAL (300.) * b10 (x)
+    - REAL (363.) * b11 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * (a4 (x) - b4 (x)) + REAL (625.) * a5 (x)
+    + REAL (1296.) * a6 (x) + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x)
+    + REAL (6561.) * a9 (x) + REAL (10000.) * a10 (x) + REAL (14641.) * a11 (x)
+    - REAL (500.) * b5 (x) - REAL (864.) * b6 (x) - REAL (1372.) * b7 (x)
+    - REAL (2048.) * b8 (x) - REAL (2916.) * b9 (x) - REAL (4000.) * b10 (x)
+    - REAL (5324.) * b11 (x);
   solve_3 (A, B, C, D);
   b3 (x) = D[2];
   if (isnan (b3 (x)))
@@ -3365,12 +3689,13 @@ steps_12_4 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = D[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) + 11.L * a11 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x)
-    - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x) - b11 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x) - a11 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) + REAL (11.) * a11 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x) - b11 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x) - a11 (x);
   return 1;
 }
 
@@ -3380,10 +3705,12 @@ steps_12_4 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_12_5 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4];
-  long double *x, *r;
+  Real A[4], B[4], C[4], D[4], E[4];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -3402,42 +3729,47 @@ steps_12_5 (Optimize * optimize)        ///< Optimize struct.
   b7 (x) = r[15];
   b6 (x) = r[16];
   b5 (x) = r[17];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) + 121.L * a11 (x) - 10.L * b5 (x)
-    - 12.L * b6 (x) - 14.L * b7 (x) - 18.L * b9 (x) - 20.L * b10 (x)
-    - 22.L * b11 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) + 1331.L * a11 (x) - 75.L * b5 (x)
-    - 108.L * b6 (x) - 147.L * b7 (x) - 192.L * b8 (x) - 243.L * b9 (x)
-    - 300.L * b10 (x) - 363.L * b11 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) + 10000.L * a10 (x) + 14641.L * a11 (x) - 500.L * b5 (x)
-    - 864.L * b6 (x) - 1372.L * b7 (x) - 2048.L * b8 (x) - 2916.L * b9 (x)
-    - 4000.L * b10 (x) - 5324.L * b11 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * (a5 (x) - b5 (x)) + 7776.L * a6 (x) + 16807.L * a7 (x)
-    + 32768.L * a8 (x) + 59049.L * a9 (x) + 100000.L * a10 (x)
-    + 161051.L * a11 (x) - 6480.L * b6 (x) - 12005.L * b7 (x) - 20480.L * b8 (x)
-    - 32805.L * b9 (x) - 50000.L * b10 (x) - 73205.L * b11 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) + REAL (121.) * a11 (x)
+    - REAL (10.) * b5 (x) - REAL (12.) * b6 (x) - REAL (14.) * b7 (x)
+    - REAL (18.) * b9 (x) - REAL (20.) * b10 (x) - REAL (22.) * b11 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) + REAL (1331.) * a11 (x) - REAL (75.) * b5 (x)
+    - REAL (108.) * b6 (x) - REAL (147.) * b7 (x) - REAL (192.) * b8 (x)
+    - REAL (243.) * b9 (x) - REAL (300.) * b10 (x) - REAL (363.) * b11 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    + REAL (10000.) * a10 (x) + REAL (14641.) * a11 (x) - REAL (500.) * b5 (x)
+    - REAL (864.) * b6 (x) - REAL (1372.) * b7 (x) - REAL (2048.) * b8 (x)
+    - REAL (2916.) * b9 (x) - REAL (4000.) * b10 (x) - REAL (5324.) * b11 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * (a5 (x) - b5 (x))
+    + REAL (7776.) * a6 (x) + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x)
+    + REAL (59049.) * a9 (x) + REAL (100000.) * a10 (x)
+    + REAL (161051.) * a11 (x) - REAL (6480.) * b6 (x) - REAL (12005.) * b7 (x)
+    - REAL (20480.) * b8 (x) - REAL (32805.) * b9 (x) - REAL (50000.) * b10 (x)
+    - REAL (73205.) * b11 (x);
   solve_4 (A, B, C, D, E);
   b4 (x) = E[3];
   if (isnan (b4 (x)))
@@ -3451,12 +3783,13 @@ steps_12_5 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = E[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) + 11.L * a11 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x)
-    - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x) - b11 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x) - a11 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) + REAL (11.) * a11 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x) - b11 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x) - a11 (x);
   return 1;
 }
 
@@ -3466,10 +3799,12 @@ steps_12_5 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_12_6 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[5], B[5], C[5], D[5], E[5], F[5];
-  long double *x, *r;
+  Real A[5], B[5], C[5], D[5], E[5], F[5];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -3487,55 +3822,64 @@ steps_12_6 (Optimize * optimize)        ///< Optimize struct.
   b8 (x) = r[14];
   b7 (x) = r[15];
   b6 (x) = r[16];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) + 121.L * a11 (x) - 12.L * b6 (x)
-    - 14.L * b7 (x) - 18.L * b9 (x) - 20.L * b10 (x) - 22.L * b11 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) + 1331.L * a11 (x) - 108.L * b6 (x)
-    - 147.L * b7 (x) - 192.L * b8 (x) - 243.L * b9 (x) - 300.L * b10 (x)
-    - 363.L * b11 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) + 10000.L * a10 (x) + 14641.L * a11 (x) - 864.L * b6 (x)
-    - 1372.L * b7 (x) - 2048.L * b8 (x) - 2916.L * b9 (x) - 4000.L * b10 (x)
-    - 5324.L * b11 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    + 59049.L * a9 (x) + 100000.L * a10 (x) + 161051.L * a11 (x)
-    - 6480.L * b6 (x) - 12005.L * b7 (x) - 20480.L * b8 (x) - 32805.L * b9 (x)
-    - 50000.L * b10 (x) - 73205.L * b11 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * (a6 (x) - b6 (x)) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) + 531441.L * a9 (x) + 1000000.L * a10 (x)
-    + 1771561.L * a11 (x) - 100842.L * b7 (x) - 196608.L * b8 (x)
-    - 354294.L * b9 (x) - 600000.L * b10 (x) - 966306.L * b11 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) + REAL (121.) * a11 (x)
+    - REAL (12.) * b6 (x) - REAL (14.) * b7 (x) - REAL (18.) * b9 (x)
+    - REAL (20.) * b10 (x) - REAL (22.) * b11 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) + REAL (1331.) * a11 (x) - REAL (108.) * b6 (x)
+    - REAL (147.) * b7 (x) - REAL (192.) * b8 (x) - REAL (243.) * b9 (x)
+    - REAL (300.) * b10 (x) - REAL (363.) * b11 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    + REAL (10000.) * a10 (x) + REAL (14641.) * a11 (x) - REAL (864.) * b6 (x)
+    - REAL (1372.) * b7 (x) - REAL (2048.) * b8 (x) - REAL (2916.) * b9 (x)
+    - REAL (4000.) * b10 (x) - REAL (5324.) * b11 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) + REAL (59049.) * a9 (x)
+    + REAL (100000.) * a10 (x) + REAL (161051.) * a11 (x)
+    - REAL (6480.) * b6 (x) - REAL (12005.) * b7 (x) - REAL (20480.) * b8 (x)
+    - REAL (32805.) * b9 (x) - REAL (50000.) * b10 (x)
+    - REAL (73205.) * b11 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x)
+    + REAL (46656.) * (a6 (x) - b6 (x)) + REAL (117649.) * a7 (x)
+    + REAL (262144.) * a8 (x) + REAL (531441.) * a9 (x)
+    + REAL (1000000.) * a10 (x) + REAL (1771561.) * a11 (x)
+    - REAL (100842.) * b7 (x) - REAL (196608.) * b8 (x)
+    - REAL (354294.) * b9 (x) - REAL (600000.) * b10 (x)
+    - REAL (966306.) * b11 (x);
   solve_5 (A, B, C, D, E, F);
   b5 (x) = F[4];
   if (isnan (b5 (x)))
@@ -3552,12 +3896,13 @@ steps_12_6 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = F[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) + 11.L * a11 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x)
-    - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x) - b11 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x) - a11 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) + REAL (11.) * a11 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x) - b11 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x) - a11 (x);
   return 1;
 }
 
@@ -3567,10 +3912,12 @@ steps_12_6 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_12_7 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[6], B[6], C[6], D[6], E[6], F[6], G[6];
-  long double *x, *r;
+  Real A[6], B[6], C[6], D[6], E[6], F[6], G[6];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -3587,69 +3934,80 @@ steps_12_7 (Optimize * optimize)        ///< Optimize struct.
   b9 (x) = r[13];
   b8 (x) = r[14];
   b7 (x) = r[15];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = 12.L;
-  G[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) + 121.L * a11 (x) - 14.L * b7 (x)
-    - 18.L * b9 (x) - 20.L * b10 (x) - 22.L * b11 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 108.L;
-  G[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) + 1331.L * a11 (x) - 147.L * b7 (x)
-    - 192.L * b8 (x) - 243.L * b9 (x) - 300.L * b10 (x) - 363.L * b11 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = 864.L;
-  G[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) + 10000.L * a10 (x) + 14641.L * a11 (x) - 1372.L * b7 (x)
-    - 2048.L * b8 (x) - 2916.L * b9 (x) - 4000.L * b10 (x) - 5324.L * b11 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 6480.L;
-  G[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    + 59049.L * a9 (x) + 100000.L * a10 (x) + 161051.L * a11 (x)
-    - 12005.L * b7 (x) - 20480.L * b8 (x) - 32805.L * b9 (x) - 50000.L * b10 (x)
-    - 73205.L * b11 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = 46656.L;
-  G[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * a6 (x) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) + 531441.L * a9 (x) + 1000000.L * a10 (x)
-    + 1771561.L * a11 (x) - 100842.L * b7 (x) - 196608.L * b8 (x)
-    - 354294.L * b9 (x) - 600000.L * b10 (x) - 966306.L * b11 (x);
-  A[5] = 7.L;
-  B[5] = 448.L;
-  C[5] = 5103.L;
-  D[5] = 28672.L;
-  E[5] = 109375.L;
-  F[5] = 326592.L;
-  G[5] = 1.L + a1 (x) + 128.L * a2 (x) + 2187.L * a3 (x) + 16384.L * a4 (x)
-    + 78125.L * a5 (x) + 279936.L * a6 (x) + 823543.L * (a7 (x) - b7 (x))
-    + 2097152.L * a8 (x) + 4782969.L * a9 (x) + 10000000.L * a10 (x)
-    + 19487171.L * a11 (x) - 1835008.L * b8 (x) - 3720087.L * b9 (x)
-    - 7000000.L * b10 (x) - 12400927.L * b11 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = REAL (12.);
+  G[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) + REAL (121.) * a11 (x)
+    - REAL (14.) * b7 (x) - REAL (18.) * b9 (x) - REAL (20.) * b10 (x)
+    - REAL (22.) * b11 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (108.);
+  G[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) + REAL (1331.) * a11 (x) - REAL (147.) * b7 (x)
+    - REAL (192.) * b8 (x) - REAL (243.) * b9 (x) - REAL (300.) * b10 (x)
+    - REAL (363.) * b11 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = REAL (864.);
+  G[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    + REAL (10000.) * a10 (x) + REAL (14641.) * a11 (x) - REAL (1372.) * b7 (x)
+    - REAL (2048.) * b8 (x) - REAL (2916.) * b9 (x) - REAL (4000.) * b10 (x)
+    - REAL (5324.) * b11 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (6480.);
+  G[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) + REAL (59049.) * a9 (x)
+    + REAL (100000.) * a10 (x) + REAL (161051.) * a11 (x)
+    - REAL (12005.) * b7 (x) - REAL (20480.) * b8 (x) - REAL (32805.) * b9 (x)
+    - REAL (50000.) * b10 (x) - REAL (73205.) * b11 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = REAL (46656.);
+  G[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x) + REAL (46656.) * a6 (x)
+    + REAL (117649.) * a7 (x) + REAL (262144.) * a8 (x)
+    + REAL (531441.) * a9 (x) + REAL (1000000.) * a10 (x)
+    + REAL (1771561.) * a11 (x) - REAL (100842.) * b7 (x)
+    - REAL (196608.) * b8 (x) - REAL (354294.) * b9 (x)
+    - REAL (600000.) * b10 (x) - REAL (966306.) * b11 (x);
+  A[5] = REAL (7.);
+  B[5] = REAL (448.);
+  C[5] = REAL (5103.);
+  D[5] = REAL (28672.);
+  E[5] = REAL (109375.);
+  F[5] = REAL (326592.);
+  G[5] = REAL (1.) + a1 (x) + REAL (128.) * a2 (x) + REAL (2187.) * a3 (x)
+    + REAL (16384.) * a4 (x) + REAL (78125.) * a5 (x) + REAL (279936.) * a6 (x)
+    + REAL (823543.) * (a7 (x) - b7 (x)) + REAL (2097152.) * a8 (x)
+    + REAL (4782969.) * a9 (x) + REAL (10000000.) * a10 (x)
+    + REAL (19487171.) * a11 (x) - REAL (1835008.) * b8 (x)
+    - REAL (3720087.) * b9 (x) - REAL (7000000.) * b10 (x)
+    - REAL (12400927.) * b11 (x);
   solve_6 (A, B, C, D, E, F, G);
   b6 (x) = G[5];
   if (isnan (b6 (x)))
@@ -3669,12 +4027,13 @@ steps_12_7 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = G[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) + 11.L * a11 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x)
-    - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x) - b11 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x) - a11 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) + REAL (11.) * a11 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x) - b11 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x) - a11 (x);
   return 1;
 }
 
@@ -3684,10 +4043,12 @@ steps_12_7 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_12_8 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[7], B[7], C[7], D[7], E[7], F[7], G[7], H[7];
-  long double *x, *r;
+  Real A[7], B[7], C[7], D[7], E[7], F[7], G[7], H[7];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -3703,87 +4064,97 @@ steps_12_8 (Optimize * optimize)        ///< Optimize struct.
   b10 (x) = r[12];
   b9 (x) = r[13];
   b8 (x) = r[14];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = 12.L;
-  G[0] = 14.L;
-  H[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) + 121.L * a11 (x) - 18.L * b9 (x)
-    - 20.L * b10 (x) - 22.L * b11 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 108.L;
-  G[1] = 147.L;
-  H[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) + 1331.L * a11 (x) - 192.L * b8 (x)
-    - 243.L * b9 (x) - 300.L * b10 (x) - 363.L * b11 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = 864.L;
-  G[2] = 1372.L;
-  H[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) + 10000.L * a10 (x) + 14641.L * a11 (x) - 2048.L * b8 (x)
-    - 2916.L * b9 (x) - 4000.L * b10 (x) - 5324.L * b11 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 6480.L;
-  G[3] = 12005.L;
-  H[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    + 59049.L * a9 (x) + 100000.L * a10 (x) + 161051.L * a11 (x)
-    - 20480.L * b8 (x) - 32805.L * b9 (x) - 50000.L * b10 (x)
-    - 73205.L * b11 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = 46656.L;
-  G[4] = 100842.L;
-  H[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * a6 (x) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) + 531441.L * a9 (x) + 1000000.L * a10 (x)
-    + 1771561.L * a11 (x) - 196608.L * b8 (x) - 354294.L * b9 (x)
-    - 600000.L * b10 (x) - 966306.L * b11 (x);
-  A[5] = 7.L;
-  B[5] = 448.L;
-  C[5] = 5103.L;
-  D[5] = 28672.L;
-  E[5] = 109375.L;
-  F[5] = 326592.L;
-  G[5] = 823543.L;
-  H[5] = 1.L + a1 (x) + 128.L * a2 (x) + 2187.L * a3 (x) + 16384.L * a4 (x)
-    + 78125.L * a5 (x) + 279936.L * a6 (x) + 823543.L * a7 (x)
-    + 2097152.L * a8 (x) + 4782969.L * a9 (x) + 10000000.L * a10 (x)
-    + 19487171.L * a11 (x) - 1835008.L * b8 (x) - 3720087.L * b9 (x)
-    - 7000000.L * b10 (x) - 12400927.L * b11 (x);
-  A[6] = 8.L;
-  B[6] = 1024.L;
-  C[6] = 17496.L;
-  D[6] = 131072.L;
-  E[6] = 625000.L;
-  F[6] = 2239488.L;
-  G[6] = 6588344.L;
-  H[6] = -1.L + a1 (x) + 256.L * a2 (x) + 6561.L * a3 (x) + 65536.L * a4 (x)
-    + 390625.L * a5 (x) + 1679616.L * a6 (x) + 5764801.L * a7 (x)
-    + 16777216.L * (a8 (x) - b8 (x)) + 43046721.L * a9 (x)
-    + 100000000.L * a10 (x) + 214358881.L * a11 (x) - 38263752.L * b9 (x)
-    - 80000000.L * b10 (x) - 155897368.L * b11 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = REAL (12.);
+  G[0] = REAL (14.);
+  H[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) + REAL (121.) * a11 (x)
+    - REAL (18.) * b9 (x) - REAL (20.) * b10 (x) - REAL (22.) * b11 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (108.);
+  G[1] = REAL (147.);
+  H[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) + REAL (1331.) * a11 (x) - REAL (192.) * b8 (x)
+    - REAL (243.) * b9 (x) - REAL (300.) * b10 (x) - REAL (363.) * b11 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = REAL (864.);
+  G[2] = REAL (1372.);
+  H[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    + REAL (10000.) * a10 (x) + REAL (14641.) * a11 (x) - REAL (2048.) * b8 (x)
+    - REAL (2916.) * b9 (x) - REAL (4000.) * b10 (x) - REAL (5324.) * b11 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (6480.);
+  G[3] = REAL (12005.);
+  H[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) + REAL (59049.) * a9 (x)
+    + REAL (100000.) * a10 (x) + REAL (161051.) * a11 (x)
+    - REAL (20480.) * b8 (x) - REAL (32805.) * b9 (x) - REAL (50000.) * b10 (x)
+    - REAL (73205.) * b11 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = REAL (46656.);
+  G[4] = REAL (100842.);
+  H[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x) + REAL (46656.) * a6 (x)
+    + REAL (117649.) * a7 (x) + REAL (262144.) * a8 (x)
+    + REAL (531441.) * a9 (x) + REAL (1000000.) * a10 (x)
+    + REAL (1771561.) * a11 (x) - REAL (196608.) * b8 (x)
+    - REAL (354294.) * b9 (x) - REAL (600000.) * b10 (x)
+    - REAL (966306.) * b11 (x);
+  A[5] = REAL (7.);
+  B[5] = REAL (448.);
+  C[5] = REAL (5103.);
+  D[5] = REAL (28672.);
+  E[5] = REAL (109375.);
+  F[5] = REAL (326592.);
+  G[5] = REAL (823543.);
+  H[5] = REAL (1.) + a1 (x) + REAL (128.) * a2 (x) + REAL (2187.) * a3 (x)
+    + REAL (16384.) * a4 (x) + REAL (78125.) * a5 (x) + REAL (279936.) * a6 (x)
+    + REAL (823543.) * a7 (x) + REAL (2097152.) * a8 (x)
+    + REAL (4782969.) * a9 (x) + REAL (10000000.) * a10 (x)
+    + REAL (19487171.) * a11 (x) - REAL (1835008.) * b8 (x)
+    - REAL (3720087.) * b9 (x) - REAL (7000000.) * b10 (x)
+    - REAL (12400927.) * b11 (x);
+  A[6] = REAL (8.);
+  B[6] = REAL (1024.);
+  C[6] = REAL (17496.);
+  D[6] = REAL (131072.);
+  E[6] = REAL (625000.);
+  F[6] = REAL (2239488.);
+  G[6] = REAL (6588344.);
+  H[6] = -REAL (1.) + a1 (x) + REAL (256.) * a2 (x) + REAL (6561.) * a3 (x)
+    + REAL (65536.) * a4 (x) + REAL (390625.) * a5 (x)
+    + REAL (1679616.) * a6 (x) + REAL (5764801.) * a7 (x)
+    + REAL (16777216.) * (a8 (x) - b8 (x)) + REAL (43046721.) * a9 (x)
+    + REAL (100000000.) * a10 (x) + REAL (214358881.) * a11 (x)
+    - REAL (38263752.) * b9 (x) - REAL (80000000.) * b10 (x)
+    - REAL (155897368.) * b11 (x);
   solve_7 (A, B, C, D, E, F, G, H);
   b7 (x) = H[6];
   if (isnan (b7 (x)))
@@ -3806,12 +4177,13 @@ steps_12_8 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = H[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) + 11.L * a11 (x) - b1 (x) - b2 (x) - b3 (x) - b4 (x)
-    - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x) - b11 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x) - a11 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) + REAL (11.) * a11 (x) - b1 (x) - b2 (x) - b3 (x)
+    - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x) - b11 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x) - a11 (x);
   return 1;
 }
 
@@ -3821,9 +4193,11 @@ steps_12_8 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_13_2 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double *x, *r;
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -3848,19 +4222,24 @@ steps_13_2 (Optimize * optimize)        ///< Optimize struct.
   b3 (x) = r[21];
   b2 (x) = r[22];
   b1 (x)
-    = 0.5L * (a1 (x) + 4.L * (a2 (x) - b2 (x)) + 9.L * a3 (x)
-              + 16.L * (a4 (x) - b8 (x)) + 25.L * a5 (x) + 36.L * a6 (x)
-              + 49.L * a7 (x) + 64.L * a8 (x) + 81.L * a9 (x) + 100.L * a10 (x)
-              + 121.L * a11 (x) + 144.L * a12 (x) - 6.L * b3 (x) - 8.L * b4 (x)
-              - 10.L * b5 (x) - 12.L * b6 (x) - 14.L * b7 (x) - 18.L * b9 (x)
-              - 20.L * b10 (x) - 22.L * b11 (x) - 24.L * b12 (x) - 1.L);
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) + 11.L * a11 (x) + 12.L * a12 (x) - b1 (x) - b2 (x)
-    - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x)
-    - b11 (x) - b12 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x) - a11 (x) - a12 (x);
+    = REAL (0.5) * (a1 (x) + REAL (4.) * (a2 (x) - b2 (x)) + REAL (9.) * a3 (x)
+                    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+                    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x)
+                    + REAL (64.) * a8 (x) + REAL (81.) * a9 (x)
+                    + REAL (100.) * a10 (x) + REAL (121.) * a11 (x)
+                    + REAL (144.) * a12 (x) - REAL (6.) * b3 (x)
+                    - REAL (8.) * b4 (x) - REAL (10.) * b5 (x)
+                    - REAL (12.) * b6 (x) - REAL (14.) * b7 (x)
+                    - REAL (18.) * b9 (x) - REAL (20.) * b10 (x)
+                    - REAL (22.) * b11 (x) - REAL (24.) * b12 (x) - REAL (1.));
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) + REAL (11.) * a11 (x) + REAL (12.) * a12 (x)
+    - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x)
+    - b9 (x) - b10 (x) - b11 (x) - b12 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x) - a11 (x) - a12 (x);
   return 1;
 }
 
@@ -3870,10 +4249,12 @@ steps_13_2 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_13_3 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[2], B[2], C[2];
-  long double *x, *r;
+  Real A[2], B[2], C[2];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -3896,22 +4277,26 @@ steps_13_3 (Optimize * optimize)        ///< Optimize struct.
   b5 (x) = r[19];
   b4 (x) = r[20];
   b3 (x) = r[21];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) + 121.L * a11 (x) + 144.L * a12 (x)
-    - 6.L * b3 (x) - 8.L * b4 (x) - 10.L * b5 (x) - 12.L * b6 (x)
-    - 14.L * b7 (x) - 18.L * b9 (x) - 20.L * b10 (x) - 22.L * b11 (x)
-    - 24.L * b12 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * (a3 (x) - b3 (x)) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) + 1331.L * a11 (x) + 1728.L * a12 (x)
-    - 48.L * b4 (x) - 75.L * b5 (x) - 108.L * b6 (x) - 147.L * b7 (x)
-    - 192.L * b8 (x) - 243.L * b9 (x) - 300.L * b10 (x) - 363.L * b11 (x)
-    - 432.L * b12 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) + REAL (121.) * a11 (x)
+    + REAL (144.) * a12 (x) - REAL (6.) * b3 (x) - REAL (8.) * b4 (x)
+    - REAL (10.) * b5 (x) - REAL (12.) * b6 (x) - REAL (14.) * b7 (x)
+    - REAL (18.) * b9 (x) - REAL (20.) * b10 (x) - REAL (22.) * b11 (x)
+    - REAL (24.) * b12 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x)
+    + REAL (27.) * (a3 (x) - b3 (x)) + REAL (64.) * a4 (x)
+    + REAL (125.) * a5 (x) + REAL (216.) * a6 (x) + REAL (343.) * a7 (x)
+    + REAL (512.) * a8 (x) + REAL (729.) * a9 (x) + REAL (1000.) * a10 (x)
+    + REAL (1331.) * a11 (x) + REAL (1728.) * a12 (x) - REAL (48.) * b4 (x)
+    - REAL (75.) * b5 (x) - REAL (108.) * b6 (x) - REAL (147.) * b7 (x)
+    - REAL (192.) * b8 (x) - REAL (243.) * b9 (x) - REAL (300.) * b10 (x)
+    - REAL (363.) * b11 (x) - REAL (432.) * b12 (x);
   solve_2 (A, B, C);
   b2 (x) = C[1];
   if (isnan (b2 (x)))
@@ -3919,13 +4304,14 @@ steps_13_3 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = C[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) + 11.L * a11 (x) + 12.L * a12 (x) - b1 (x) - b2 (x)
-    - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x)
-    - b11 (x) - b12 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x) - a11 (x) - a12 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) + REAL (11.) * a11 (x) + REAL (12.) * a12 (x)
+    - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x)
+    - b9 (x) - b10 (x) - b11 (x) - b12 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x) - a11 (x) - a12 (x);
   return 1;
 }
 
@@ -3935,10 +4321,12 @@ steps_13_3 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_13_4 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[3], B[3], C[3], D[3];
-  long double *x, *r;
+  Real A[3], B[3], C[3], D[3];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -3960,32 +4348,36 @@ steps_13_4 (Optimize * optimize)        ///< Optimize struct.
   b6 (x) = r[18];
   b5 (x) = r[19];
   b4 (x) = r[20];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) + 121.L * a11 (x) + 144.L * a12 (x)
-    - 8.L * b4 (x) - 10.L * b5 (x) - 12.L * b6 (x) - 14.L * b7 (x)
-    - 18.L * b9 (x) - 20.L * b10 (x) - 22.L * b11 (x) - 24.L * b12 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) + 1331.L * a11 (x) + 1728.L * a12 (x)
-    - 48.L * b4 (x) - 75.L * b5 (x) - 108.L * b6 (x) - 147.L * b7 (x)
-    - 192.L * b8 (x) - 243.L * b9 (x) - 300.L * b10 (x) - 363.L * b11 (x)
-    - 432.L * b12 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x)
-    + 256.L * (a4 (x) - b4 (x)) + 625.L * a5 (x) + 1296.L * a6 (x)
-    + 2401.L * a7 (x) + 4096.L * a8 (x) + 6561.L * a9 (x) + 10000.L * a10 (x)
-    + 14641.L * a11 (x) + 20736.L * a12 (x) - 500.L * b5 (x) - 864.L * b6 (x)
-    - 1372.L * b7 (x) - 2048.L * b8 (x) - 2916.L * b9 (x) - 4000.L * b10 (x)
-    - 5324.L * b11 (x) - 6912.L * b12 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) + REAL (121.) * a11 (x)
+    + REAL (144.) * a12 (x) - REAL (8.) * b4 (x) - REAL (10.) * b5 (x)
+    - REAL (12.) * b6 (x) - REAL (14.) * b7 (x) - REAL (18.) * b9 (x)
+    - REAL (20.) * b10 (x) - REAL (22.) * b11 (x) - REAL (24.) * b12 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) + REAL (1331.) * a11 (x) + REAL (1728.) * a12 (x)
+    - REAL (48.) * b4 (x) - REAL (75.) * b5 (x) - REAL (108.) * b6 (x)
+    - REAL (147.) * b7 (x) - REAL (192.) * b8 (x) - REAL (243.) * b9 (x)
+    - REAL (300.) * b10 (x) - REAL (363.) * b11 (x) - REAL (432.) * b12 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * (a4 (x) - b4 (x)) + REAL (625.) * a5 (x)
+    + REAL (1296.) * a6 (x) + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x)
+    + REAL (6561.) * a9 (x) + REAL (10000.) * a10 (x) + REAL (14641.) * a11 (x)
+    + REAL (20736.) * a12 (x) - REAL (500.) * b5 (x) - REAL (864.) * b6 (x)
+    - REAL (1372.) * b7 (x) - REAL (2048.) * b8 (x) - REAL (2916.) * b9 (x)
+    - REAL (4000.) * b10 (x) - REAL (5324.) * b11 (x) - REAL (6912.) * b12 (x);
   solve_3 (A, B, C, D);
   b3 (x) = D[2];
   if (isnan (b3 (x)))
@@ -3996,13 +4388,14 @@ steps_13_4 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = D[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) + 11.L * a11 (x) + 12.L * a12 (x) - b1 (x) - b2 (x)
-    - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x)
-    - b11 (x) - b12 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x) - a11 (x) - a12 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) + REAL (11.) * a11 (x) + REAL (12.) * a12 (x)
+    - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x)
+    - b9 (x) - b10 (x) - b11 (x) - b12 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x) - a11 (x) - a12 (x);
   return 1;
 }
 
@@ -4012,10 +4405,12 @@ steps_13_4 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_13_5 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[4], B[4], C[4], D[4], E[4];
-  long double *x, *r;
+  Real A[4], B[4], C[4], D[4], E[4];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -4036,44 +4431,51 @@ steps_13_5 (Optimize * optimize)        ///< Optimize struct.
   b7 (x) = r[17];
   b6 (x) = r[18];
   b5 (x) = r[19];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) + 121.L * a11 (x) + 144.L * a12 (x)
-    - 10.L * b5 (x) - 12.L * b6 (x) - 14.L * b7 (x) - 18.L * b9 (x)
-    - 20.L * b10 (x) - 22.L * b11 (x) - 24.L * b12 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) + 1331.L * a11 (x) + 1728.L * a12 (x)
-    - 75.L * b5 (x) - 108.L * b6 (x) - 147.L * b7 (x) - 192.L * b8 (x)
-    - 243.L * b9 (x) - 300.L * b10 (x) - 363.L * b11 (x) - 432.L * b12 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) + 10000.L * a10 (x) + 14641.L * a11 (x)
-    + 20736.L * a12 (x) - 500.L * b5 (x) - 864.L * b6 (x) - 1372.L * b7 (x)
-    - 2048.L * b8 (x) - 2916.L * b9 (x) - 4000.L * b10 (x) - 5324.L * b11 (x)
-    - 6912.L * b12 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * (a5 (x) - b5 (x)) + 7776.L * a6 (x) + 16807.L * a7 (x)
-    + 32768.L * a8 (x) + 59049.L * a9 (x) + 100000.L * a10 (x)
-    + 161051.L * a11 (x) + 248832.L * a12 (x) - 6480.L * b6 (x)
-    - 12005.L * b7 (x) - 20480.L * b8 (x) - 32805.L * b9 (x) - 50000.L * b10 (x)
-    - 73205.L * b11 (x) - 103680.L * b12 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) + REAL (121.) * a11 (x)
+    + REAL (144.) * a12 (x) - REAL (10.) * b5 (x) - REAL (12.) * b6 (x)
+    - REAL (14.) * b7 (x) - REAL (18.) * b9 (x) - REAL (20.) * b10 (x)
+    - REAL (22.) * b11 (x) - REAL (24.) * b12 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) + REAL (1331.) * a11 (x) + REAL (1728.) * a12 (x)
+    - REAL (75.) * b5 (x) - REAL (108.) * b6 (x) - REAL (147.) * b7 (x)
+    - REAL (192.) * b8 (x) - REAL (243.) * b9 (x) - REAL (300.) * b10 (x)
+    - REAL (363.) * b11 (x) - REAL (432.) * b12 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    + REAL (10000.) * a10 (x) + REAL (14641.) * a11 (x)
+    + REAL (20736.) * a12 (x) - REAL (500.) * b5 (x) - REAL (864.) * b6 (x)
+    - REAL (1372.) * b7 (x) - REAL (2048.) * b8 (x) - REAL (2916.) * b9 (x)
+    - REAL (4000.) * b10 (x) - REAL (5324.) * b11 (x) - REAL (6912.) * b12 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * (a5 (x) - b5 (x))
+    + REAL (7776.) * a6 (x) + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x)
+    + REAL (59049.) * a9 (x) + REAL (100000.) * a10 (x)
+    + REAL (161051.) * a11 (x) + REAL (248832.) * a12 (x)
+    - REAL (6480.) * b6 (x) - REAL (12005.) * b7 (x) - REAL (20480.) * b8 (x)
+    - REAL (32805.) * b9 (x) - REAL (50000.) * b10 (x)
+    - REAL (73205.) * b11 (x) - REAL (103680.) * b12 (x);
   solve_4 (A, B, C, D, E);
   b4 (x) = E[3];
   if (isnan (b4 (x)))
@@ -4087,13 +4489,14 @@ steps_13_5 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = E[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) + 11.L * a11 (x) + 12.L * a12 (x) - b1 (x) - b2 (x)
-    - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x)
-    - b11 (x) - b12 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x) - a11 (x) - a12 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) + REAL (11.) * a11 (x) + REAL (12.) * a12 (x)
+    - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x)
+    - b9 (x) - b10 (x) - b11 (x) - b12 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x) - a11 (x) - a12 (x);
   return 1;
 }
 
@@ -4103,10 +4506,12 @@ steps_13_5 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_13_6 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[5], B[5], C[5], D[5], E[5], F[5];
-  long double *x, *r;
+  Real A[5], B[5], C[5], D[5], E[5], F[5];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -4126,58 +4531,68 @@ steps_13_6 (Optimize * optimize)        ///< Optimize struct.
   b8 (x) = r[16];
   b7 (x) = r[17];
   b6 (x) = r[18];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) + 121.L * a11 (x) + 144.L * a12 (x)
-    - 12.L * b6 (x) - 14.L * b7 (x) - 18.L * b9 (x) - 20.L * b10 (x)
-    - 22.L * b11 (x) - 24.L * b12 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) + 1331.L * a11 (x) + 1728.L * a12 (x)
-    - 108.L * b6 (x) - 147.L * b7 (x) - 192.L * b8 (x) - 243.L * b9 (x)
-    - 300.L * b10 (x) - 363.L * b11 (x) - 432.L * b12 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) + 10000.L * a10 (x) + 14641.L * a11 (x)
-    + 20736.L * a12 (x) - 864.L * b6 (x) - 1372.L * b7 (x) - 2048.L * b8 (x)
-    - 2916.L * b9 (x) - 4000.L * b10 (x) - 5324.L * b11 (x) - 6912.L * b12 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    + 59049.L * a9 (x) + 100000.L * a10 (x) + 161051.L * a11 (x)
-    + 248832.L * a12 (x) - 6480.L * b6 (x) - 12005.L * b7 (x) - 20480.L * b8 (x)
-    - 32805.L * b9 (x) - 50000.L * b10 (x) - 73205.L * b11 (x)
-    - 103680.L * b12 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * (a6 (x) - b6 (x)) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) + 531441.L * a9 (x) + 1000000.L * a10 (x)
-    + 1771561.L * a11 (x) + 2985984.L * a12 (x) - 100842.L * b7 (x)
-    - 196608.L * b8 (x) - 354294.L * b9 (x) - 600000.L * b10 (x)
-    - 966306.L * b11 (x) - 1492992.L * b12 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) + REAL (121.) * a11 (x)
+    + REAL (144.) * a12 (x) - REAL (12.) * b6 (x) - REAL (14.) * b7 (x)
+    - REAL (18.) * b9 (x) - REAL (20.) * b10 (x) - REAL (22.) * b11 (x)
+    - REAL (24.) * b12 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) + REAL (1331.) * a11 (x) + REAL (1728.) * a12 (x)
+    - REAL (108.) * b6 (x) - REAL (147.) * b7 (x) - REAL (192.) * b8 (x)
+    - REAL (243.) * b9 (x) - REAL (300.) * b10 (x) - REAL (363.) * b11 (x)
+    - REAL (432.) * b12 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    + REAL (10000.) * a10 (x) + REAL (14641.) * a11 (x)
+    + REAL (20736.) * a12 (x) - REAL (864.) * b6 (x) - REAL (1372.) * b7 (x)
+    - REAL (2048.) * b8 (x) - REAL (2916.) * b9 (x) - REAL (4000.) * b10 (x)
+    - REAL (5324.) * b11 (x) - REAL (6912.) * b12 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) + REAL (59049.) * a9 (x)
+    + REAL (100000.) * a10 (x) + REAL (161051.) * a11 (x)
+    + REAL (248832.) * a12 (x) - REAL (6480.) * b6 (x) - REAL (12005.) * b7 (x)
+    - REAL (20480.) * b8 (x) - REAL (32805.) * b9 (x) - REAL (50000.) * b10 (x)
+    - REAL (73205.) * b11 (x) - REAL (103680.) * b12 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x)
+    + REAL (46656.) * (a6 (x) - b6 (x)) + REAL (117649.) * a7 (x)
+    + REAL (262144.) * a8 (x) + REAL (531441.) * a9 (x)
+    + REAL (1000000.) * a10 (x) + REAL (1771561.) * a11 (x)
+    + REAL (2985984.) * a12 (x) - REAL (100842.) * b7 (x)
+    - REAL (196608.) * b8 (x) - REAL (354294.) * b9 (x)
+    - REAL (600000.) * b10 (x) - REAL (966306.) * b11 (x)
+    - REAL (1492992.) * b12 (x);
   solve_5 (A, B, C, D, E, F);
   b5 (x) = F[4];
   if (isnan (b5 (x)))
@@ -4194,13 +4609,14 @@ steps_13_6 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = F[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) + 11.L * a11 (x) + 12.L * a12 (x) - b1 (x) - b2 (x)
-    - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x)
-    - b11 (x) - b12 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x) - a11 (x) - a12 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) + REAL (11.) * a11 (x) + REAL (12.) * a12 (x)
+    - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x)
+    - b9 (x) - b10 (x) - b11 (x) - b12 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x) - a11 (x) - a12 (x);
   return 1;
 }
 
@@ -4210,10 +4626,12 @@ steps_13_6 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_13_7 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[6], B[6], C[6], D[6], E[6], F[6], G[6];
-  long double *x, *r;
+  Real A[6], B[6], C[6], D[6], E[6], F[6], G[6];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -4232,75 +4650,84 @@ steps_13_7 (Optimize * optimize)        ///< Optimize struct.
   b9 (x) = r[15];
   b8 (x) = r[16];
   b7 (x) = r[17];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = 12.L;
-  G[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) + 121.L * a11 (x) + 144.L * a12 (x)
-    - 14.L * b7 (x) - 18.L * b9 (x) - 20.L * b10 (x) - 22.L * b11 (x)
-    - 24.L * b12 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 108.L;
-  G[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) + 1331.L * a11 (x) + 1728.L * a12 (x)
-    - 147.L * b7 (x) - 192.L * b8 (x) - 243.L * b9 (x) - 300.L * b10 (x)
-    - 363.L * b11 (x) - 432.L * b12 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = 864.L;
-  G[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) + 10000.L * a10 (x) + 14641.L * a11 (x)
-    + 20736.L * a12 (x) - 1372.L * b7 (x) - 2048.L * b8 (x) - 2916.L * b9 (x)
-    - 4000.L * b10 (x) - 5324.L * b11 (x) - 6912.L * b12 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 6480.L;
-  G[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    + 59049.L * a9 (x) + 100000.L * a10 (x) + 161051.L * a11 (x)
-    + 248832.L * a12 (x) - 12005.L * b7 (x) - 20480.L * b8 (x)
-    - 32805.L * b9 (x) - 50000.L * b10 (x) - 73205.L * b11 (x)
-    - 103680.L * b12 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = 46656.L;
-  G[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * a6 (x) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) + 531441.L * a9 (x) + 1000000.L * a10 (x)
-    + 1771561.L * a11 (x) + 2985984.L * a12 (x) - 100842.L * b7 (x)
-    - 196608.L * b8 (x) - 354294.L * b9 (x) - 600000.L * b10 (x)
-    - 966306.L * b11 (x) - 1492992.L * b12 (x);
-  A[5] = 7.L;
-  B[5] = 448.L;
-  C[5] = 5103.L;
-  D[5] = 28672.L;
-  E[5] = 109375.L;
-  F[5] = 326592.L;
-  G[5] = 1.L + a1 (x) + 128.L * a2 (x) + 2187.L * a3 (x) + 16384.L * a4 (x)
-    + 78125.L * a5 (x) + 279936.L * a6 (x) + 823543.L * (a7 (x) - b7 (x))
-    + 2097152.L * a8 (x) + 4782969.L * a9 (x) + 10000000.L * a10 (x)
-    + 19487171.L * a11 (x) + 35831808.L * a12 (x) - 1835008.L * b8 (x)
-    - 3720087.L * b9 (x) - 7000000.L * b10 (x) - 12400927.L * b11 (x)
-    - 20901888.L * b12 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = REAL (12.);
+  G[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) + REAL (121.) * a11 (x)
+    + REAL (144.) * a12 (x) - REAL (14.) * b7 (x) - REAL (18.) * b9 (x)
+    - REAL (20.) * b10 (x) - REAL (22.) * b11 (x) - REAL (24.) * b12 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (108.);
+  G[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) + REAL (1331.) * a11 (x) + REAL (1728.) * a12 (x)
+    - REAL (147.) * b7 (x) - REAL (192.) * b8 (x) - REAL (243.) * b9 (x)
+    - REAL (300.) * b10 (x) - REAL (363.) * b11 (x) - REAL (432.) * b12 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = REAL (864.);
+  G[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    + REAL (10000.) * a10 (x) + REAL (14641.) * a11 (x)
+    + REAL (20736.) * a12 (x) - REAL (1372.) * b7 (x) - REAL (2048.) * b8 (x)
+    - REAL (2916.) * b9 (x) - REAL (4000.) * b10 (x) - REAL (5324.) * b11 (x)
+    - REAL (6912.) * b12 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (6480.);
+  G[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) + REAL (59049.) * a9 (x)
+    + REAL (100000.) * a10 (x) + REAL (161051.) * a11 (x)
+    + REAL (248832.) * a12 (x) - REAL (12005.) * b7 (x)
+    - REAL (20480.) * b8 (x) - REAL (32805.) * b9 (x) - REAL (50000.) * b10 (x)
+    - REAL (73205.) * b11 (x) - REAL (103680.) * b12 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = REAL (46656.);
+  G[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x) + REAL (46656.) * a6 (x)
+    + REAL (117649.) * a7 (x) + REAL (262144.) * a8 (x)
+    + REAL (531441.) * a9 (x) + REAL (1000000.) * a10 (x)
+    + REAL (1771561.) * a11 (x) + REAL (2985984.) * a12 (x)
+    - REAL (100842.) * b7 (x) - REAL (196608.) * b8 (x)
+    - REAL (354294.) * b9 (x) - REAL (600000.) * b10 (x)
+    - REAL (966306.) * b11 (x) - REAL (1492992.) * b12 (x);
+  A[5] = REAL (7.);
+  B[5] = REAL (448.);
+  C[5] = REAL (5103.);
+  D[5] = REAL (28672.);
+  E[5] = REAL (109375.);
+  F[5] = REAL (326592.);
+  G[5] = REAL (1.) + a1 (x) + REAL (128.) * a2 (x) + REAL (2187.) * a3 (x)
+    + REAL (16384.) * a4 (x) + REAL (78125.) * a5 (x) + REAL (279936.) * a6 (x)
+    + REAL (823543.) * (a7 (x) - b7 (x)) + REAL (2097152.) * a8 (x)
+    + REAL (4782969.) * a9 (x) + REAL (10000000.) * a10 (x)
+    + REAL (19487171.) * a11 (x) + REAL (35831808.) * a12 (x)
+    - REAL (1835008.) * b8 (x) - REAL (3720087.) * b9 (x)
+    - REAL (7000000.) * b10 (x) - REAL (12400927.) * b11 (x)
+    - REAL (20901888.) * b12 (x);
   solve_6 (A, B, C, D, E, F, G);
   b6 (x) = G[5];
   if (isnan (b6 (x)))
@@ -4320,13 +4747,14 @@ steps_13_7 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = G[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) + 11.L * a11 (x) + 12.L * a12 (x) - b1 (x) - b2 (x)
-    - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x)
-    - b11 (x) - b12 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x) - a11 (x) - a12 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) + REAL (11.) * a11 (x) + REAL (12.) * a12 (x)
+    - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x)
+    - b9 (x) - b10 (x) - b11 (x) - b12 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x) - a11 (x) - a12 (x);
   return 1;
 }
 
@@ -4336,10 +4764,12 @@ steps_13_7 (Optimize * optimize)        ///< Optimize struct.
 static int
 steps_13_8 (Optimize * optimize)        ///< Optimize struct.
 {
-  long double A[7], B[7], C[7], D[7], E[7], F[7], G[7], H[7];
-  long double *x, *r;
+  Real A[7], B[7], C[7], D[7], E[7], F[7], G[7], H[7];
+  Real *x, *r;
   x = optimize->coefficient;
   r = optimize->random_data;
+  if (steps_reject (optimize))
+    return 0;
   a1 (x) = r[0];
   a2 (x) = r[1];
   a3 (x) = r[2];
@@ -4357,92 +4787,104 @@ steps_13_8 (Optimize * optimize)        ///< Optimize struct.
   b10 (x) = r[14];
   b9 (x) = r[15];
   b8 (x) = r[16];
-  A[0] = 2.L;
-  B[0] = 4.L;
-  C[0] = 6.L;
-  D[0] = 8.L;
-  E[0] = 10.L;
-  F[0] = 12.L;
-  G[0] = 14.L;
-  H[0] = -1.L + a1 (x) + 4.L * a2 (x) + 9.L * a3 (x) + 16.L * (a4 (x) - b8 (x))
-    + 25.L * a5 (x) + 36.L * a6 (x) + 49.L * a7 (x) + 64.L * a8 (x)
-    + 81.L * a9 (x) + 100.L * a10 (x) + 121.L * a11 (x) + 144.L * a12 (x)
-    - 18.L * b9 (x) - 20.L * b10 (x) - 22.L * b11 (x) - 24.L * b12 (x);
-  A[1] = 3.L;
-  B[1] = 12.L;
-  C[1] = 27.L;
-  D[1] = 48.L;
-  E[1] = 75.L;
-  F[1] = 108.L;
-  G[1] = 147.L;
-  H[1] = 1.L + a1 (x) + 8.L * a2 (x) + 27.L * a3 (x) + 64.L * a4 (x)
-    + 125.L * a5 (x) + 216.L * a6 (x) + 343.L * a7 (x) + 512.L * a8 (x)
-    + 729.L * a9 (x) + 1000.L * a10 (x) + 1331.L * a11 (x) + 1728.L * a12 (x)
-    - 192.L * b8 (x) - 243.L * b9 (x) - 300.L * b10 (x) - 363.L * b11 (x)
-    - 432.L * b12 (x);
-  A[2] = 4.L;
-  B[2] = 32.L;
-  C[2] = 108.L;
-  D[2] = 256.L;
-  E[2] = 500.L;
-  F[2] = 864.L;
-  G[2] = 1372.L;
-  H[2] = -1.L + a1 (x) + 16.L * a2 (x) + 81.L * a3 (x) + 256.L * a4 (x)
-    + 625.L * a5 (x) + 1296.L * a6 (x) + 2401.L * a7 (x) + 4096.L * a8 (x)
-    + 6561.L * a9 (x) + 10000.L * a10 (x) + 14641.L * a11 (x)
-    + 20736.L * a12 (x) - 2048.L * b8 (x) - 2916.L * b9 (x) - 4000.L * b10 (x)
-    - 5324.L * b11 (x) - 6912.L * b12 (x);
-  A[3] = 5.L;
-  B[3] = 80.L;
-  C[3] = 405.L;
-  D[3] = 1280.L;
-  E[3] = 3125.L;
-  F[3] = 6480.L;
-  G[3] = 12005.L;
-  H[3] = 1.L + a1 (x) + 32.L * a2 (x) + 243.L * a3 (x) + 1024.L * a4 (x)
-    + 3125.L * a5 (x) + 7776.L * a6 (x) + 16807.L * a7 (x) + 32768.L * a8 (x)
-    + 59049.L * a9 (x) + 100000.L * a10 (x) + 161051.L * a11 (x)
-    + 248832.L * a12 (x) - 20480.L * b8 (x) - 32805.L * b9 (x)
-    - 50000.L * b10 (x) - 73205.L * b11 (x) - 103680.L * b12 (x);
-  A[4] = 6.L;
-  B[4] = 192.L;
-  C[4] = 1458.L;
-  D[4] = 6144.L;
-  E[4] = 18750.L;
-  F[4] = 46656.L;
-  G[4] = 100842.L;
-  H[4] = -1.L + a1 (x) + 64.L * a2 (x) + 729.L * a3 (x) + 4096.L * a4 (x)
-    + 15625.L * a5 (x) + 46656.L * a6 (x) + 117649.L * a7 (x)
-    + 262144.L * a8 (x) + 531441.L * a9 (x) + 1000000.L * a10 (x)
-    + 1771561.L * a11 (x) + 2985984.L * a12 (x) - 196608.L * b8 (x)
-    - 354294.L * b9 (x) - 600000.L * b10 (x) - 966306.L * b11 (x)
-    - 1492992.L * b12 (x);
-  A[5] = 7.L;
-  B[5] = 448.L;
-  C[5] = 5103.L;
-  D[5] = 28672.L;
-  E[5] = 109375.L;
-  F[5] = 326592.L;
-  G[5] = 823543.L;
-  H[5] = 1.L + a1 (x) + 128.L * a2 (x) + 2187.L * a3 (x) + 16384.L * a4 (x)
-    + 78125.L * a5 (x) + 279936.L * a6 (x) + 823543.L * a7 (x)
-    + 2097152.L * a8 (x) + 4782969.L * a9 (x) + 10000000.L * a10 (x)
-    + 19487171.L * a11 (x) + 35831808.L * a12 (x) - 1835008.L * b8 (x)
-    - 3720087.L * b9 (x) - 7000000.L * b10 (x) - 12400927.L * b11 (x)
-    - 20901888.L * b12 (x);
-  A[6] = 8.L;
-  B[6] = 1024.L;
-  C[6] = 17496.L;
-  D[6] = 131072.L;
-  E[6] = 625000.L;
-  F[6] = 2239488.L;
-  G[6] = 6588344.L;
-  H[6] = -1.L + a1 (x) + 256.L * a2 (x) + 6561.L * a3 (x) + 65536.L * a4 (x)
-    + 390625.L * a5 (x) + 1679616.L * a6 (x) + 5764801.L * a7 (x)
-    + 16777216.L * (a8 (x) - b8 (x)) + 43046721.L * a9 (x)
-    + 100000000.L * a10 (x) + 214358881.L * a11 (x) + 429981696.L * a12 (x)
-    - 38263752.L * b9 (x) - 80000000.L * b10 (x) - 155897368.L * b11 (x)
-    - 286654464.L * b12 (x);
+  A[0] = REAL (2.);
+  B[0] = REAL (4.);
+  C[0] = REAL (6.);
+  D[0] = REAL (8.);
+  E[0] = REAL (10.);
+  F[0] = REAL (12.);
+  G[0] = REAL (14.);
+  H[0] = -REAL (1.) + a1 (x) + REAL (4.) * a2 (x) + REAL (9.) * a3 (x)
+    + REAL (16.) * (a4 (x) - b8 (x)) + REAL (25.) * a5 (x)
+    + REAL (36.) * a6 (x) + REAL (49.) * a7 (x) + REAL (64.) * a8 (x)
+    + REAL (81.) * a9 (x) + REAL (100.) * a10 (x) + REAL (121.) * a11 (x)
+    + REAL (144.) * a12 (x) - REAL (18.) * b9 (x) - REAL (20.) * b10 (x)
+    - REAL (22.) * b11 (x) - REAL (24.) * b12 (x);
+  A[1] = REAL (3.);
+  B[1] = REAL (12.);
+  C[1] = REAL (27.);
+  D[1] = REAL (48.);
+  E[1] = REAL (75.);
+  F[1] = REAL (108.);
+  G[1] = REAL (147.);
+  H[1] = REAL (1.) + a1 (x) + REAL (8.) * a2 (x) + REAL (27.) * a3 (x)
+    + REAL (64.) * a4 (x) + REAL (125.) * a5 (x) + REAL (216.) * a6 (x)
+    + REAL (343.) * a7 (x) + REAL (512.) * a8 (x) + REAL (729.) * a9 (x)
+    + REAL (1000.) * a10 (x) + REAL (1331.) * a11 (x) + REAL (1728.) * a12 (x)
+    - REAL (192.) * b8 (x) - REAL (243.) * b9 (x) - REAL (300.) * b10 (x)
+    - REAL (363.) * b11 (x) - REAL (432.) * b12 (x);
+  A[2] = REAL (4.);
+  B[2] = REAL (32.);
+  C[2] = REAL (108.);
+  D[2] = REAL (256.);
+  E[2] = REAL (500.);
+  F[2] = REAL (864.);
+  G[2] = REAL (1372.);
+  H[2] = -REAL (1.) + a1 (x) + REAL (16.) * a2 (x) + REAL (81.) * a3 (x)
+    + REAL (256.) * a4 (x) + REAL (625.) * a5 (x) + REAL (1296.) * a6 (x)
+    + REAL (2401.) * a7 (x) + REAL (4096.) * a8 (x) + REAL (6561.) * a9 (x)
+    + REAL (10000.) * a10 (x) + REAL (14641.) * a11 (x)
+    + REAL (20736.) * a12 (x) - REAL (2048.) * b8 (x) - REAL (2916.) * b9 (x)
+    - REAL (4000.) * b10 (x) - REAL (5324.) * b11 (x) - REAL (6912.) * b12 (x);
+  A[3] = REAL (5.);
+  B[3] = REAL (80.);
+  C[3] = REAL (405.);
+  D[3] = REAL (1280.);
+  E[3] = REAL (3125.);
+  F[3] = REAL (6480.);
+  G[3] = REAL (12005.);
+  H[3] = REAL (1.) + a1 (x) + REAL (32.) * a2 (x) + REAL (243.) * a3 (x)
+    + REAL (1024.) * a4 (x) + REAL (3125.) * a5 (x) + REAL (7776.) * a6 (x)
+    + REAL (16807.) * a7 (x) + REAL (32768.) * a8 (x) + REAL (59049.) * a9 (x)
+    + REAL (100000.) * a10 (x) + REAL (161051.) * a11 (x)
+    + REAL (248832.) * a12 (x) - REAL (20480.) * b8 (x)
+    - REAL (32805.) * b9 (x) - REAL (50000.) * b10 (x)
+    - REAL (73205.) * b11 (x) - REAL (103680.) * b12 (x);
+  A[4] = REAL (6.);
+  B[4] = REAL (192.);
+  C[4] = REAL (1458.);
+  D[4] = REAL (6144.);
+  E[4] = REAL (18750.);
+  F[4] = REAL (46656.);
+  G[4] = REAL (100842.);
+  H[4] = -REAL (1.) + a1 (x) + REAL (64.) * a2 (x) + REAL (729.) * a3 (x)
+    + REAL (4096.) * a4 (x) + REAL (15625.) * a5 (x) + REAL (46656.) * a6 (x)
+    + REAL (117649.) * a7 (x) + REAL (262144.) * a8 (x)
+    + REAL (531441.) * a9 (x) + REAL (1000000.) * a10 (x)
+    + REAL (1771561.) * a11 (x) + REAL (2985984.) * a12 (x)
+    - REAL (196608.) * b8 (x) - REAL (354294.) * b9 (x)
+    - REAL (600000.) * b10 (x) - REAL (966306.) * b11 (x)
+    - REAL (1492992.) * b12 (x);
+  A[5] = REAL (7.);
+  B[5] = REAL (448.);
+  C[5] = REAL (5103.);
+  D[5] = REAL (28672.);
+  E[5] = REAL (109375.);
+  F[5] = REAL (326592.);
+  G[5] = REAL (823543.);
+  H[5] = REAL (1.) + a1 (x) + REAL (128.) * a2 (x) + REAL (2187.) * a3 (x)
+    + REAL (16384.) * a4 (x) + REAL (78125.) * a5 (x) + REAL (279936.) * a6 (x)
+    + REAL (823543.) * a7 (x) + REAL (2097152.) * a8 (x)
+    + REAL (4782969.) * a9 (x) + REAL (10000000.) * a10 (x)
+    + REAL (19487171.) * a11 (x) + REAL (35831808.) * a12 (x)
+    - REAL (1835008.) * b8 (x) - REAL (3720087.) * b9 (x)
+    - REAL (7000000.) * b10 (x) - REAL (12400927.) * b11 (x)
+    - REAL (20901888.) * b12 (x);
+  A[6] = REAL (8.);
+  B[6] = REAL (1024.);
+  C[6] = REAL (17496.);
+  D[6] = REAL (131072.);
+  E[6] = REAL (625000.);
+  F[6] = REAL (2239488.);
+  G[6] = REAL (6588344.);
+  H[6] = -REAL (1.) + a1 (x) + REAL (256.) * a2 (x) + REAL (6561.) * a3 (x)
+    + REAL (65536.) * a4 (x) + REAL (390625.) * a5 (x)
+    + REAL (1679616.) * a6 (x) + REAL (5764801.) * a7 (x)
+    + REAL (16777216.) * (a8 (x) - b8 (x)) + REAL (43046721.) * a9 (x)
+    + REAL (100000000.) * a10 (x) + REAL (214358881.) * a11 (x)
+    + REAL (429981696.) * a12 (x) - REAL (38263752.) * b9 (x)
+    - REAL (80000000.) * b10 (x) - REAL (155897368.) * b11 (x)
+    - REAL (286654464.) * b12 (x);
   solve_7 (A, B, C, D, E, F, G, H);
   b7 (x) = H[6];
   if (isnan (b7 (x)))
@@ -4465,13 +4907,14 @@ steps_13_8 (Optimize * optimize)        ///< Optimize struct.
   b1 (x) = H[0];
   if (isnan (b1 (x)))
     return 0;
-  b0 (x) = 1.L + a1 (x) + 2.L * a2 (x) + 3.L * a3 (x) + 4.L * a4 (x)
-    + 5.L * a5 (x) + 6.L * a6 (x) + 7.L * a7 (x) + 8.L * a8 (x) + 9.L * a9 (x)
-    + 10.L * a10 (x) + 11.L * a11 (x) + 12.L * a12 (x) - b1 (x) - b2 (x)
-    - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x) - b9 (x) - b10 (x)
-    - b11 (x) - b12 (x);
-  a0 (x) = 1.L - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x) - a7 (x)
-    - a8 (x) - a9 (x) - a10 (x) - a11 (x) - a12 (x);
+  b0 (x) = REAL (1.) + a1 (x) + REAL (2.) * a2 (x) + REAL (3.) * a3 (x)
+    + REAL (4.) * a4 (x) + REAL (5.) * a5 (x) + REAL (6.) * a6 (x)
+    + REAL (7.) * a7 (x) + REAL (8.) * a8 (x) + REAL (9.) * a9 (x)
+    + REAL (10.) * a10 (x) + REAL (11.) * a11 (x) + REAL (12.) * a12 (x)
+    - b1 (x) - b2 (x) - b3 (x) - b4 (x) - b5 (x) - b6 (x) - b7 (x) - b8 (x)
+    - b9 (x) - b10 (x) - b11 (x) - b12 (x);
+  a0 (x) = REAL (1.) - a1 (x) - a2 (x) - a3 (x) - a4 (x) - a5 (x) - a6 (x)
+    - a7 (x) - a8 (x) - a9 (x) - a10 (x) - a11 (x) - a12 (x);
   return 1;
 }
 
@@ -4482,14 +4925,15 @@ static void
 steps_print (Optimize * optimize,       ///< Optimize struct.
              FILE * file)       ///< file.
 {
-  long double *x;
+  Real *x;
   unsigned int i;
   x = optimize->coefficient;
   for (i = 0; i < optimize->nsteps; ++i)
     {
-      fprintf (file, "a%u:%.19Le;\n", i, x[2 * i]);
-      fprintf (file, "b%u:%.19Le;\n", i, x[2 * i + 1]);
-      fprintf (file, "c%u:%.19Le;\n", i, c (x[2 * i], x[2 * i + 1]));
+      fprintf (file, "a%u:" REAL_E ";\n", i, real_e (x[2 * i]));
+      fprintf (file, "b%u:" REAL_E ";\n", i, real_e (x[2 * i + 1]));
+      fprintf (file, "c%u:" REAL_E ";\n", i,
+               real_e (c (x[2 * i], x[2 * i + 1])));
     }
 }
 
@@ -4539,1048 +4983,478 @@ steps_print_maxima (FILE * file,        ///< file.
 }
 
 /**
- * Function to get the objective function of a 3 steps mult-steps method.
+ * Function to get the objective function of a multi-steps method. The
+ * evaluation ends as soon as the objective function value can not be lower
+ * than the cut-off.
  * 
  * \return objective function value.
  */
-static long double
-steps_objective_3 (Optimize * optimize) ///< Optimize struct.
+static Real
+steps_objective (Optimize * optimize)   ///< Optimize struct.
 {
-  register long double *x;
-  register long double k, C;
+  register Real *x;
+  register Real k, C;
+  unsigned int i, m, nsteps;
   x = optimize->coefficient;
-  k = 0.L;
-  if (a0 (x) < -LDBL_EPSILON)
-    k += a0 (x);
-  if (a1 (x) < -LDBL_EPSILON)
-    k += a1 (x);
-  if (a2 (x) < -LDBL_EPSILON)
-    k += a2 (x);
-  if (k < -LDBL_EPSILON)
-    return 30.L - k;
-  k = 0.L;
-  if (b0 (x) < -LDBL_EPSILON)
-    k += b0 (x);
-  if (b1 (x) < -LDBL_EPSILON)
-    k += b1 (x);
-  if (b2 (x) < -LDBL_EPSILON)
-    k += b2 (x);
-  if (k < -LDBL_EPSILON)
-    return 20.L - k;
-  k = 0.L;
-  C = c0 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c1 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c2 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  if (k == 0.L || k > 20.L)
-    return 20.L;
-  return k;
-}
+  nsteps = optimize->nsteps;
+  k = REAL (0.);
+  for (i = 0; i < nsteps; ++i)
+    if (x[2 * i] < -REAL_EPSILON)
+      {
+        k += x[2 * i];
+        if (optimize_reject (optimize, REAL (30.) - k, OPTIMIZE_REJECT_SIGN))
+          break;
+      }
+  if (k < -REAL_EPSILON)
+    return REAL (30.) - k;
+  k = REAL (0.);
+  for (i = 0; i < nsteps; ++i)
+    if (x[2 * i + 1] < -REAL_EPSILON)
+      {
+        k += x[2 * i + 1];
+        if (optimize_reject (optimize, REAL (20.) - k, OPTIMIZE_REJECT_SIGN))
+          break;
+      }
+  if (k < -REAL_EPSILON)
+    return REAL (20.) - k;
 
-/**
- * Function to get the objective function of a 4 steps mult-steps method.
- * 
- * \return objective function value.
- */
-static long double
-steps_objective_4 (Optimize * optimize) ///< Optimize struct.
-{
-  register long double *x;
-  register long double k, C;
-  x = optimize->coefficient;
-  k = 0.L;
-  if (a0 (x) < -LDBL_EPSILON)
-    k += a0 (x);
-  if (a1 (x) < -LDBL_EPSILON)
-    k += a1 (x);
-  if (a2 (x) < -LDBL_EPSILON)
-    k += a2 (x);
-  if (a3 (x) < -LDBL_EPSILON)
-    k += a3 (x);
-  if (k < -LDBL_EPSILON)
-    return 30.L - k;
-  k = 0.L;
-  if (b0 (x) < -LDBL_EPSILON)
-    k += b0 (x);
-  if (b1 (x) < -LDBL_EPSILON)
-    k += b1 (x);
-  if (b2 (x) < -LDBL_EPSILON)
-    k += b2 (x);
-  if (b3 (x) < -LDBL_EPSILON)
-    k += b3 (x);
-  if (k < -LDBL_EPSILON)
-    return 20.L - k;
-  k = 0.L;
-  C = c0 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c1 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c2 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c3 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  if (k == 0.L || k > 20.L)
-    return 20.L;
+  // maximum of the c coefficients (the 13 steps methods check c11 instead of
+  // c12)
+  m = (nsteps == 13) ? 12 : nsteps;
+  k = REAL (0.);
+  for (i = 0; i < m; ++i)
+    {
+      C = c (x[2 * i], x[2 * i + 1]);
+      if (C < -REAL_EPSILON)
+        return REAL (20.);
+      if (!isnan (C))
+        {
+          k = fmaxr (k, C);
+          if (k > REAL (20.))
+            return REAL (20.);
+          if (optimize_reject (optimize, k, OPTIMIZE_REJECT_BOUND))
+            return k;
+        }
+    }
+  if (k == REAL (0.) || k > REAL (20.))
+    return REAL (20.);
   return k;
 }
 
-/**
- * Function to get the objective function of a 5 steps mult-steps method.
- * 
- * \return objective function value.
- */
-static long double
-steps_objective_5 (Optimize * optimize) ///< Optimize struct.
-{
-  register long double *x;
-  register long double k, C;
-  x = optimize->coefficient;
-  k = 0.L;
-  if (a0 (x) < -LDBL_EPSILON)
-    k += a0 (x);
-  if (a1 (x) < -LDBL_EPSILON)
-    k += a1 (x);
-  if (a2 (x) < -LDBL_EPSILON)
-    k += a2 (x);
-  if (a3 (x) < -LDBL_EPSILON)
-    k += a3 (x);
-  if (a4 (x) < -LDBL_EPSILON)
-    k += a4 (x);
-  if (k < -LDBL_EPSILON)
-    return 30.L - k;
-  k = 0.L;
-  if (b0 (x) < -LDBL_EPSILON)
-    k += b0 (x);
-  if (b1 (x) < -LDBL_EPSILON)
-    k += b1 (x);
-  if (b2 (x) < -LDBL_EPSILON)
-    k += b2 (x);
-  if (b3 (x) < -LDBL_EPSILON)
-    k += b3 (x);
-  if (b4 (x) < -LDBL_EPSILON)
-    k += b4 (x);
-  if (k < -LDBL_EPSILON)
-    return 20.L - k;
-  k = 0.L;
-  C = c0 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c1 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c2 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c3 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c4 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  if (k == 0.L || k > 20.L)
-    return 20.L;
-  return k;
-}
+#if OPTIMIZE_SPECIALIZED
+OPTIMIZE_SPECIALIZE (steps_3_2, steps_3_2, steps_objective)
+///< specialized functions of the 3 steps 2nd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_3_3, steps_3_3, steps_objective)
+///< specialized functions of the 3 steps 3rd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_4_2, steps_4_2, steps_objective)
+///< specialized functions of the 4 steps 2nd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_4_3, steps_4_3, steps_objective)
+///< specialized functions of the 4 steps 3rd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_4_4, steps_4_4, steps_objective)
+///< specialized functions of the 4 steps 4th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_5_2, steps_5_2, steps_objective)
+///< specialized functions of the 5 steps 2nd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_5_3, steps_5_3, steps_objective)
+///< specialized functions of the 5 steps 3rd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_5_4, steps_5_4, steps_objective)
+///< specialized functions of the 5 steps 4th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_5_5, steps_5_5, steps_objective)
+///< specialized functions of the 5 steps 5th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_6_2, steps_6_2, steps_objective)
+///< specialized functions of the 6 steps 2nd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_6_3, steps_6_3, steps_objective)
+///< specialized functions of the 6 steps 3rd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_6_4, steps_6_4, steps_objective)
+///< specialized functions of the 6 steps 4th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_6_5, steps_6_5, steps_objective)
+///< specialized functions of the 6 steps 5th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_6_6, steps_6_6, steps_objective)
+///< specialized functions of the 6 steps 6th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_7_2, steps_7_2, steps_objective)
+///< specialized functions of the 7 steps 2nd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_7_3, steps_7_3, steps_objective)
+///< specialized functions of the 7 steps 3rd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_7_4, steps_7_4, steps_objective)
+///< specialized functions of the 7 steps 4th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_7_5, steps_7_5, steps_objective)
+///< specialized functions of the 7 steps 5th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_7_6, steps_7_6, steps_objective)
+///< specialized functions of the 7 steps 6th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_7_7, steps_7_7, steps_objective)
+///< specialized functions of the 7 steps 7th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_8_2, steps_8_2, steps_objective)
+///< specialized functions of the 8 steps 2nd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_8_3, steps_8_3, steps_objective)
+///< specialized functions of the 8 steps 3rd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_8_4, steps_8_4, steps_objective)
+///< specialized functions of the 8 steps 4th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_8_5, steps_8_5, steps_objective)
+///< specialized functions of the 8 steps 5th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_8_6, steps_8_6, steps_objective)
+///< specialized functions of the 8 steps 6th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_8_7, steps_8_7, steps_objective)
+///< specialized functions of the 8 steps 7th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_8_8, steps_8_8, steps_objective)
+///< specialized functions of the 8 steps 8th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_9_2, steps_9_2, steps_objective)
+///< specialized functions of the 9 steps 2nd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_9_3, steps_9_3, steps_objective)
+///< specialized functions of the 9 steps 3rd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_9_4, steps_9_4, steps_objective)
+///< specialized functions of the 9 steps 4th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_9_5, steps_9_5, steps_objective)
+///< specialized functions of the 9 steps 5th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_9_6, steps_9_6, steps_objective)
+///< specialized functions of the 9 steps 6th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_9_7, steps_9_7, steps_objective)
+///< specialized functions of the 9 steps 7th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_9_8, steps_9_8, steps_objective)
+///< specialized functions of the 9 steps 8th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_10_2, steps_10_2, steps_objective)
+///< specialized functions of the 10 steps 2nd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_10_3, steps_10_3, steps_objective)
+///< specialized functions of the 10 steps 3rd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_10_4, steps_10_4, steps_objective)
+///< specialized functions of the 10 steps 4th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_10_5, steps_10_5, steps_objective)
+///< specialized functions of the 10 steps 5th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_10_6, steps_10_6, steps_objective)
+///< specialized functions of the 10 steps 6th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_10_7, steps_10_7, steps_objective)
+///< specialized functions of the 10 steps 7th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_10_8, steps_10_8, steps_objective)
+///< specialized functions of the 10 steps 8th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_11_2, steps_11_2, steps_objective)
+///< specialized functions of the 11 steps 2nd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_11_3, steps_11_3, steps_objective)
+///< specialized functions of the 11 steps 3rd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_11_4, steps_11_4, steps_objective)
+///< specialized functions of the 11 steps 4th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_11_5, steps_11_5, steps_objective)
+///< specialized functions of the 11 steps 5th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_11_6, steps_11_6, steps_objective)
+///< specialized functions of the 11 steps 6th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_11_7, steps_11_7, steps_objective)
+///< specialized functions of the 11 steps 7th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_11_8, steps_11_8, steps_objective)
+///< specialized functions of the 11 steps 8th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_12_2, steps_12_2, steps_objective)
+///< specialized functions of the 12 steps 2nd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_12_3, steps_12_3, steps_objective)
+///< specialized functions of the 12 steps 3rd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_12_4, steps_12_4, steps_objective)
+///< specialized functions of the 12 steps 4th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_12_5, steps_12_5, steps_objective)
+///< specialized functions of the 12 steps 5th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_12_6, steps_12_6, steps_objective)
+///< specialized functions of the 12 steps 6th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_12_7, steps_12_7, steps_objective)
+///< specialized functions of the 12 steps 7th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_12_8, steps_12_8, steps_objective)
+///< specialized functions of the 12 steps 8th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_13_2, steps_13_2, steps_objective)
+///< specialized functions of the 13 steps 2nd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_13_3, steps_13_3, steps_objective)
+///< specialized functions of the 13 steps 3rd order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_13_4, steps_13_4, steps_objective)
+///< specialized functions of the 13 steps 4th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_13_5, steps_13_5, steps_objective)
+///< specialized functions of the 13 steps 5th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_13_6, steps_13_6, steps_objective)
+///< specialized functions of the 13 steps 6th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_13_7, steps_13_7, steps_objective)
+///< specialized functions of the 13 steps 7th order multi-steps method.
+OPTIMIZE_SPECIALIZE (steps_13_8, steps_13_8, steps_objective)
+///< specialized functions of the 13 steps 8th order multi-steps method.
+#endif
 
 /**
- * Function to get the objective function of a 6 steps mult-steps method.
- * 
+ * Function to get the objective function of a multi-steps method moving a
+ * freedom degree from the point of the current coefficients. The coefficient
+ * equal to the freedom degree takes its value and only the other coefficients
+ * depending on it are updated by the affine map, being restored after
+ * evaluating the objective function. The updated coefficients are rounded
+ * differently than on the steps_N_M functions, so the value only screens the
+ * probe. Not a number is returned if an updated coefficient is within the
+ * batch_margin of zero, as its sign could change with the rounding.
+ *
  * \return objective function value.
  */
-static long double
-steps_objective_6 (Optimize * optimize) ///< Optimize struct.
+static Real
+steps_probe (Optimize * optimize,       ///< Optimize struct.
+             unsigned int j,    ///< freedom degree number.
+             Real v)            ///< freedom degree value.
 {
-  register long double *x;
-  register long double k, C;
+  const Real *A;
+  const unsigned int *dep;
+  Real *x, *y;
+  Real d, o;
+  unsigned int i, k, l, m, n, nfree, nsteps, size;
+  nfree = optimize->nfree;
+  nsteps = optimize->nsteps;
+  size = optimize->size;
+  n = nfree + 1;
+  A = (const Real *) optimize->data;
+  dep = (const unsigned int *) ((const double *) (A + size * n) + size * n)
+    + j * (size + 1);
   x = optimize->coefficient;
-  k = 0.L;
-  if (a0 (x) < -LDBL_EPSILON)
-    k += a0 (x);
-  if (a1 (x) < -LDBL_EPSILON)
-    k += a1 (x);
-  if (a2 (x) < -LDBL_EPSILON)
-    k += a2 (x);
-  if (a3 (x) < -LDBL_EPSILON)
-    k += a3 (x);
-  if (a4 (x) < -LDBL_EPSILON)
-    k += a4 (x);
-  if (a5 (x) < -LDBL_EPSILON)
-    k += a5 (x);
-  if (k < -LDBL_EPSILON)
-    return 30.L - k;
-  k = 0.L;
-  if (b0 (x) < -LDBL_EPSILON)
-    k += b0 (x);
-  if (b1 (x) < -LDBL_EPSILON)
-    k += b1 (x);
-  if (b2 (x) < -LDBL_EPSILON)
-    k += b2 (x);
-  if (b3 (x) < -LDBL_EPSILON)
-    k += b3 (x);
-  if (b4 (x) < -LDBL_EPSILON)
-    k += b4 (x);
-  if (b5 (x) < -LDBL_EPSILON)
-    k += b5 (x);
-  if (k < -LDBL_EPSILON)
-    return 20.L - k;
-  k = 0.L;
-  C = c0 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c1 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c2 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c3 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c4 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c5 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  if (k == 0.L || k > 20.L)
-    return 20.L;
-  return k;
+  d = v - optimize->random_data[j];
+  l = (j < nsteps - 1) ? 2 * j + 2 : 4 * nsteps - 3 - 2 * j;
+  m = dep[0];
+  y = (Real *) alloca (m * sizeof (Real));
+  for (k = 0, o = REAL (0.); k < m; ++k)
+    {
+      i = dep[k + 1];
+      y[k] = x[i];
+      if (i == l)
+        x[i] = v;
+      else
+        {
+          x[i] += d * A[i * n + j + 1];
+          if (isnan (x[i]))
+            o = INFINITY;
+          else if (o == REAL (0.) && fabsr (x[i]) <= batch_margin)
+            o = NAN;
+        }
+    }
+  if (o == REAL (0.))
+    o = steps_objective (optimize);
+  for (k = 0; k < m; ++k)
+    x[dep[k + 1]] = y[k];
+  return o;
 }
 
 /**
- * Function to get the objective function of a 7 steps mult-steps method.
- * 
- * \return objective function value.
+ * Function to get the objective function of a batch of multi-steps methods in
+ * double precision. The coefficients are obtained by the affine map of the
+ * freedom degrees and the objective function is evaluated with masks instead
+ * of branches, so the compiler can vectorize all the batch.
  */
-static long double
-steps_objective_7 (Optimize * optimize) ///< Optimize struct.
+static void
+steps_batch (Optimize * optimize)       ///< Optimize struct.
 {
-  register long double *x;
-  register long double k, C;
-  x = optimize->coefficient;
-  k = 0.L;
-  if (a0 (x) < -LDBL_EPSILON)
-    k += a0 (x);
-  if (a1 (x) < -LDBL_EPSILON)
-    k += a1 (x);
-  if (a2 (x) < -LDBL_EPSILON)
-    k += a2 (x);
-  if (a3 (x) < -LDBL_EPSILON)
-    k += a3 (x);
-  if (a4 (x) < -LDBL_EPSILON)
-    k += a4 (x);
-  if (a5 (x) < -LDBL_EPSILON)
-    k += a5 (x);
-  if (a6 (x) < -LDBL_EPSILON)
-    k += a6 (x);
-  if (k < -LDBL_EPSILON)
-    return 30.L - k;
-  k = 0.L;
-  if (b0 (x) < -LDBL_EPSILON)
-    k += b0 (x);
-  if (b1 (x) < -LDBL_EPSILON)
-    k += b1 (x);
-  if (b2 (x) < -LDBL_EPSILON)
-    k += b2 (x);
-  if (b3 (x) < -LDBL_EPSILON)
-    k += b3 (x);
-  if (b4 (x) < -LDBL_EPSILON)
-    k += b4 (x);
-  if (b5 (x) < -LDBL_EPSILON)
-    k += b5 (x);
-  if (b6 (x) < -LDBL_EPSILON)
-    k += b6 (x);
-  if (k < -LDBL_EPSILON)
-    return 20.L - k;
-  k = 0.L;
-  C = c0 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c1 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c2 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c3 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c4 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c5 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c6 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  if (k == 0.L || k > 20.L)
-    return 20.L;
-  return k;
-}
+  double ka[OPTIMIZE_BATCH], kb[OPTIMIZE_BATCH], kc[OPTIMIZE_BATCH],
+    kn[OPTIMIZE_BATCH];
+  const double *A, *a;
+  double *r, *x, *o, *y, *z;
+  double C;
+  unsigned int i, j, l, m, n, nfree, size, nsteps;
+  nfree = optimize->nfree;
+  size = optimize->size;
+  nsteps = optimize->nsteps;
+  n = nfree + 1;
+  A = (const double *) ((Real *) optimize->data + size * n);
+  r = optimize->batch_data;
+  x = r + OPTIMIZE_BATCH * nfree;
+  o = x + OPTIMIZE_BATCH * size;
 
-/**
- * Function to get the objective function of a 8 steps mult-steps method.
- * 
- * \return objective function value.
- */
-static long double
-steps_objective_8 (Optimize * optimize) ///< Optimize struct.
-{
-  register long double *x;
-  register long double k, C;
-  x = optimize->coefficient;
-  k = 0.L;
-  if (a0 (x) < -LDBL_EPSILON)
-    k += a0 (x);
-  if (a1 (x) < -LDBL_EPSILON)
-    k += a1 (x);
-  if (a2 (x) < -LDBL_EPSILON)
-    k += a2 (x);
-  if (a3 (x) < -LDBL_EPSILON)
-    k += a3 (x);
-  if (a4 (x) < -LDBL_EPSILON)
-    k += a4 (x);
-  if (a5 (x) < -LDBL_EPSILON)
-    k += a5 (x);
-  if (a6 (x) < -LDBL_EPSILON)
-    k += a6 (x);
-  if (a7 (x) < -LDBL_EPSILON)
-    k += a7 (x);
-  if (k < -LDBL_EPSILON)
-    return 30.L - k;
-  k = 0.L;
-  if (b0 (x) < -LDBL_EPSILON)
-    k += b0 (x);
-  if (b1 (x) < -LDBL_EPSILON)
-    k += b1 (x);
-  if (b2 (x) < -LDBL_EPSILON)
-    k += b2 (x);
-  if (b3 (x) < -LDBL_EPSILON)
-    k += b3 (x);
-  if (b4 (x) < -LDBL_EPSILON)
-    k += b4 (x);
-  if (b5 (x) < -LDBL_EPSILON)
-    k += b5 (x);
-  if (b6 (x) < -LDBL_EPSILON)
-    k += b6 (x);
-  if (b7 (x) < -LDBL_EPSILON)
-    k += b7 (x);
-  if (k < -LDBL_EPSILON)
-    return 20.L - k;
-  k = 0.L;
-  C = c0 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c1 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c2 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c3 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c4 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c5 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c6 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c7 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  if (k == 0.L || k > 20.L)
-    return 20.L;
-  return k;
-}
+  // coefficients
+  for (i = 0; i < size; ++i)
+    {
+      a = A + i * n;
+      for (l = 0; l < OPTIMIZE_BATCH; ++l)
+        kc[l] = a[0];
+      for (j = 0; j < nfree; ++j)
+        {
+          z = r + j * OPTIMIZE_BATCH;
+          for (l = 0; l < OPTIMIZE_BATCH; ++l)
+            kc[l] += a[j + 1] * z[l];
+        }
+      memcpy (x + i * OPTIMIZE_BATCH, kc, OPTIMIZE_BATCH * sizeof (double));
+    }
 
-/**
- * Function to get the objective function of a 9 steps mult-steps method.
- * 
- * \return objective function value.
- */
-static long double
-steps_objective_9 (Optimize * optimize) ///< Optimize struct.
-{
-  register long double *x;
-  register long double k, C;
-  x = optimize->coefficient;
-  k = 0.L;
-  if (a0 (x) < -LDBL_EPSILON)
-    k += a0 (x);
-  if (a1 (x) < -LDBL_EPSILON)
-    k += a1 (x);
-  if (a2 (x) < -LDBL_EPSILON)
-    k += a2 (x);
-  if (a3 (x) < -LDBL_EPSILON)
-    k += a3 (x);
-  if (a4 (x) < -LDBL_EPSILON)
-    k += a4 (x);
-  if (a5 (x) < -LDBL_EPSILON)
-    k += a5 (x);
-  if (a6 (x) < -LDBL_EPSILON)
-    k += a6 (x);
-  if (a7 (x) < -LDBL_EPSILON)
-    k += a7 (x);
-  if (a8 (x) < -LDBL_EPSILON)
-    k += a8 (x);
-  if (k < -LDBL_EPSILON)
-    return 30.L - k;
-  k = 0.L;
-  if (b0 (x) < -LDBL_EPSILON)
-    k += b0 (x);
-  if (b1 (x) < -LDBL_EPSILON)
-    k += b1 (x);
-  if (b2 (x) < -LDBL_EPSILON)
-    k += b2 (x);
-  if (b3 (x) < -LDBL_EPSILON)
-    k += b3 (x);
-  if (b4 (x) < -LDBL_EPSILON)
-    k += b4 (x);
-  if (b5 (x) < -LDBL_EPSILON)
-    k += b5 (x);
-  if (b6 (x) < -LDBL_EPSILON)
-    k += b6 (x);
-  if (b7 (x) < -LDBL_EPSILON)
-    k += b7 (x);
-  if (b8 (x) < -LDBL_EPSILON)
-    k += b8 (x);
-  if (k < -LDBL_EPSILON)
-    return 20.L - k;
-  k = 0.L;
-  C = c0 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c1 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c2 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c3 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c4 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c5 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c6 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c7 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c8 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  if (k == 0.L || k > 20.L)
-    return 20.L;
-  return k;
-}
+  // sums of the negative a and b coefficients
+  for (l = 0; l < OPTIMIZE_BATCH; ++l)
+    ka[l] = kb[l] = kc[l] = kn[l] = 0.;
+  for (i = 0; i < nsteps; ++i)
+    {
+      y = x + 2 * i * OPTIMIZE_BATCH;
+      z = y + OPTIMIZE_BATCH;
+      for (l = 0; l < OPTIMIZE_BATCH; ++l)
+        {
+          ka[l] += (y[l] < -REAL_EPSILON) ? y[l] : 0.;
+          kb[l] += (z[l] < -REAL_EPSILON) ? z[l] : 0.;
+        }
+    }
 
-/**
- * Function to get the objective function of a 10 steps mult-steps method.
- * 
- * \return objective function value.
- */
-static long double
-steps_objective_10 (Optimize * optimize)        ///< Optimize struct.
-{
-  register long double *x;
-  register long double k, C;
-  x = optimize->coefficient;
-  k = 0.L;
-  if (a0 (x) < -LDBL_EPSILON)
-    k += a0 (x);
-  if (a1 (x) < -LDBL_EPSILON)
-    k += a1 (x);
-  if (a2 (x) < -LDBL_EPSILON)
-    k += a2 (x);
-  if (a3 (x) < -LDBL_EPSILON)
-    k += a3 (x);
-  if (a4 (x) < -LDBL_EPSILON)
-    k += a4 (x);
-  if (a5 (x) < -LDBL_EPSILON)
-    k += a5 (x);
-  if (a6 (x) < -LDBL_EPSILON)
-    k += a6 (x);
-  if (a7 (x) < -LDBL_EPSILON)
-    k += a7 (x);
-  if (a8 (x) < -LDBL_EPSILON)
-    k += a8 (x);
-  if (a9 (x) < -LDBL_EPSILON)
-    k += a9 (x);
-  if (k < -LDBL_EPSILON)
-    return 30.L - k;
-  k = 0.L;
-  if (b0 (x) < -LDBL_EPSILON)
-    k += b0 (x);
-  if (b1 (x) < -LDBL_EPSILON)
-    k += b1 (x);
-  if (b2 (x) < -LDBL_EPSILON)
-    k += b2 (x);
-  if (b3 (x) < -LDBL_EPSILON)
-    k += b3 (x);
-  if (b4 (x) < -LDBL_EPSILON)
-    k += b4 (x);
-  if (b5 (x) < -LDBL_EPSILON)
-    k += b5 (x);
-  if (b6 (x) < -LDBL_EPSILON)
-    k += b6 (x);
-  if (b7 (x) < -LDBL_EPSILON)
-    k += b7 (x);
-  if (b8 (x) < -LDBL_EPSILON)
-    k += b8 (x);
-  if (b9 (x) < -LDBL_EPSILON)
-    k += b9 (x);
-  if (k < -LDBL_EPSILON)
-    return 20.L - k;
-  k = 0.L;
-  C = c0 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c1 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c2 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c3 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c4 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c5 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c6 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c7 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c8 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c9 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  if (k == 0.L || k > 20.L)
-    return 20.L;
-  return k;
-}
+  // maximum of the c coefficients (the 13 steps methods check c11 instead of
+  // c12)
+  m = (nsteps == 13) ? 12 : nsteps;
+  for (i = 0; i < m; ++i)
+    {
+      y = x + 2 * i * OPTIMIZE_BATCH;
+      z = y + OPTIMIZE_BATCH;
+      for (l = 0; l < OPTIMIZE_BATCH; ++l)
+        {
+          C = z[l] / y[l];
+          kn[l] += (C < -REAL_EPSILON) ? 1. : 0.;
+          kc[l] = (C > kc[l]) ? C : kc[l];
+        }
+    }
 
-/**
- * Function to get the objective function of a 11 steps mult-steps method.
- * 
- * \return objective function value.
- */
-static long double
-steps_objective_11 (Optimize * optimize)        ///< Optimize struct.
-{
-  register long double *x;
-  register long double k, C;
-  x = optimize->coefficient;
-  k = 0.L;
-  if (a0 (x) < -LDBL_EPSILON)
-    k += a0 (x);
-  if (a1 (x) < -LDBL_EPSILON)
-    k += a1 (x);
-  if (a2 (x) < -LDBL_EPSILON)
-    k += a2 (x);
-  if (a3 (x) < -LDBL_EPSILON)
-    k += a3 (x);
-  if (a4 (x) < -LDBL_EPSILON)
-    k += a4 (x);
-  if (a5 (x) < -LDBL_EPSILON)
-    k += a5 (x);
-  if (a6 (x) < -LDBL_EPSILON)
-    k += a6 (x);
-  if (a7 (x) < -LDBL_EPSILON)
-    k += a7 (x);
-  if (a8 (x) < -LDBL_EPSILON)
-    k += a8 (x);
-  if (a9 (x) < -LDBL_EPSILON)
-    k += a9 (x);
-  if (a10 (x) < -LDBL_EPSILON)
-    k += a10 (x);
-  if (k < -LDBL_EPSILON)
-    return 30.L - k;
-  k = 0.L;
-  if (b0 (x) < -LDBL_EPSILON)
-    k += b0 (x);
-  if (b1 (x) < -LDBL_EPSILON)
-    k += b1 (x);
-  if (b2 (x) < -LDBL_EPSILON)
-    k += b2 (x);
-  if (b3 (x) < -LDBL_EPSILON)
-    k += b3 (x);
-  if (b4 (x) < -LDBL_EPSILON)
-    k += b4 (x);
-  if (b5 (x) < -LDBL_EPSILON)
-    k += b5 (x);
-  if (b6 (x) < -LDBL_EPSILON)
-    k += b6 (x);
-  if (b7 (x) < -LDBL_EPSILON)
-    k += b7 (x);
-  if (b8 (x) < -LDBL_EPSILON)
-    k += b8 (x);
-  if (b9 (x) < -LDBL_EPSILON)
-    k += b9 (x);
-  if (b10 (x) < -LDBL_EPSILON)
-    k += b10 (x);
-  if (k < -LDBL_EPSILON)
-    return 20.L - k;
-  k = 0.L;
-  C = c0 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c1 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c2 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c3 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c4 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c5 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c6 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c7 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c8 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c9 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c10 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  if (k == 0.L || k > 20.L)
-    return 20.L;
-  return k;
+  // objective function values
+  for (l = 0; l < OPTIMIZE_BATCH; ++l)
+    o[l] = (ka[l] < -REAL_EPSILON) ? 30. - ka[l]
+      : (kb[l] < -REAL_EPSILON) ? 20. - kb[l]
+      : (kn[l] > 0. || kc[l] == 0. || kc[l] > 20.) ? 20. : kc[l];
 }
 
 /**
- * Function to get the objective function of a 12 steps mult-steps method.
- * 
- * \return objective function value.
+ * Function to solve a linear equations system by the Gaussian elimination
+ * method with partial pivoting. The system matrix is stored by rows, every row
+ * followed by the values of the independent terms, so the system is solved at
+ * once for all the independent terms columns. The solutions are stored on the
+ * independent terms columns.
+ *
+ * \return 1 on success, 0 on singular matrix.
  */
-static long double
-steps_objective_12 (Optimize * optimize)        ///< Optimize struct.
+static int
+steps_solve (Real *M,           ///< augmented matrix.
+             unsigned int n,    ///< equations number.
+             unsigned int m)    ///< independent terms columns number.
 {
-  register long double *x;
-  register long double k, C;
-  x = optimize->coefficient;
-  k = 0.L;
-  if (a0 (x) < -LDBL_EPSILON)
-    k += a0 (x);
-  if (a1 (x) < -LDBL_EPSILON)
-    k += a1 (x);
-  if (a2 (x) < -LDBL_EPSILON)
-    k += a2 (x);
-  if (a3 (x) < -LDBL_EPSILON)
-    k += a3 (x);
-  if (a4 (x) < -LDBL_EPSILON)
-    k += a4 (x);
-  if (a5 (x) < -LDBL_EPSILON)
-    k += a5 (x);
-  if (a6 (x) < -LDBL_EPSILON)
-    k += a6 (x);
-  if (a7 (x) < -LDBL_EPSILON)
-    k += a7 (x);
-  if (a8 (x) < -LDBL_EPSILON)
-    k += a8 (x);
-  if (a9 (x) < -LDBL_EPSILON)
-    k += a9 (x);
-  if (a10 (x) < -LDBL_EPSILON)
-    k += a10 (x);
-  if (a11 (x) < -LDBL_EPSILON)
-    k += a11 (x);
-  if (k < -LDBL_EPSILON)
-    return 30.L - k;
-  k = 0.L;
-  if (b0 (x) < -LDBL_EPSILON)
-    k += b0 (x);
-  if (b1 (x) < -LDBL_EPSILON)
-    k += b1 (x);
-  if (b2 (x) < -LDBL_EPSILON)
-    k += b2 (x);
-  if (b3 (x) < -LDBL_EPSILON)
-    k += b3 (x);
-  if (b4 (x) < -LDBL_EPSILON)
-    k += b4 (x);
-  if (b5 (x) < -LDBL_EPSILON)
-    k += b5 (x);
-  if (b6 (x) < -LDBL_EPSILON)
-    k += b6 (x);
-  if (b7 (x) < -LDBL_EPSILON)
-    k += b7 (x);
-  if (b8 (x) < -LDBL_EPSILON)
-    k += b8 (x);
-  if (b9 (x) < -LDBL_EPSILON)
-    k += b9 (x);
-  if (b10 (x) < -LDBL_EPSILON)
-    k += b10 (x);
-  if (b11 (x) < -LDBL_EPSILON)
-    k += b11 (x);
-  if (k < -LDBL_EPSILON)
-    return 20.L - k;
-  k = 0.L;
-  C = c0 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c1 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c2 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c3 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c4 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c5 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c6 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c7 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c8 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c9 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c10 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c11 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  if (k == 0.L || k > 20.L)
-    return 20.L;
-  return k;
+  Real *x, *y;
+  Real k;
+  unsigned int i, j, l, p, w;
+  w = n + m;
+  for (i = 0; i < n; ++i)
+    {
+      for (j = i + 1, p = i; j < n; ++j)
+        if (fabsr (M[j * w + i]) > fabsr (M[p * w + i]))
+          p = j;
+      if (M[p * w + i] == REAL (0.))
+        return 0;
+      x = M + i * w;
+      if (p != i)
+        for (y = M + p * w, l = i; l < w; ++l)
+          k = x[l], x[l] = y[l], y[l] = k;
+      for (j = i + 1; j < n; ++j)
+        {
+          y = M + j * w;
+          k = y[i] / x[i];
+          for (l = i; l < w; ++l)
+            y[l] -= k * x[l];
+        }
+    }
+  for (i = n; i-- > 0;)
+    {
+      x = M + i * w;
+      for (l = n; l < w; ++l)
+        {
+          for (j = i + 1, k = x[l]; j < n; ++j)
+            k -= x[j] * M[j * w + l];
+          x[l] = k / x[i];
+        }
+    }
+  return 1;
 }
 
 /**
- * Function to get the objective function of a 13 steps mult-steps method.
- * 
- * \return objective function value.
+ * Function to build the affine map of the freedom degrees to the coefficients
+ * of a multi-steps method. The order conditions are linear on the
+ * coefficients, so the system of the 2nd to the highest order conditions
+ * giving b1, ..., b(order-1) is built and solved only once, for the constant
+ * terms and for every freedom degree. Then b0 and a0 are obtained by the 1st
+ * and 0th order conditions. The map is stored on the data field as a matrix
+ * with a row of nfree + 1 values per coefficient in Real precision,
+ * followed by the same matrix in double precision for the batched evaluation
+ * and by the list of the coefficients depending on every freedom degree (the
+ * number of coefficients and their indexes) for the hill climbing probes.
+ * The map is rounded differently than the steps_N_M functions, which give the
+ * coefficients of the simulations.
+ *
+ * \return 1 on success, 0 on error.
  */
-static long double
-steps_objective_13 (Optimize * optimize)        ///< Optimize struct.
+static int
+steps_affine (Optimize * optimize)      ///< Optimize struct.
 {
-  register long double *x;
-  register long double k, C;
-  x = optimize->coefficient;
-  k = 0.L;
-  if (a0 (x) < -LDBL_EPSILON)
-    k += a0 (x);
-  if (a1 (x) < -LDBL_EPSILON)
-    k += a1 (x);
-  if (a2 (x) < -LDBL_EPSILON)
-    k += a2 (x);
-  if (a3 (x) < -LDBL_EPSILON)
-    k += a3 (x);
-  if (a4 (x) < -LDBL_EPSILON)
-    k += a4 (x);
-  if (a5 (x) < -LDBL_EPSILON)
-    k += a5 (x);
-  if (a6 (x) < -LDBL_EPSILON)
-    k += a6 (x);
-  if (a7 (x) < -LDBL_EPSILON)
-    k += a7 (x);
-  if (a8 (x) < -LDBL_EPSILON)
-    k += a8 (x);
-  if (a9 (x) < -LDBL_EPSILON)
-    k += a9 (x);
-  if (a10 (x) < -LDBL_EPSILON)
-    k += a10 (x);
-  if (a11 (x) < -LDBL_EPSILON)
-    k += a11 (x);
-  if (a12 (x) < -LDBL_EPSILON)
-    k += a12 (x);
-  if (k < -LDBL_EPSILON)
-    return 30.L - k;
-  k = 0.L;
-  if (b0 (x) < -LDBL_EPSILON)
-    k += b0 (x);
-  if (b1 (x) < -LDBL_EPSILON)
-    k += b1 (x);
-  if (b2 (x) < -LDBL_EPSILON)
-    k += b2 (x);
-  if (b3 (x) < -LDBL_EPSILON)
-    k += b3 (x);
-  if (b4 (x) < -LDBL_EPSILON)
-    k += b4 (x);
-  if (b5 (x) < -LDBL_EPSILON)
-    k += b5 (x);
-  if (b6 (x) < -LDBL_EPSILON)
-    k += b6 (x);
-  if (b7 (x) < -LDBL_EPSILON)
-    k += b7 (x);
-  if (b8 (x) < -LDBL_EPSILON)
-    k += b8 (x);
-  if (b9 (x) < -LDBL_EPSILON)
-    k += b9 (x);
-  if (b10 (x) < -LDBL_EPSILON)
-    k += b10 (x);
-  if (b11 (x) < -LDBL_EPSILON)
-    k += b11 (x);
-  if (b12 (x) < -LDBL_EPSILON)
-    k += b12 (x);
-  if (k < -LDBL_EPSILON)
-    return 20.L - k;
-  k = 0.L;
-  C = c0 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c1 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c2 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c3 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c4 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c5 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c6 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c7 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c8 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c9 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c10 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c11 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  C = c12 (x);
-  if (C < -LDBL_EPSILON)
-    return 20.L;
-  if (!isnan (C))
-    k = fmaxl (k, C);
-  if (k == 0.L || k > 20.L)
-    return 20.L;
-  return k;
+  Real *A, *M, *a, *m;
+  double *D;
+  Real p, s;
+  unsigned int *dep;
+  unsigned int i, j, k, l, n, q, w, nfree, nsteps, order, size;
+  nsteps = optimize->nsteps;
+  order = optimize->order;
+  nfree = optimize->nfree;
+  size = optimize->size;
+  n = nfree + 1;
+  A = (Real *) g_slice_alloc (steps_data_size (size, nfree));
+  D = (double *) (A + size * n);
+  dep = (unsigned int *) (D + size * n);
+  memset (A, 0, size * n * sizeof (Real));
+
+  // free a1, ..., a(nsteps-1) and b(nsteps-1), ..., border coefficients
+  for (i = 1; i < nsteps; ++i)
+    A[2 * i * n + i] = REAL (1.);
+  for (i = order; i < nsteps; ++i)
+    A[(2 * i + 1) * n + 2 * nsteps - 1 - i] = REAL (1.);
+
+  // 2nd to order-th order conditions
+  k = order - 1;
+  w = k + n;
+  M = (Real *) alloca (k * w * sizeof (Real));
+  for (q = 2, s = -REAL (1.); q <= order; ++q, s = -s)
+    {
+      m = M + (q - 2) * w;
+      for (j = 1; j < order; ++j)
+        {
+          for (l = 1, p = q; l < q; ++l)
+            p *= j;
+          m[j - 1] = p;
+        }
+      m += k;
+      m[0] = s;
+      for (l = 1; l < n; ++l)
+        m[l] = REAL (0.);
+      for (i = 1; i < nsteps; ++i)
+        {
+          for (l = 0, p = REAL (1.); l < q; ++l)
+            p *= i;
+          for (a = A + 2 * i * n, l = 0; l < n; ++l)
+            m[l] += p * a[l];
+        }
+      for (i = order; i < nsteps; ++i)
+        {
+          for (l = 1, p = q; l < q; ++l)
+            p *= i;
+          for (a = A + (2 * i + 1) * n, l = 0; l < n; ++l)
+            m[l] -= p * a[l];
+        }
+    }
+  if (!steps_solve (M, k, n))
+    goto exit_on_error;
+  for (j = 1; j < order; ++j)
+    memcpy (A + (2 * j + 1) * n, M + (j - 1) * w + k,
+            n * sizeof (Real));
+
+  // 1st and 0th order conditions
+  A[n] = A[0] = REAL (1.);
+  for (i = 1; i < nsteps; ++i)
+    for (l = 0; l < n; ++l)
+      {
+        A[n + l] += i * A[2 * i * n + l] - A[(2 * i + 1) * n + l];
+        A[l] -= A[2 * i * n + l];
+      }
+
+  // double precision map
+  for (i = 0; i < size * n; ++i)
+    D[i] = (double) A[i];
+
+  // coefficients depending on every freedom degree
+  for (j = 0; j < nfree; ++j, dep += size + 1)
+    for (i = 0, dep[0] = 0; i < size; ++i)
+      if (A[i * n + j + 1] != REAL (0.))
+        dep[++dep[0]] = i;
+  optimize->data = A;
+  optimize->probe = &steps_probe;
+  if (batch)
+    optimize->batch = steps_batch;
+  return 1;
+
+exit_on_error:
+  error_message = g_strdup (_("Singular order conditions"));
+  g_slice_free1 (steps_data_size (size, nfree), A);
+  return 0;
 }
 
 /**
@@ -5593,20 +5467,6 @@ steps_select (Optimize * optimize,      ///< Optimize struct.
               unsigned int nsteps,      ///< number of steps.
               unsigned int order)       ///< order of accuracy.
 {
-  static long double (*objective[14]) (Optimize *) =
-  {
-  NULL,
-      NULL,
-      NULL,
-      &steps_objective_3,
-      &steps_objective_4,
-      &steps_objective_5,
-      &steps_objective_6,
-      &steps_objective_7,
-      &steps_objective_8,
-      &steps_objective_9,
-      &steps_objective_10,
-      &steps_objective_11, &steps_objective_12, &steps_objective_13};
   static int (*method[14][9]) (Optimize *) =
   {
     {
@@ -5647,26 +5507,135 @@ steps_select (Optimize * optimize,      ///< Optimize struct.
     NULL, NULL, &steps_13_2, &steps_13_3, &steps_13_4, &steps_13_5,
         &steps_13_6, &steps_13_7, &steps_13_8}
   };
+#if OPTIMIZE_SPECIALIZED
+  static Real (*evaluate[14][9]) (void *) =
+  {
+    {
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+    NULL, NULL, &steps_3_2_evaluate, &steps_3_3_evaluate, NULL, NULL, NULL,
+        NULL, NULL},
+    {
+    NULL, NULL, &steps_4_2_evaluate, &steps_4_3_evaluate, &steps_4_4_evaluate,
+        NULL, NULL, NULL, NULL},
+    {
+    NULL, NULL, &steps_5_2_evaluate, &steps_5_3_evaluate, &steps_5_4_evaluate,
+        &steps_5_5_evaluate, NULL, NULL, NULL},
+    {
+    NULL, NULL, &steps_6_2_evaluate, &steps_6_3_evaluate, &steps_6_4_evaluate,
+        &steps_6_5_evaluate, &steps_6_6_evaluate, NULL, NULL},
+    {
+    NULL, NULL, &steps_7_2_evaluate, &steps_7_3_evaluate, &steps_7_4_evaluate,
+        &steps_7_5_evaluate, &steps_7_6_evaluate, &steps_7_7_evaluate, NULL},
+    {
+    NULL, NULL, &steps_8_2_evaluate, &steps_8_3_evaluate, &steps_8_4_evaluate,
+        &steps_8_5_evaluate, &steps_8_6_evaluate, &steps_8_7_evaluate,
+        &steps_8_8_evaluate},
+    {
+    NULL, NULL, &steps_9_2_evaluate, &steps_9_3_evaluate, &steps_9_4_evaluate,
+        &steps_9_5_evaluate, &steps_9_6_evaluate, &steps_9_7_evaluate,
+        &steps_9_8_evaluate},
+    {
+    NULL, NULL, &steps_10_2_evaluate, &steps_10_3_evaluate,
+        &steps_10_4_evaluate, &steps_10_5_evaluate, &steps_10_6_evaluate,
+        &steps_10_7_evaluate, &steps_10_8_evaluate},
+    {
+    NULL, NULL, &steps_11_2_evaluate, &steps_11_3_evaluate,
+        &steps_11_4_evaluate, &steps_11_5_evaluate, &steps_11_6_evaluate,
+        &steps_11_7_evaluate, &steps_11_8_evaluate},
+    {
+    NULL, NULL, &steps_12_2_evaluate, &steps_12_3_evaluate,
+        &steps_12_4_evaluate, &steps_12_5_evaluate, &steps_12_6_evaluate,
+        &steps_12_7_evaluate, &steps_12_8_evaluate},
+    {
+    NULL, NULL, &steps_13_2_evaluate, &steps_13_3_evaluate,
+        &steps_13_4_evaluate, &steps_13_5_evaluate, &steps_13_6_evaluate,
+        &steps_13_7_evaluate, &steps_13_8_evaluate}
+  };
+  static OptimizeSample sample[14][9] = {
+    {
+     NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+     NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+     NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL},
+    {
+     NULL, NULL, &steps_3_2_sample, &steps_3_3_sample, NULL, NULL, NULL, NULL,
+     NULL},
+    {
+     NULL, NULL, &steps_4_2_sample, &steps_4_3_sample, &steps_4_4_sample, NULL,
+     NULL, NULL, NULL},
+    {
+     NULL, NULL, &steps_5_2_sample, &steps_5_3_sample, &steps_5_4_sample,
+     &steps_5_5_sample, NULL, NULL, NULL},
+    {
+     NULL, NULL, &steps_6_2_sample, &steps_6_3_sample, &steps_6_4_sample,
+     &steps_6_5_sample, &steps_6_6_sample, NULL, NULL},
+    {
+     NULL, NULL, &steps_7_2_sample, &steps_7_3_sample, &steps_7_4_sample,
+     &steps_7_5_sample, &steps_7_6_sample, &steps_7_7_sample, NULL},
+    {
+     NULL, NULL, &steps_8_2_sample, &steps_8_3_sample, &steps_8_4_sample,
+     &steps_8_5_sample, &steps_8_6_sample, &steps_8_7_sample,
+     &steps_8_8_sample},
+    {
+     NULL, NULL, &steps_9_2_sample, &steps_9_3_sample, &steps_9_4_sample,
+     &steps_9_5_sample, &steps_9_6_sample, &steps_9_7_sample,
+     &steps_9_8_sample},
+    {
+     NULL, NULL, &steps_10_2_sample, &steps_10_3_sample, &steps_10_4_sample,
+     &steps_10_5_sample, &steps_10_6_sample, &steps_10_7_sample,
+     &steps_10_8_sample},
+    {
+     NULL, NULL, &steps_11_2_sample, &steps_11_3_sample, &steps_11_4_sample,
+     &steps_11_5_sample, &steps_11_6_sample, &steps_11_7_sample,
+     &steps_11_8_sample},
+    {
+     NULL, NULL, &steps_12_2_sample, &steps_12_3_sample, &steps_12_4_sample,
+     &steps_12_5_sample, &steps_12_6_sample, &steps_12_7_sample,
+     &steps_12_8_sample},
+    {
+     NULL, NULL, &steps_13_2_sample, &steps_13_3_sample, &steps_13_4_sample,
+     &steps_13_5_sample, &steps_13_6_sample, &steps_13_7_sample,
+     &steps_13_8_sample}
+  };
+#endif
 #if DEBUG_STEPS
   fprintf (stderr, "steps_run: start\n");
 #endif
-  if (nsteps < 3 || nsteps > 14 || order < 2 || order > 8)
+  if (nsteps < 3 || nsteps > 13 || order < 2 || order > 8)
     goto exit_on_error;
   optimize->nsteps = nsteps;
   optimize->order = order;
   optimize->size = 2 * nsteps;
   optimize->nfree = optimize->size - order - 1;
   optimize->minimum0
-    = (long double *) g_slice_alloc (optimize->nfree * sizeof (long double));
+    = (Real *) g_slice_alloc (optimize->nfree * sizeof (Real));
   optimize->interval0
-    = (long double *) g_slice_alloc (optimize->nfree * sizeof (long double));
+    = (Real *) g_slice_alloc (optimize->nfree * sizeof (Real));
   optimize->random_type
     = (unsigned int *) g_slice_alloc (optimize->nfree * sizeof (unsigned int));
   optimize->data = NULL;
-  optimize->objective = objective[nsteps];
+  optimize->batch = NULL;
+  optimize->probe = NULL;
+  optimize->polytope = NULL;
+  optimize->npolytope = 0;
+  optimize->nelite = 0;
+  optimize->objective = &steps_objective;
   optimize->method = method[nsteps][order];
   if (!optimize->method)
     goto exit_on_error;
+#if OPTIMIZE_SPECIALIZED
+  optimize->evaluate = evaluate[nsteps][order];
+  optimize->sample = sample[nsteps][order];
+#else
+  optimize->evaluate = NULL;
+  optimize->sample = NULL;
+#endif
 #if DEBUG_STEPS
   fprintf (stderr, "steps_select: end\n");
 #endif
@@ -5687,21 +5656,32 @@ exit_on_error:
  */
 int
 steps_run (xmlNode * node,      ///< XML node.
-           gsl_rng ** rng)      ///< array of gsl_rng structs.
+           unsigned long long int seed) ///< pseudo-random numbers seed.
 {
-  Optimize s[nthreads];
+  Optimize *s;
   char filename[64];
   gchar *buffer;
   FILE *file;
-  long double *value_optimal;
-  long double optimal;
+  Real *value_optimal;
+  Real optimal, elite;
+  xmlChar *prop;
+  size_t size;
+  unsigned long long int simulation;
   int code;
-  unsigned int i, j, nsteps, order, nfree;
+  unsigned int i, nsteps, order, nfree, sequence, feasible;
 
 #if DEBUG_STEPS
   fprintf (stderr, "steps_run: start\n");
 #endif
 
+  size = nthreads * sizeof (Optimize);
+  size = (size + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+  s = (Optimize *) aligned_alloc (CACHE_LINE_SIZE, size);
+  if (!s)
+    {
+      error_message = g_strdup (_("Not enough memory"));
+      goto exit_on_error;
+    }
   nsteps = xml_node_get_uint (node, XML_STEPS, &code);
   if (code)
     {
@@ -5714,30 +5694,98 @@ steps_run (xmlNode * node,      ///< XML node.
       error_message = g_strdup (_("Bad order"));
       goto exit_on_error;
     }
+  prop = xmlGetProp (node, XML_FEASIBLE);
+  if (!prop || !xmlStrcmp (prop, XML_NO))
+    feasible = 0;
+  else if (!xmlStrcmp (prop, XML_YES))
+    feasible = 1;
+  else
+    {
+      xmlFree (prop);
+      error_message = g_strdup (_("Bad feasible sampling"));
+      goto exit_on_error;
+    }
+  xmlFree (prop);
   if (!steps_select (s, nsteps, order))
     goto exit_on_error;
   if (!optimize_read (s, node))
     goto exit_on_error;
   nfree = s->nfree;
-  value_optimal = (long double *) g_slice_alloc (nfree * sizeof (long double));
-  optimize_create (s, &optimal, value_optimal);
+
+  // cross-entropy sampling with the elite fraction of the simulations
+  if (xmlHasProp (node, XML_ELITE))
+    {
+      elite = xml_node_get_float (node, XML_ELITE, &code);
+      if (code || !(elite > REAL (0.)) || elite > REAL (1.))
+        {
+          error_message = g_strdup (_("Bad elite fraction"));
+          goto exit_on_error;
+        }
+      if (feasible || nnodes > 1)
+        {
+          error_message
+            = g_strdup (_("Cross-entropy sampling not available with feasible "
+                          "sampling or several nodes"));
+          goto exit_on_error;
+        }
+      elite *= (Real) s->nsimulations;
+      if (elite > (Real) (UINT_MAX / (nfree + 1)))
+        {
+          error_message = g_strdup (_("Too many elite simulations"));
+          goto exit_on_error;
+        }
+      s->nelite = (unsigned int) elite;
+      if (s->nelite < 2)
+        s->nelite = 2;
+      if (asynchronous)
+        {
+          printf ("Asynchronous mode disabled with the cross-entropy "
+                  "sampling\n");
+          asynchronous = 0;
+        }
+    }
+  value_optimal = (Real *) g_slice_alloc (nfree * sizeof (Real));
+  optimize_create (s, &optimal, value_optimal, &sequence, &simulation);
   node = node->children;
   for (i = 0; i < nfree; ++i, node = node->next)
     if (!read_variable (node, s->minimum0, s->interval0, s->random_type, i))
       goto exit_on_error;
+  if (!steps_affine (s))
+    goto exit_on_error;
+
+  // the coefficients are affine on the freedom degrees, so the feasible
+  // region of non-negative coefficients is the polytope of the affine map
+  if (feasible)
+    {
+      s->polytope = (const Real *) s->data;
+      s->npolytope = s->size;
+    }
   for (i = 1; i < nthreads; ++i)
     memcpy (s + i, s, sizeof (Optimize));
-  j = rank * nthreads;
   for (i = 0; i < nthreads; ++i)
-    optimize_init (s + i, rng[j + i], i);
+    {
+      s[i].seed = seed;
+      s[i].thread = i;
+    }
+  pool_run ((PoolFunction) (void (*)(void)) optimize_init, s,
+            sizeof (Optimize));
+  for (i = 0; i < nthreads; ++i)
+    if (!s[i].random_data)
+      {
+        for (i = 0; i < nthreads; ++i)
+          optimize_delete (s + i);
+        error_message = g_strdup (_("Not enough memory"));
+        goto exit_on_error;
+      }
 
   // Method bucle
   printf ("Optimize bucle\n");
   optimize_bucle (s);
+  optimize_print_rejected (s, sizeof (Optimize), "multi-steps");
 
   // Print the optimal coefficients
   printf ("Print the optimal coefficients\n");
-  memcpy (s->random_data, s->value_optimal, nfree * sizeof (long double));
+  memcpy (s->random_data, s->value_optimal, nfree * sizeof (Real));
   code = s->method (s);
   snprintf (filename, 64, "steps-%u-%u.mc", nsteps, order);
   file = fopen (filename, "w");
@@ -5752,11 +5800,13 @@ steps_run (xmlNode * node,      ///< XML node.
 
   // Free memory
   g_slice_free1 (nfree * sizeof (unsigned int), s->random_type);
-  g_slice_free1 (nfree * sizeof (long double), s->interval0);
-  g_slice_free1 (nfree * sizeof (long double), s->minimum0);
+  g_slice_free1 (nfree * sizeof (Real), s->interval0);
+  g_slice_free1 (nfree * sizeof (Real), s->minimum0);
   for (i = 0; i < nthreads; ++i)
     optimize_delete (s + i);
-  g_slice_free1 (nfree * sizeof (long double), value_optimal);
+  g_slice_free1 (steps_data_size (s->size, nfree), s->data);
+  g_slice_free1 (nfree * sizeof (Real), value_optimal);
+  free (s);
 
 #if DEBUG_STEPS
   fprintf (stderr, "steps_run: end\n");
@@ -5764,6 +5814,7 @@ steps_run (xmlNode * node,      ///< XML node.
   return 1;
 
 exit_on_error:
+  free (s);
   buffer = error_message;
   error_message = g_strconcat ("Multi-steps:\n", buffer, NULL);
   g_free (buffer);
@@ -35,6 +35,6 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef STEPS__H
 #define STEPS__H 1
 
-int steps_run (xmlNode * node, gsl_rng ** rng);
+int steps_run (xmlNode * node, unsigned long long int seed);
 
 #endif
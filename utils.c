@@ -37,11 +37,53 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <libxml/parser.h>
 #include <glib.h>
 #include <libintl.h>
-#include <gsl/gsl_rng.h>
 #include "config.h"
 #include "utils.h"
 
 gchar *error_message = NULL;    ///< error message string.
+unsigned int random_sobol_direction[RANDOM_DIMENSIONS][32];
+///< direction numbers of the Sobol sequence.
+const unsigned int random_prime[RANDOM_DIMENSIONS] = {
+  2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71,
+  73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131
+};                              ///< prime bases of the Halton sequence.
+
+static const unsigned int random_sobol_polynomial[RANDOM_DIMENSIONS - 1][9] = {
+  {1, 0, 1},
+  {2, 1, 1, 3},
+  {3, 1, 1, 3, 1},
+  {3, 2, 1, 1, 1},
+  {4, 1, 1, 1, 3, 3},
+  {4, 4, 1, 3, 5, 13},
+  {5, 2, 1, 1, 5, 5, 17},
+  {5, 4, 1, 1, 5, 5, 5},
+  {5, 7, 1, 1, 7, 11, 19},
+  {5, 11, 1, 1, 5, 1, 1},
+  {5, 13, 1, 1, 1, 3, 11},
+  {5, 14, 1, 3, 5, 5, 31},
+  {6, 1, 1, 3, 3, 9, 7, 49},
+  {6, 13, 1, 1, 1, 15, 21, 21},
+  {6, 16, 1, 3, 1, 13, 27, 49},
+  {6, 19, 1, 1, 1, 15, 7, 5},
+  {6, 22, 1, 3, 1, 15, 13, 25},
+  {6, 25, 1, 1, 5, 5, 19, 61},
+  {7, 1, 1, 3, 7, 11, 23, 15, 103},
+  {7, 4, 1, 3, 7, 13, 13, 15, 69},
+  {7, 7, 1, 1, 3, 13, 7, 35, 63},
+  {7, 8, 1, 3, 5, 9, 1, 25, 53},
+  {7, 14, 1, 3, 1, 13, 9, 35, 107},
+  {7, 19, 1, 3, 1, 5, 27, 61, 31},
+  {7, 21, 1, 1, 5, 11, 19, 41, 61},
+  {7, 28, 1, 3, 5, 3, 3, 13, 69},
+  {7, 31, 1, 1, 7, 13, 1, 19, 1},
+  {7, 32, 1, 3, 7, 5, 13, 19, 59},
+  {7, 37, 1, 1, 3, 9, 25, 29, 41},
+  {7, 41, 1, 3, 5, 13, 23, 1, 55},
+  {7, 42, 1, 3, 7, 3, 13, 59, 17}
+};
+///< degree, coefficients and initial direction numbers of the primitive
+///< polynomials of the Sobol sequence on every dimension after the first one
+///< (Joe and Kuo, 2008).
 
 /**
  * Function to print an error message.
@@ -104,6 +146,32 @@ xml_node_get_uint (xmlNode * node,      ///< XML node.
   return i;
 }
 
+/**
+ * Function to get an unsigned long integer number of a XML node property.
+ *
+ * \return Unsigned long integer number value.
+ */
+unsigned long long int
+xml_node_get_ulong (xmlNode * node,     ///< XML node.
+                    const xmlChar * prop,       ///< XML property.
+                    int *error_code)    ///< Error code.
+{
+  unsigned long long int i = 0;
+  xmlChar *buffer;
+  buffer = xmlGetProp (node, prop);
+  if (!buffer)
+    *error_code = 1;
+  else
+    {
+      if (sscanf ((char *) buffer, "%llu", &i) != 1)
+        *error_code = 2;
+      else
+        *error_code = 0;
+      xmlFree (buffer);
+    }
+  return i;
+}
+
 /**
  * Function to get an unsigned integer number of a XML node property with a
  *   default value.
@@ -129,23 +197,33 @@ xml_node_get_uint_with_default (xmlNode * node, ///< XML node.
 }
 
 /**
- * Function to get an long double number of a XML node property.
+ * Function to get a Real number of a XML node property.
  *
- * \return Long double number value.
+ * \return Real number value.
  */
-long double
+Real
 xml_node_get_float (xmlNode * node,     ///< XML node.
                     const xmlChar * prop,       ///< XML property.
                     int *error_code)    ///< Error code.
 {
-  long double x = 0.L;
+  Real x = REAL (0.);
   xmlChar *buffer;
+#if PRECISION == 3
+  char *end;
+#endif
   buffer = xmlGetProp (node, prop);
   if (!buffer)
     *error_code = 1;
   else
     {
+#if PRECISION == 1
+      if (sscanf ((char *) buffer, "%lg", &x) != 1)
+#elif PRECISION == 2
       if (sscanf ((char *) buffer, "%Lg", &x) != 1)
+#else
+      x = strtoflt128 ((char *) buffer, &end);
+      if (end == (char *) buffer)
+#endif
         *error_code = 2;
       else
         *error_code = 0;
@@ -162,8 +240,8 @@ xml_node_get_float (xmlNode * node,     ///< XML node.
  */
 int
 read_variable (xmlNode * node,  ///< XML node.
-               long double *minimum,    ///< minimum value.
-               long double *interval,   ///< interval value.
+               Real *minimum,   ///< minimum value.
+               Real *interval,  ///< interval value.
                unsigned int *type,      ///< random function type.
                unsigned int n)  ///< variable number.
 {
@@ -207,6 +285,10 @@ read_variable (xmlNode * node,  ///< XML node.
     type[n] = RANDOM_TYPE_REGULAR;
   else if (!xmlStrcmp (prop, XML_ORTHOGONAL))
     type[n] = RANDOM_TYPE_ORTHOGONAL;
+  else if (!xmlStrcmp (prop, XML_SOBOL))
+    type[n] = RANDOM_TYPE_SOBOL;
+  else if (!xmlStrcmp (prop, XML_HALTON))
+    type[n] = RANDOM_TYPE_HALTON;
   else
     {
       xmlFree (prop);
@@ -214,6 +296,12 @@ read_variable (xmlNode * node,  ///< XML node.
       goto exit_on_error;
     }
   xmlFree (prop);
+  if ((type[n] == RANDOM_TYPE_SOBOL || type[n] == RANDOM_TYPE_HALTON)
+      && n >= RANDOM_DIMENSIONS)
+    {
+      error_message = g_strdup (_("Too many low-discrepancy variables"));
+      goto exit_on_error;
+    }
   return 1;
 
 exit_on_error:
@@ -233,3 +321,33 @@ print_maxima_precision (FILE * file)    ///< maxima program file.
 {
   fprintf (file, "fpprec:%u;\nfpprintprec:fpprec;\n", MAXIMA_PRECISION);
 }
+
+/**
+ * Function to init the direction numbers of the Sobol sequence.
+ */
+void
+random_sobol_init (void)
+{
+  const unsigned int *p;
+  unsigned int *v;
+  unsigned int i, j, k, a, d;
+  v = random_sobol_direction[0];
+  for (j = 0; j < 32; ++j)
+    v[j] = 1u << (31 - j);
+  for (i = 1; i < RANDOM_DIMENSIONS; ++i)
+    {
+      p = random_sobol_polynomial[i - 1];
+      v = random_sobol_direction[i];
+      d = p[0];
+      a = p[1];
+      for (j = 0; j < d; ++j)
+        v[j] = p[j + 2] << (31 - j);
+      for (; j < 32; ++j)
+        {
+          v[j] = v[j - d] ^ (v[j - d] >> d);
+          for (k = 1; k < d; ++k)
+            if ((a >> (d - 1 - k)) & 1)
+              v[j] ^= v[j - k];
+        }
+    }
+}
@@ -36,6 +36,80 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define _(x) (gettext(x))       ///< macro to translate messages.
 
+#if PRECISION == 1
+
+typedef double Real;            ///< scalar type of the optimization.
+#define REAL(x) x               ///< macro to write a Real constant.
+#define REAL_EPSILON DBL_EPSILON        ///< epsilon of the Real type.
+#define REAL_E "%.16e"
+///< format to print a Real number with all the significant digits.
+#define REAL_G "%g"             ///< short format to print a Real number.
+#define real_e(x) (x)           ///< argument to print by the REAL_E format.
+#define real_g(x) (x)           ///< argument to print by the REAL_G format.
+#define fabsr fabs              ///< absolute value function of Real numbers.
+#define fmaxr fmax              ///< maximum function of Real numbers.
+#define fminr fmin              ///< minimum function of Real numbers.
+#define sqrtr sqrt              ///< square root function of Real numbers.
+#define nextafterr nextafter
+///< next representable Real number function.
+
+#elif PRECISION == 2
+
+typedef long double Real;       ///< scalar type of the optimization.
+#define REAL(x) x##L            ///< macro to write a Real constant.
+#define REAL_EPSILON LDBL_EPSILON       ///< epsilon of the Real type.
+#define REAL_E "%.19Le"
+///< format to print a Real number with all the significant digits.
+#define REAL_G "%Lg"            ///< short format to print a Real number.
+#define real_e(x) (x)           ///< argument to print by the REAL_E format.
+#define real_g(x) (x)           ///< argument to print by the REAL_G format.
+#define fabsr fabsl             ///< absolute value function of Real numbers.
+#define fmaxr fmaxl             ///< maximum function of Real numbers.
+#define fminr fminl             ///< minimum function of Real numbers.
+#define sqrtr sqrtl             ///< square root function of Real numbers.
+#define nextafterr nextafterl
+///< next representable Real number function.
+
+#elif PRECISION == 3
+
+#include <quadmath.h>
+
+typedef __float128 Real;        ///< scalar type of the optimization.
+#define REAL(x) x##Q            ///< macro to write a Real constant.
+#define REAL_EPSILON FLT128_EPSILON     ///< epsilon of the Real type.
+#define REAL_E "%s"
+///< format to print a Real number with all the significant digits.
+#define REAL_G "%s"             ///< short format to print a Real number.
+#define real_e(x) (real_string ((char[48]) { 0 }, "%.35Qe", x))
+///< argument to print by the REAL_E format.
+#define real_g(x) (real_string ((char[48]) { 0 }, "%Qg", x))
+///< argument to print by the REAL_G format.
+#define fabsr fabsq             ///< absolute value function of Real numbers.
+#define fmaxr fmaxq             ///< maximum function of Real numbers.
+#define fminr fminq             ///< minimum function of Real numbers.
+#define sqrtr sqrtq             ///< square root function of Real numbers.
+#define nextafterr nextafterq
+///< next representable Real number function.
+
+/**
+ * Function to write a Real number on a string, as the printf functions can not
+ * print the __float128 numbers.
+ *
+ * \return string.
+ */
+static inline char *
+real_string (char *buffer,      ///< string of 48 characters.
+             const char *format,        ///< quadmath_snprintf format.
+             Real x)            ///< Real number.
+{
+  quadmath_snprintf (buffer, 48, format, x);
+  return buffer;
+}
+
+#else
+#error "Unknown PRECISION"
+#endif
+
 ///> enumeration to define the random numbers generation behaviour.
 enum RandomType
 {
@@ -44,36 +118,291 @@ enum RandomType
   RANDOM_TYPE_EXTREME = 2,      ///< extreme values higher probability.
   RANDOM_TYPE_TOP = 3,          ///< top higher probability.
   RANDOM_TYPE_REGULAR = 4,      ///< regular systematic sweep.
-  RANDOM_TYPE_ORTHOGONAL = 5    ///< orthogonal sampling.
+  RANDOM_TYPE_ORTHOGONAL = 5,   ///< orthogonal sampling.
+  RANDOM_TYPE_SOBOL = 6,        ///< scrambled Sobol sequence.
+  RANDOM_TYPE_HALTON = 7        ///< scrambled Halton sequence.
 };
 
 extern GMutex mutex[1];
 extern gchar *error_message;
+extern unsigned int random_sobol_direction[RANDOM_DIMENSIONS][32];
+extern const unsigned int random_prime[RANDOM_DIMENSIONS];
 
 void show_error (const char *message);
 int xml_node_get_int (xmlNode * node, const xmlChar * prop, int *error_code);
 unsigned int
 xml_node_get_uint (xmlNode * node, const xmlChar * prop, int *error_code);
+unsigned long long int
+xml_node_get_ulong (xmlNode * node, const xmlChar * prop, int *error_code);
 unsigned int
 xml_node_get_uint_with_default (xmlNode * node, const xmlChar * prop,
                                 unsigned int default_value, int *error_code);
-long double
+Real
 xml_node_get_float (xmlNode * node, const xmlChar * prop, int *error_code);
-int read_variable (xmlNode * node, long double *minimum, long double *interval,
+int read_variable (xmlNode * node, Real *minimum, Real *interval,
                    unsigned int *type, unsigned int n);
 void print_maxima_precision (FILE * file);
+void random_sobol_init (void);
 
 /**
  * Function to print the random variables on a file.
  */
 static inline void
-print_variables (long double *r,        ///< random variables.
+print_variables (Real *r,       ///< random variables.
                  unsigned int nfree,    ///< number of freedom degrees.
                  FILE * file)   ///< file.
 {
   unsigned int i;
   for (i = 0; i < nfree; ++i)
-    fprintf (file, "%.19Le ", r[i]);
+    fprintf (file, REAL_E " ", real_e (r[i]));
+}
+
+/**
+ * Function to generate pseudo-random numbers uniformly distributed in [0,1) by
+ * a Philox-4x32-10 counter-based generator. Every number depends only on the
+ * seed, the iteration, the simulation number and the variable number, so the
+ * results do not depend on the distribution of the simulations between the
+ * threads and nodes. The 128 bits blocks of RANDOM_LANES counters are computed
+ * together to allow the vectorization of the rounds by the compiler.
+ */
+static inline void
+random_uniform (double *u,
+                ///< array of random numbers (nvariables per simulation).
+                unsigned long long int simulation,
+                ///< first simulation number.
+                unsigned int nsimulations,      ///< number of simulations.
+                unsigned int nvariables,
+                ///< number of random numbers per simulation.
+                unsigned int iteration, ///< iteration number.
+                unsigned long long int seed)    ///< seed.
+{
+  unsigned long long int s, p0, p1;
+  unsigned int c0[RANDOM_LANES], c1[RANDOM_LANES], c2[RANDOM_LANES],
+    c3[RANDOM_LANES];
+  unsigned int i, j, k, k0, k1, l, m, nblocks, n;
+
+  // 2 random numbers of 53 bits per block of 128 bits
+  nblocks = (nvariables + 1) / 2;
+  n = nsimulations * nblocks;
+  for (i = 0; i < n; i += m)
+    {
+      m = (n - i > RANDOM_LANES) ? RANDOM_LANES : n - i;
+
+      // counters: simulation number, iteration and block number
+      for (l = 0; l < m; ++l)
+        {
+          s = simulation + (i + l) / nblocks;
+          c0[l] = (unsigned int) s;
+          c1[l] = (unsigned int) (s >> 32);
+          c2[l] = iteration;
+          c3[l] = (i + l) % nblocks;
+        }
+
+      // 10 rounds
+      k0 = (unsigned int) seed;
+      k1 = (unsigned int) (seed >> 32);
+      for (k = 0; k < 10; ++k)
+        {
+          for (l = 0; l < m; ++l)
+            {
+              p0 = 0xD2511F53ull * c0[l];
+              p1 = 0xCD9E8D57ull * c2[l];
+              c0[l] = (unsigned int) (p1 >> 32) ^ c1[l] ^ k0;
+              c1[l] = (unsigned int) p1;
+              c2[l] = (unsigned int) (p0 >> 32) ^ c3[l] ^ k1;
+              c3[l] = (unsigned int) p0;
+            }
+          k0 += 0x9E3779B9u;
+          k1 += 0xBB67AE85u;
+        }
+
+      // random numbers
+      for (l = 0; l < m; ++l)
+        {
+          j = (i + l) / nblocks * nvariables + (i + l) % nblocks * 2;
+          u[j] = 0x1p-53 * (((unsigned long long int) c0[l] << 21)
+                            ^ (c1[l] >> 11));
+          if ((i + l) % nblocks * 2 + 1 < nvariables)
+            u[j + 1] = 0x1p-53 * (((unsigned long long int) c2[l] << 21)
+                                  ^ (c3[l] >> 11));
+        }
+    }
+}
+
+/**
+ * Function to transform an uniform random number in [0,1) in a normal
+ * distributed random number, by the rational approximation of the inverse of
+ * the normal distribution function of P. J. Acklam (relative error lower than
+ * 1.2e-9, enough to sample).
+ *
+ * \return normal random number.
+ */
+static inline double
+random_normal (double u)        ///< uniform random number.
+{
+  const double a[6] = { -3.969683028665376e+01, 2.209460984245205e+02,
+    -2.759285104469687e+02, 1.383577518672690e+02, -3.066479806614716e+01,
+    2.506628277459239e+00
+  };
+  const double b[5] = { -5.447609879822406e+01, 1.615858368580409e+02,
+    -1.556989798598866e+02, 6.680131188771972e+01, -1.328068155288572e+01
+  };
+  const double c[6] = { -7.784894002430293e-03, -3.223964580411365e-01,
+    -2.400758277161838e+00, -2.549732539343734e+00, 4.374664141464968e+00,
+    2.938163982698783e+00
+  };
+  const double d[4] = { 7.784695709041462e-03, 3.224671290700398e-01,
+    2.445134137142996e+00, 3.754408661907416e+00
+  };
+  double q, r, x;
+  if (u <= 0.)
+    u = 0x1p-54;
+  if (u < 0.02425)
+    {
+      q = sqrt (-2. * log (u));
+      x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q
+           + c[5]) / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.);
+    }
+  else if (u > 1. - 0.02425)
+    {
+      q = sqrt (-2. * log (1. - u));
+      x = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q
+            + c[5]) / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.);
+    }
+  else
+    {
+      q = u - 0.5;
+      r = q * q;
+      x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r
+           + a[5]) * q / (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r
+                           + b[4]) * r + 1.);
+    }
+  return x;
+}
+
+/**
+ * Function to mix the bits of a 64 bits integer (the splitmix64 finalizer).
+ *
+ * \return mixed integer.
+ */
+static inline unsigned long long int
+random_hash (unsigned long long int x)  ///< integer.
+{
+  x ^= x >> 30;
+  x *= 0xBF58476D1CE4E5B9ull;
+  x ^= x >> 27;
+  x *= 0x94D049BB133111EBull;
+  return x ^ (x >> 31);
+}
+
+/**
+ * Function to reverse the bits of a 32 bits integer.
+ *
+ * \return reversed integer.
+ */
+static inline unsigned int
+random_reverse (unsigned int x) ///< integer.
+{
+  x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+  x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+  x = ((x >> 4) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4);
+  x = ((x >> 8) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8);
+  return (x >> 16) | (x << 16);
+}
+
+/**
+ * Function to get the element of a random permutation of the integers in
+ * [0,n). The bits of the index are mixed by a keyed bijection on the lowest
+ * power of 2 not lower than n, repeated while the result is out of range.
+ *
+ * \return permuted index.
+ */
+static inline unsigned long long int
+random_permute (unsigned long long int index,   ///< index.
+                unsigned long long int n,       ///< number of elements.
+                unsigned long long int key)     ///< permutation key.
+{
+  unsigned long long int mask;
+  unsigned int s;
+  if (n < 2)
+    return 0;
+  mask = ~0ull >> __builtin_clzll (n - 1);
+  s = (64 - __builtin_clzll (n - 1) + 1) / 2;
+  do
+    {
+      index ^= key & mask;
+      index ^= index >> s;
+      index = (index * 0xBF58476D1CE4E5B9ull) & mask;
+      index = (index + (key >> 32)) & mask;
+      index ^= index >> s;
+      index = (index * 0x94D049BB133111EBull) & mask;
+      index ^= index >> s;
+    }
+  while (index >= n);
+  return index;
+}
+
+/**
+ * Function to calculate a point of a Sobol sequence with a nested uniform
+ * (Owen) scrambling, approximated by the Laine-Karras hash of the reversed
+ * bits. The random number fills the bits beyond the 32 bits of the sequence.
+ *
+ * \return number in [0,1).
+ */
+static inline double
+random_sobol (unsigned int index,       ///< point number.
+              unsigned int dimension,   ///< dimension number.
+              unsigned int key, ///< scrambling key.
+              double u)         ///< uniform random number in [0,1).
+{
+  const unsigned int *v;
+  unsigned int x;
+  v = random_sobol_direction[dimension];
+  for (x = 0; index; index >>= 1, ++v)
+    x ^= *v & -(index & 1);
+  x = random_reverse (x);
+  x += key;
+  x ^= x * 0x6C50B47Cu;
+  x ^= x * 0xB82F1E52u;
+  x ^= x * 0xC7AFE638u;
+  x ^= x * 0x8D22F6E6u;
+  x = random_reverse (x);
+  return 0x1p-32 * (x + u);
+}
+
+/**
+ * Function to calculate a point of a Halton sequence scrambling every digit by
+ * a random linear permutation. The digits are scrambled up to the resolution
+ * of the number of points and the random number fills the next ones.
+ *
+ * \return number in [0,1).
+ */
+static inline double
+random_halton (unsigned long long int index,    ///< point number.
+               unsigned int base,       ///< prime base.
+               unsigned long long int key,      ///< scrambling key.
+               double u,        ///< uniform random number in [0,1).
+               double n)        ///< number of points.
+{
+  unsigned long long int q;
+  double x, f, g;
+  unsigned int a, b, d;
+  g = 1. / base;
+  for (x = 0., f = 1.; index || f * n > 1.; index = q)
+    {
+      q = index / base;
+      d = (unsigned int) (index - q * base);
+
+      // random linear permutation of the digit, a in [1,base) and b in
+      // [0,base) by multiply and shift
+      key = key * 6364136223846793005ull + 1442695040888963407ull;
+      a = 1 + (unsigned int) (((key >> 32) * (base - 1)) >> 32);
+      b = (unsigned int) (((key & 0xFFFFFFFFull) * base) >> 32);
+      f *= g;
+      x += f * ((d * a + b) % base);
+    }
+  x += f * u;
+  return (x < 1.) ? x : 1. - 0x1p-53;
 }
 
 /**
@@ -82,14 +411,12 @@ print_variables (long double *r,        ///< random variables.
  *
  * \return result.
  */
-static inline long double
-random_zero (gsl_rng * rng)     ///< GSL random number generator struct data.
+static inline Real
+random_zero (double r)          ///< uniform random number in [0,1).
 {
-  register double r;
-  r = gsl_rng_uniform (rng);
   if (r <= 0.5)
-    return 0.L;
-  return 2.L * (r - 0.5L);
+    return REAL (0.);
+  return REAL (2.) * (r - REAL (0.5));
 }
 
 /**
@@ -98,16 +425,14 @@ random_zero (gsl_rng * rng)     ///< GSL random number generator struct data.
  *
  * \return result.
  */
-static inline long double
-random_extreme (gsl_rng * rng)  ///< GSL random number generator struct data.
+static inline Real
+random_extreme (double r)       ///< uniform random number in [0,1).
 {
-  register double r;
-  r = gsl_rng_uniform (rng);
   if (r <= 0.25)
-    return 0.L;
+    return REAL (0.);
   if (r >= 0.75)
-    return 1.L;
-  return 2.L * (r - 0.25L);
+    return REAL (1.);
+  return REAL (2.) * (r - REAL (0.25));
 }
 
 /**
@@ -116,14 +441,12 @@ random_extreme (gsl_rng * rng)  ///< GSL random number generator struct data.
  *
  * \return result.
  */
-static inline long double
-random_one (gsl_rng * rng)      ///< GSL random number generator struct data.
+static inline Real
+random_one (double r)           ///< uniform random number in [0,1).
 {
-  register double r;
-  r = gsl_rng_uniform (rng);
   if (r >= 0.5)
-    return 1.L;
-  return 2.L * r;
+    return REAL (1.);
+  return REAL (2.) * r;
 }
 
 /**
@@ -131,8 +454,8 @@ random_one (gsl_rng * rng)      ///< GSL random number generator struct data.
  *
  * \return result.
  */
-static inline long double
-sqr (long double x)             ///< number.
+static inline Real
+sqr (Real x)                    ///< number.
 {
   return x * x;
 }
@@ -141,23 +464,23 @@ sqr (long double x)             ///< number.
  * Function to solve a system of two linear equations.
  */
 static inline void
-solve_2 (long double *A,
+solve_2 (Real *A,
          ///< First matrix column modified by the algorithm.
-         long double *B,
+         Real *B,
          ///< Second matrix column modified by the algorithm.
-         long double *C)
+         Real *C)
  ///< Third matrix column modified by the algorithm to contain the solutions.
 {
   B[1] = A[0] * B[1] - A[1] * B[0];
   C[1] = (A[0] * C[1] - A[1] * C[0]) / B[1];
 #if EPSILON
-  if (fabsl (C[1]) < LDBL_EPSILON)
-    C[1] = 0.L;
+  if (fabsr (C[1]) < REAL_EPSILON)
+    C[1] = REAL (0.);
 #endif
   C[0] = (C[0] - B[0] * C[1]) / A[0];
 #if EPSILON
-  if (fabsl (C[0]) < LDBL_EPSILON)
-    C[0] = 0.L;
+  if (fabsr (C[0]) < REAL_EPSILON)
+    C[0] = REAL (0.);
 #endif
 }
 
@@ -165,13 +488,13 @@ solve_2 (long double *A,
  * Function to solve a system of three linear equations.
  */
 static inline void
-solve_3 (long double *A,
+solve_3 (Real *A,
          ///< First matrix column modified by the algorithm:
-         long double *B,
+         Real *B,
          ///< Second matrix column modified by the algorithm.
-         long double *C,
+         Real *C,
          ///< Third matrix column modified by the algorithm.
-         long double *D)
+         Real *D)
  ///< Fourth matrix column modified by the algorithm to contain the solutions.
 {
   B[1] = A[0] * B[1] - A[1] * B[0];
@@ -183,8 +506,8 @@ solve_3 (long double *A,
   solve_2 (B + 1, C + 1, D + 1);
   D[0] = (D[0] - B[0] * D[1] - C[0] * D[2]) / A[0];
 #if EPSILON
-  if (fabsl (D[0]) < LDBL_EPSILON)
-    D[0] = 0.L;
+  if (fabsr (D[0]) < REAL_EPSILON)
+    D[0] = REAL (0.);
 #endif
 }
 
@@ -192,15 +515,15 @@ solve_3 (long double *A,
  * Function to solve a system of fourth linear equations.
  */
 static inline void
-solve_4 (long double *A,
+solve_4 (Real *A,
          ///< First matrix column modified by the algorithm:
-         long double *B,
+         Real *B,
          ///< Second matrix column modified by the algorithm.
-         long double *C,
+         Real *C,
          ///< Third matrix column modified by the algorithm.
-         long double *D,
+         Real *D,
          ///< Fourth matrix column modified by the algorithm.
-         long double *E)
+         Real *E)
  ///< Fifth matrix column modified by the algorithm to contain the solutions.
 {
   B[1] = A[0] * B[1] - A[1] * B[0];
@@ -218,8 +541,8 @@ solve_4 (long double *A,
   solve_3 (B + 1, C + 1, D + 1, E + 1);
   E[0] = (E[0] - B[0] * E[1] - C[0] * E[2] - D[0] * E[3]) / A[0];
 #if EPSILON
-  if (fabsl (E[0]) < LDBL_EPSILON)
-    E[0] = 0.L;
+  if (fabsr (E[0]) < REAL_EPSILON)
+    E[0] = REAL (0.);
 #endif
 }
 
@@ -227,17 +550,17 @@ solve_4 (long double *A,
  * Function to solve a system of five linear equations.
  */
 static inline void
-solve_5 (long double *A,
+solve_5 (Real *A,
          ///< First matrix column modified by the algorithm:
-         long double *B,
+         Real *B,
          ///< Second matrix column modified by the algorithm.
-         long double *C,
+         Real *C,
          ///< Third matrix column modified by the algorithm.
-         long double *D,
+         Real *D,
          ///< Fourth matrix column modified by the algorithm.
-         long double *E,
+         Real *E,
          ///< Fifth matrix column modified by the algorithm.
-         long double *F)
+         Real *F)
  ///< Sixth matrix column modified by the algorithm to contain the solutions.
 {
   B[1] = A[0] * B[1] - A[1] * B[0];
@@ -263,8 +586,8 @@ solve_5 (long double *A,
   solve_4 (B + 1, C + 1, D + 1, E + 1, F + 1);
   F[0] = (F[0] - B[0] * F[1] - C[0] * F[2] - D[0] * F[3] - E[0] * F[4]) / A[0];
 #if EPSILON
-  if (fabsl (F[0]) < LDBL_EPSILON)
-    F[0] = 0.L;
+  if (fabsr (F[0]) < REAL_EPSILON)
+    F[0] = REAL (0.);
 #endif
 }
 
@@ -272,19 +595,19 @@ solve_5 (long double *A,
  * Function to solve a system of six linear equations.
  */
 static inline void
-solve_6 (long double *A,
+solve_6 (Real *A,
          ///< First matrix column modified by the algorithm:
-         long double *B,
+         Real *B,
          ///< Second matrix column modified by the algorithm.
-         long double *C,
+         Real *C,
          ///< Third matrix column modified by the algorithm.
-         long double *D,
+         Real *D,
          ///< Fourth matrix column modified by the algorithm.
-         long double *E,
+         Real *E,
          ///< Fifth matrix column modified by the algorithm.
-         long double *F,
+         Real *F,
          ///< Sixth matrix column modified by the algorithm.
-         long double *G)
+         Real *G)
  ///< Seventh matrix column modified by the algorithm to contain the solutions.
 {
   B[1] = A[0] * B[1] - A[1] * B[0];
@@ -321,8 +644,8 @@ solve_6 (long double *A,
   G[0] = (G[0] - B[0] * G[1] - C[0] * G[2] - D[0] * G[3] - E[0] * G[4]
           - F[0] * G[5]) / A[0];
 #if EPSILON
-  if (fabsl (G[0]) < LDBL_EPSILON)
-    G[0] = 0.L;
+  if (fabsr (G[0]) < REAL_EPSILON)
+    G[0] = REAL (0.);
 #endif
 }
 
@@ -330,21 +653,21 @@ solve_6 (long double *A,
  * Function to solve a system of six linear equations.
  */
 static inline void
-solve_7 (long double *A,
+solve_7 (Real *A,
          ///< First matrix column modified by the algorithm:
-         long double *B,
+         Real *B,
          ///< Second matrix column modified by the algorithm.
-         long double *C,
+         Real *C,
          ///< Third matrix column modified by the algorithm.
-         long double *D,
+         Real *D,
          ///< Fourth matrix column modified by the algorithm.
-         long double *E,
+         Real *E,
          ///< Fifth matrix column modified by the algorithm.
-         long double *F,
+         Real *F,
          ///< Sixth matrix column modified by the algorithm.
-         long double *G,
+         Real *G,
          ///< Seventh matrix column modified by the algorithm.
-         long double *H)
+         Real *H)
  ///< Eighth matrix column modified by the algorithm to contain the solutions.
 {
   B[1] = A[0] * B[1] - A[1] * B[0];
@@ -393,9 +716,64 @@ solve_7 (long double *A,
   H[0] = (H[0] - B[0] * H[1] - C[0] * H[2] - D[0] * H[3] - E[0] * H[4]
           - F[0] * H[5] - G[0] * H[6]) / A[0];
 #if EPSILON
-  if (fabsl (H[0]) < LDBL_EPSILON)
-    H[0] = 0.L;
+  if (fabsr (H[0]) < REAL_EPSILON)
+    H[0] = REAL (0.);
+#endif
+}
+
+/**
+ * Function to solve a batch of OPTIMIZE_BATCH independent systems of n linear
+ * equations in double precision, with the same algorithm of the solve_N
+ * functions. The matrices are stored as structure of arrays: the element of
+ * the row i and the column j (the column n is the right hand side) of the
+ * system l is M[(j * n + i) * OPTIMIZE_BATCH + l].
+ */
+static inline void
+solve_batch (double *M,
+             ///< Matrix columns modified by the algorithm. The last column
+             ///< contains the solutions.
+             unsigned int n)    ///< number of equations.
+{
+  double v[OPTIMIZE_BATCH];
+  double *a, *b, *c, *d, *x;
+  unsigned int i, j, k, l;
+  for (k = 0; k + 1 < n; ++k)
+    {
+      a = M + (k * n + k) * OPTIMIZE_BATCH;
+      for (j = k + 1; j <= n; ++j)
+        {
+          b = M + (j * n + k) * OPTIMIZE_BATCH;
+          for (i = k + 1; i < n; ++i)
+            {
+              c = M + (j * n + i) * OPTIMIZE_BATCH;
+              d = M + (k * n + i) * OPTIMIZE_BATCH;
+              for (l = 0; l < OPTIMIZE_BATCH; ++l)
+                c[l] = a[l] * c[l] - d[l] * b[l];
+            }
+        }
+    }
+  x = M + n * n * OPTIMIZE_BATCH;
+  for (k = n; k-- > 0;)
+    {
+      c = x + k * OPTIMIZE_BATCH;
+      for (l = 0; l < OPTIMIZE_BATCH; ++l)
+        v[l] = c[l];
+      for (j = k + 1; j < n; ++j)
+        {
+          b = M + (j * n + k) * OPTIMIZE_BATCH;
+          d = x + j * OPTIMIZE_BATCH;
+          for (l = 0; l < OPTIMIZE_BATCH; ++l)
+            v[l] -= b[l] * d[l];
+        }
+      a = M + (k * n + k) * OPTIMIZE_BATCH;
+      for (l = 0; l < OPTIMIZE_BATCH; ++l)
+        {
+          c[l] = v[l] / a[l];
+#if EPSILON
+          c[l] = (fabs (c[l]) < REAL_EPSILON) ? 0. : c[l];
 #endif
+        }
+    }
 }
 
 #endif